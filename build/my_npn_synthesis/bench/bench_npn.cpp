@@ -0,0 +1,241 @@
+// bench_npn.cpp
+// Throughput benchmarks for the NPN synthesis tool at n = 3..6. Results are
+// appended to bench/npn_bench.json in the experiments<> format
+// (experiments/experiments.hpp), one dataset per git revision, so runs can
+// be compared commit to commit with experiment<>::compare.
+//
+// Rows (items / per_second):
+//   canon_classifier    functions canonized by NPNClassifier (packed)
+//   canon_kitty         functions canonized by kitty::exact_npn_canonization
+//   mig_strash_insert   gates of the synthesized MIGs replayed through a
+//                       StrashTable (find + insert only)
+//   sim_mig             gate evaluations in MIG::simulate
+//   sim_maj5            gate evaluations in MAJ5Chain::simulate
+//   synth_mig           classes through synthesizeOptimalMIG   (+ latency)
+//   synth_maj5_exact    classes through synthesizeMAJ5Exact    (+ latency)
+//
+// Usage:
+//   bench_npn [--scale F]
+//       F multiplies all sample counts (default 1)
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/npn.hpp>
+
+#include <experiments.hpp>
+
+#include "../src/maj5_exact.h"
+#include "../src/mig_structure.h"
+#include "../src/mig_synthesizer.h"
+#include "../src/npn_classifier.h"
+#include "../src/npn_database.h"
+#include "../src/strash_table.h"
+#include "../src/truth_table.h"
+
+// ───────────────────────────── Config ─────────────────────────────
+static constexpr int      MIN_VARS        = 3;
+static constexpr int      MAX_VARS        = 6;
+static constexpr uint64_t SEED            = 1;
+static constexpr int      SIM_REPEAT      = 200;    // simulate() calls per network
+static constexpr int      MAJ5_GATES      = 16;     // gates per random MAJ5 chain
+static constexpr int      EXACT_MAX_VARS  = 4;      // exact synthesis above this is minutes
+static constexpr double   EXACT_TIMEOUT   = 2.0;    // seconds per class
+
+// Samples per benchmark, indexed by n
+static constexpr uint64_t CANON_SAMPLES[MAX_VARS + 1] = {0, 0, 0, 200000, 50000, 5000, 50};
+static constexpr uint64_t KITTY_SAMPLES[MAX_VARS + 1] = {0, 0, 0, 200000, 20000, 500, 5};
+static constexpr uint64_t SYNTH_SAMPLES[MAX_VARS + 1] = {0, 0, 0, 2000, 1000, 200, 50};
+static constexpr uint64_t EXACT_SAMPLES[MAX_VARS + 1] = {0, 0, 0, 50, 20, 0, 0};
+
+using clock_type = std::chrono::steady_clock;
+using bench_experiment = experiments::experiment<std::string, uint32_t, uint64_t, double, double,
+                                                 double, double, double>;
+
+static double seconds_since(clock_type::time_point t){
+  return std::chrono::duration<double>(clock_type::now()-t).count();
+}
+
+static std::vector<uint64_t> random_functions(int n,uint64_t count,std::mt19937_64& rng){
+  std::vector<uint64_t> tts(count);
+  for(auto& tt:tts) tt=rng()&TruthTable::packedMask(n);
+  return tts;
+}
+
+// p-th percentile of the latencies in microseconds
+static double percentile_us(std::vector<double> secs,double p){
+  if(secs.empty()) return 0.0;
+  std::sort(secs.begin(),secs.end());
+  size_t idx=std::min(secs.size()-1,(size_t)(p*secs.size()));
+  return secs[idx]*1e6;
+}
+
+static void add_rate(bench_experiment& exp,const std::string& name,int n,uint64_t items,double secs){
+  exp(name,(uint32_t)n,items,secs,items/std::max(secs,1e-9),0.0,0.0,0.0);
+}
+
+static void add_latency(bench_experiment& exp,const std::string& name,int n,const std::vector<double>& secs){
+  double total=0;
+  for(double s:secs) total+=s;
+  exp(name,(uint32_t)n,(uint64_t)secs.size(),total,secs.size()/std::max(total,1e-9),
+      percentile_us(secs,0.5),percentile_us(secs,0.9),percentile_us(secs,0.99));
+}
+
+// Random topological MAJ5 chain over n inputs (fanins drawn from all
+// earlier literals)
+static MAJ5Chain random_maj5_chain(int n,std::mt19937_64& rng){
+  MAJ5Chain chain; chain.num_inputs=n;
+  for(int j=0;j<MAJ5_GATES;j++){
+    const uint32_t num_lits=chain.gateLit(j);
+    std::array<uint32_t,5> fanins;
+    for(auto& f:fanins) f=(uint32_t)(rng()%num_lits);
+    chain.addGate(fanins);
+  }
+  chain.output=chain.gateLit(MAJ5_GATES-1);
+  return chain;
+}
+
+// Sorted fanin literals of a gate packed the way MIGBuilder hashes them
+// (pack_input in mig_synthesizer.cpp: kind rank CONST0 < CONST1 < PI < NODE,
+// index, inversion)
+static StrashKey gate_key(const MIGGate& g){
+  auto pack=[](const MIGInput& in){
+    uint64_t rank=0;
+    switch(in.kind){
+      case MIGInput::Kind::CONST0: rank=0; break;
+      case MIGInput::Kind::CONST1: rank=1; break;
+      case MIGInput::Kind::PI:     rank=2; break;
+      case MIGInput::Kind::NODE:   rank=3; break;
+    }
+    return (rank<<19)|((uint64_t)in.index<<1)|(in.inverted?1u:0u);
+  };
+  std::array<uint64_t,3> lits{pack(g.a),pack(g.b),pack(g.c)};
+  std::sort(lits.begin(),lits.end());
+  StrashKey key;
+  key.lo=lits[0]|(lits[1]<<21)|(lits[2]<<42);
+  return key;
+}
+
+// ─────────────────────────── Benchmarks ───────────────────────────
+static void bench_canonization(bench_experiment& exp,int n,double scale,std::mt19937_64& rng){
+  auto tts=random_functions(n,(uint64_t)(CANON_SAMPLES[n]*scale)+1,rng);
+  uint64_t checksum=0;
+  auto t0=clock_type::now();
+  for(uint64_t tt:tts) checksum^=NPNClassifier::getNPNRepresentative(tt,n);
+  add_rate(exp,"canon_classifier",n,tts.size(),seconds_since(t0));
+
+  // kitty on a prefix of the same functions; representatives must agree
+  tts.resize(std::min<size_t>(tts.size(),(size_t)(KITTY_SAMPLES[n]*scale)+1));
+  std::vector<kitty::dynamic_truth_table> ktts(tts.size(),kitty::dynamic_truth_table(n));
+  for(size_t i=0;i<tts.size();i++) *ktts[i].begin()=tts[i];
+  uint64_t mismatches=0;
+  t0=clock_type::now();
+  std::vector<uint64_t> kitty_reps(tts.size());
+  for(size_t i=0;i<tts.size();i++) kitty_reps[i]=*std::get<0>(kitty::exact_npn_canonization(ktts[i])).begin();
+  add_rate(exp,"canon_kitty",n,tts.size(),seconds_since(t0));
+  for(size_t i=0;i<tts.size();i++)
+    if(kitty_reps[i]!=NPNClassifier::getNPNRepresentative(tts[i],n)) mismatches++;
+  if(mismatches) std::cerr<<"WARNING: n="<<n<<": "<<mismatches<<" representatives differ from kitty\n";
+  (void)checksum;
+}
+
+static void bench_mig(bench_experiment& exp,int n,double scale,std::mt19937_64& rng){
+  auto tts=random_functions(n,(uint64_t)(SYNTH_SAMPLES[n]*scale)+1,rng);
+
+  // Synthesis latency on class representatives, which also builds the
+  // networks for the strash and simulation rows
+  std::vector<std::unique_ptr<MIG>> migs;
+  std::vector<double> latency;
+  for(uint64_t tt:tts){
+    const std::string rep=TruthTable::binaryToTruthTable(NPNClassifier::getNPNRepresentative(tt,n),n);
+    auto t0=clock_type::now();
+    auto mig=synthesizeOptimalMIG(rep);
+    latency.push_back(seconds_since(t0));
+    if(mig) migs.push_back(std::move(mig));
+  }
+
+  // Strash insertion alone: keys are packed up front so that only the
+  // table's find/insert calls are timed
+  std::vector<std::vector<StrashKey>> keys;
+  uint64_t gates=0;
+  for(const auto& mig:migs){
+    keys.emplace_back();
+    for(const auto& g:mig->getGates()) keys.back().push_back(gate_key(g));
+    gates+=keys.back().size();
+  }
+  uint64_t hits=0;
+  auto t0=clock_type::now();
+  for(int r=0;r<SIM_REPEAT;r++)
+    for(const auto& ks:keys){
+      StrashTable table(ks.size());
+      for(size_t i=0;i<ks.size();i++){
+        if(table.find(ks[i])>=0) hits++;
+        else table.insert(ks[i],(int)i);
+      }
+    }
+  add_rate(exp,"mig_strash_insert",n,gates*SIM_REPEAT,seconds_since(t0));
+  (void)hits;
+
+  uint64_t evals=0;
+  t0=clock_type::now();
+  for(int r=0;r<SIM_REPEAT;r++)
+    for(const auto& mig:migs){ evals+=mig->size(); (void)mig->simulate(); }
+  add_rate(exp,"sim_mig",n,evals,seconds_since(t0));
+
+  add_latency(exp,"synth_mig",n,latency);
+}
+
+static void bench_maj5(bench_experiment& exp,int n,double scale,std::mt19937_64& rng){
+  std::vector<MAJ5Chain> chains;
+  for(uint64_t i=0;i<(uint64_t)(SYNTH_SAMPLES[n]*scale)+1;i++) chains.push_back(random_maj5_chain(n,rng));
+  uint64_t evals=0,checksum=0;
+  auto t0=clock_type::now();
+  for(int r=0;r<SIM_REPEAT;r++)
+    for(const auto& c:chains){ evals+=c.numGates(); checksum^=c.simulate(); }
+  add_rate(exp,"sim_maj5",n,evals,seconds_since(t0));
+  (void)checksum;
+
+  if(n>EXACT_MAX_VARS) return;
+  MAJ5ExactParams ps;
+  ps.timeout_seconds=EXACT_TIMEOUT;
+  std::vector<double> latency;
+  for(uint64_t tt:random_functions(n,(uint64_t)(EXACT_SAMPLES[n]*scale)+1,rng)){
+    auto t0=clock_type::now();
+    synthesizeMAJ5Exact(NPNClassifier::getNPNRepresentative(tt,n),n,ps);
+    latency.push_back(seconds_since(t0));
+  }
+  add_latency(exp,"synth_maj5_exact",n,latency);
+}
+
+// ─────────────────────────── Main ─────────────────────────────
+int main(int argc,char** argv){
+  double scale=1.0;
+  for(int i=1;i<argc;i++){
+    std::string arg=argv[i];
+    if(arg=="--scale"&&i+1<argc) scale=std::stod(argv[++i]);
+    else{
+      std::cerr<<"Usage: "<<argv[0]<<" [--scale F]\n";
+      return 1;
+    }
+  }
+
+  bench_experiment exp("npn_bench","benchmark","vars","items","seconds","per_second",
+                       "p50_us","p90_us","p99_us");
+  std::mt19937_64 rng(SEED);
+  for(int n=MIN_VARS;n<=MAX_VARS;n++){
+    std::cerr<<"[BENCH] n="<<n<<"\n";
+    bench_canonization(exp,n,scale,rng);
+    bench_mig(exp,n,scale,rng);
+    bench_maj5(exp,n,scale,rng);
+  }
+  exp.save();
+  exp.table();
+  return 0;
+}
@@ -1,17 +1,41 @@
-#include <chrono>
+#include <algorithm>
 #include <iostream>
-#include <map>
-#include <sstream>
+#include <string>
+#include <thread>
 #include <vector>
 
 // my project headers
+#include "../src/class_driver.h"
 #include "../src/truth_table.h"
 #include "../src/npn_classifier.h"
+#include "../src/npn_database.h"
 #include "../src/mig_synthesizer.h"
 #include "../src/mig_structure.h" 
 #include "../src/utils.h"
 
-void computeN4(int max_classes = -1) {
+// MIG gates as MAJ(a, b, c) gates of a MAJ5Chain. The MIG numbers inputs
+// from the MSB of the row index (x0 = bit n-1), the database from the LSB.
+static MAJ5Chain chainFromMIG(const MIG& mig) {
+    MAJ5Chain chain;
+    chain.num_inputs = mig.numInputs();
+    auto lit = [&](const MIGInput& in) {
+        uint32_t l = 0;
+        switch (in.kind) {
+            case MIGInput::Kind::CONST0: l = 0; break;
+            case MIGInput::Kind::CONST1: l = 1; break;
+            case MIGInput::Kind::PI: l = chain.inputLit(chain.num_inputs - 1 - in.index); break;
+            case MIGInput::Kind::NODE: l = chain.gateLit(in.index); break;
+        }
+        return l ^ (in.inverted ? 1u : 0u);
+    };
+    for (const auto& g : mig.getGates()) {
+        chain.addMaj3(lit(g.a), lit(g.b), lit(g.c));
+    }
+    chain.output = chain.gateLit(mig.getOutputGate(), mig.isOutputInverted());
+    return chain;
+}
+
+void computeN4(int max_classes = -1, unsigned num_threads = 1) {
     Utils::Timer timer("compute_n4");
 
     int n_vars = 4;
@@ -28,75 +52,71 @@ void computeN4(int max_classes = -1) {
         std::cout << "Processing first " << max_classes << " classes only" << std::endl;
     }
 
-    std::stringstream database;
-    double total_time = 0;
-    int success_count = 0, fail_count = 0;
-    std::map<int, int> size_hist;
+    std::vector<uint64_t> functions;
+    for (const auto& rep : npn_classes) functions.push_back(TruthTable::truthTableToBinary(rep));
 
-    auto global_start = std::chrono::high_resolution_clock::now();
-
-    for (size_t i = 0; i < npn_classes.size(); ++i) {
-        const auto& rep = npn_classes[i];
-
-        if (i % 10 == 0) {
-            auto now = std::chrono::high_resolution_clock::now();
-            double elapsed = std::chrono::duration<double>(now - global_start).count();
-            std::cout << "[Progress] " << (i + 1) << "/" << npn_classes.size()
-                      << " (" << (100.0 * (i + 1) / npn_classes.size()) << "%)"
-                      << " | Elapsed: " << elapsed << "s" << std::endl;
+    // Classes run on the driver's worker pool; results come back in order
+    auto synthesize = [&](size_t i) {
+        ClassResult r;
+        if (auto mig = synthesizeOptimalMIG(npn_classes[i])) {
+            r.success = true;
+            r.chain = chainFromMIG(*mig);
         }
-
-        std::cout << "\n[" << (i + 1) << "/" << npn_classes.size() 
-                  << "] Processing: " << rep << std::endl;
-
-        auto start = std::chrono::high_resolution_clock::now();
-        auto mig = synthesizeOptimalMIG(rep);
-        auto end = std::chrono::high_resolution_clock::now();
-
-        double synth_time = std::chrono::duration<double>(end - start).count();
-        total_time += synth_time;
-
-        if (mig) {
-            int sz = mig->size();
-            size_hist[sz]++;
-            success_count++;
-
-            database << "CLASS " << rep << "\n";
-            database << mig->toText();
-            database << "TIME " << synth_time << "\n";
-            database << "---\n";
-
-            std::cout << "  ✓ Size: " << sz 
-                      << ", Depth: " << mig->depth() 
-                      << ", Time: " << synth_time << "s" << std::endl;
+        return r;
+    };
+
+    std::vector<std::pair<uint64_t, MAJ5Chain>> database;
+    int invalid_count = 0;
+    auto on_result = [&](size_t i, const ClassResult& r) {
+        if (!r.success) {
+            std::cout << "  ✗ Failed to synthesize " << npn_classes[i] << std::endl;
+        } else if (r.chain.simulate() != functions[i]) {
+            // one simulation pass over the network
+            invalid_count++;
+            std::cout << "  ✗ Network does not implement " << npn_classes[i] << std::endl;
         } else {
-            fail_count++;
-            std::cout << "  ✗ Failed to synthesize" << std::endl;
+            database.emplace_back(functions[i], r.chain);
         }
-    }
+    };
+
+    ClassDriverParams ps;
+    ps.num_threads = num_threads;
+    ps.label = "Progress";
+    ClassDriverStats stats = runClassDriver(functions, n_vars, 3, synthesize, on_result, ps);
 
     std::cout << "\n" << std::string(40, '=') << std::endl;
     std::cout << "SYNTHESIS COMPLETE\n";
-    std::cout << "Success: " << success_count 
-              << ", Fail: " << fail_count 
-              << ", Total time: " << total_time << "s" << std::endl;
-    std::cout << "Average/class: " << total_time / npn_classes.size() << "s" << std::endl;
+    std::cout << "Success: " << stats.success 
+              << ", Fail: " << stats.fail 
+              << ", Invalid: " << invalid_count
+              << ", Total time: " << stats.synth_seconds << "s"
+              << ", Wall time: " << stats.wall_seconds << "s" << std::endl;
+    std::cout << "Average/class: " << stats.synth_seconds / npn_classes.size() << "s" << std::endl;
 
     std::cout << "\nSize distribution:" << std::endl;
-    for (const auto& [sz, count] : size_hist) {
+    for (const auto& [sz, count] : stats.size_hist) {
         std::cout << "  " << sz << " gates: " << count << " functions" << std::endl;
     }
 
-    Utils::saveToTxt(database.str(), "data/npn_" + std::to_string(n_vars) + "var.txt");
-    Utils::logMessage("Completed n=4 with " + std::to_string(success_count) + " classes");
+    const std::string db_path = "data/npn_" + std::to_string(n_vars) + "var.db";
+    Utils::ensureDir("data");
+    NPNDatabase::write(db_path, n_vars, 3, std::move(database));
+    std::cout << "Saved to " << db_path << std::endl;
+    Utils::logMessage("Completed n=4 with " + std::to_string(stats.success) + " classes");
 }
 
+// Usage: compute_n4 [max_classes] [--threads N]
 int main(int argc, char* argv[]) {
-    if (argc > 1) {
-        int max_classes = std::stoi(argv[1]);
-        computeN4(max_classes);
-    } else {
-        computeN4();
+    int max_classes = -1;
+    unsigned num_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc) {
+            num_threads = std::max(1, std::stoi(argv[++i]));
+        } else {
+            max_classes = std::stoi(arg);
+        }
     }
+    computeN4(max_classes, num_threads);
     return 0;
 }
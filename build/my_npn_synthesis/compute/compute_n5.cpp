@@ -1,7 +1,14 @@
 // compute_n5.cpp
 // Pure Majority-5 synthesis with NPN classification for 5-input Boolean functions.
+// Networks are minimum-size MAJ5 chains from the SAT-based exact engine
+// (src/maj5_exact.h); classes that time out fall back to the SOP construction.
 //
-// Output format:
+// Writes the networks into the binary NPN database data/npn_5var.db
+// (src/npn_database.h), keyed by canonical truth table. Classes are
+// synthesized in parallel (src/class_driver.h) and journaled to
+// data/npn_5var.ckpt; rerunning an interrupted job with the same options
+// resumes from the journal. With --text the
+// classes are also written as text blocks to data/npn_5var.txt:
 //   CLASS <bits>
 //   G0 = MAJ5(...)
 //   ...
@@ -9,19 +16,35 @@
 //   TIME <seconds>
 //   ---
 //
-// Writes results into data/npn_5var.txt
+// Usage:
+//   compute_n5                          sample SAMPLE_COUNT random functions
+//   compute_n5 --exhaustive [--threads N]
+//       test all 2^32 functions; the complete class list (616,126 classes)
+//       is also written to data/npn_5var_classes.txt
+//
+// Synthesis options:
+//   --max-classes N   only synthesize the first N classes (default: all)
+//   --timeout S       exact synthesis time limit per class (default: 60)
+//   --max-gates G     exact synthesis gate limit (default: 8)
+//   --sop             skip exact synthesis, SOP construction only
+//   --text            also write the text listing
+//   --threads N       worker threads for enumeration and synthesis
 //
 // Compatible with older kitty (set_bit only, no reset_bit).
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <cstdio>
 #include <exception>
+#include <stdexcept>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <string>
-#include <unordered_map>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -29,12 +52,29 @@
 #include <kitty/npn.hpp>
 #include <kitty/print.hpp>
 
+#include "../src/class_driver.h"
+#include "../src/maj5_exact.h"
+#include "../src/npn_classifier.h"
+#include "../src/npn_database.h"
+#include "../src/strash_table.h"
+#include "../src/truth_table.h"
+#include "../src/utils.h"
+
 // ───────────────────────────── Config ─────────────────────────────
 static constexpr int      N_VARS         = 5;
 static constexpr uint64_t SAMPLE_COUNT   = 100000;   // random samples
-static constexpr uint32_t MAX_SYNTH      = 50;       // reps to synthesize
+static constexpr uint32_t SAMPLE_SEED    = 1;        // first sample seed
 static constexpr uint32_t PROGRESS_EVERY = 10000;    // log interval
 
+// Exhaustive mode
+static constexpr uint64_t NUM_FUNCTIONS    = 1ull << 32;  // 2^(2^5)
+static constexpr uint64_t CHUNK_SIZE       = 1ull << 16;  // functions per work item
+static constexpr int      PROGRESS_SECONDS = 5;           // log interval
+static constexpr size_t   EXPECTED_CLASSES = 616126;
+
+// Synthesis
+static constexpr const char* CHECKPOINT_PATH = "data/npn_5var.ckpt";
+
 // ────────────────────────── MAJ5 Structures ───────────────────────
 struct MAJ5Input {
   enum class Kind { PI, CONST0, CONST1, NODE } kind{Kind::PI};
@@ -53,56 +93,57 @@ struct MAJ5Net {
   std::vector<Gate> gates;
   int output_gate{-1};
   bool output_inv{false};
-  std::unordered_map<std::string,int> cache;
-
-  static std::string sig2str(const MAJ5Input& s){
-    std::string n;
-    switch(s.kind){
-      case MAJ5Input::Kind::PI: n="x"+std::to_string(s.index); break;
-      case MAJ5Input::Kind::NODE: n="G"+std::to_string(s.index); break;
-      case MAJ5Input::Kind::CONST0: n="0"; break;
-      case MAJ5Input::Kind::CONST1: n="1"; break;
-    }
-    if(s.inv) n += "'";
-    return n;
-  }
-
-  std::string to_text() const {
-    std::string out;
-    for(size_t i=0;i<gates.size();i++){
-      const auto& g=gates[i];
-      out += "G"+std::to_string(i)+" = MAJ5("+
-             sig2str(g.a)+", "+sig2str(g.b)+", "+
-             sig2str(g.c)+", "+sig2str(g.d)+", "+
-             sig2str(g.e)+")\n";
-    }
-    out += "OUTPUT = ";
-    if(output_gate>=0) out += "G"+std::to_string(output_gate); else out += "?";
-    if(output_inv) out += "'";
-    out += "\n";
-    return out;
-  }
+  StrashTable cache;
 
-  std::string keyPart(const MAJ5Input& s){
-    return std::to_string((int)s.kind)+":"+std::to_string(s.index)+":"+std::to_string((int)s.inv);
+  // 21-bit literal: kind (2 bits) | index (18 bits) | inv, so sorting
+  // literals orders inputs by (kind, index, inv)
+  static constexpr int LIT_BITS=21;
+  static uint32_t pack(const MAJ5Input& s){
+    if(s.index<0||s.index>=(1<<(LIT_BITS-3))) throw std::length_error("MAJ5 input index exceeds strash literal range");
+    return ((uint32_t)s.kind<<(LIT_BITS-2))|((uint32_t)s.index<<1)|(s.inv?1u:0u);
   }
 
   int create_maj5(MAJ5Input a,MAJ5Input b,MAJ5Input c,MAJ5Input d,MAJ5Input e){
     std::array<MAJ5Input,5> v{a,b,c,d,e};
-    std::sort(v.begin(),v.end(),[&](const MAJ5Input& x,const MAJ5Input& y){
-      if(x.kind!=y.kind) return (int)x.kind<(int)y.kind;
-      if(x.index!=y.index) return x.index<y.index;
-      return (int)x.inv<(int)y.inv;
-    });
-    std::string key="M5("+keyPart(v[0])+","+keyPart(v[1])+","+keyPart(v[2])+","+keyPart(v[3])+","+keyPart(v[4])+")";
-    if(auto it=cache.find(key);it!=cache.end()) return it->second;
+    std::array<uint32_t,5> lit;
+    for(int i=0;i<5;i++) lit[i]=pack(v[i]);
+    // insertion sort keeps inputs and literals paired
+    for(int i=1;i<5;i++)
+      for(int j=i;j>0&&lit[j]<lit[j-1];j--){ std::swap(lit[j],lit[j-1]); std::swap(v[j],v[j-1]); }
+    StrashKey key;
+    key.hi=(uint64_t)lit[0]|((uint64_t)lit[1]<<LIT_BITS)|((uint64_t)lit[2]<<(2*LIT_BITS));
+    key.lo=(uint64_t)lit[3]|((uint64_t)lit[4]<<LIT_BITS);
+    if(int id=cache.find(key);id>=0) return id;
     gates.push_back({v[0],v[1],v[2],v[3],v[4]});
     int id=(int)gates.size()-1;
-    cache.emplace(key,id);
+    cache.insert(key,id);
     return id;
   }
 
   void set_output_node(int node_id,bool inv=false){ output_gate=node_id; output_inv=inv; }
+
+  // Output function (bit m = minterm m, x_j = bit j of m), all gates in
+  // one topological pass with word-wide MAJ5
+  uint64_t simulate() const {
+    const uint64_t mask=TruthTable::packedMask(num_pis);
+    std::vector<uint64_t> values(gates.size());
+    auto word=[&](const MAJ5Input& s)->uint64_t{
+      uint64_t x=0;
+      switch(s.kind){
+        case MAJ5Input::Kind::PI: x=truth_table_detail::kProjections[s.index]&mask; break;
+        case MAJ5Input::Kind::CONST0: x=0; break;
+        case MAJ5Input::Kind::CONST1: x=mask; break;
+        case MAJ5Input::Kind::NODE: x=values[s.index]; break;
+      }
+      return s.inv?(~x&mask):x;
+    };
+    for(size_t i=0;i<gates.size();i++){
+      const auto& g=gates[i];
+      values[i]=TruthTable::majority5(word(g.a),word(g.b),word(g.c),word(g.d),word(g.e));
+    }
+    if(output_gate<0) return 0;
+    return output_inv?(~values[output_gate]&mask):values[output_gate];
+  }
 };
 
 static MAJ5Input maj5_and2(MAJ5Net& net, MAJ5Input a, MAJ5Input b){
@@ -155,6 +196,44 @@ static MAJ5Net synthesize_maj5_from_tt_5(const kitty::dynamic_truth_table& tt){
   return net;
 }
 
+static MAJ5Input maj5_input_of(const MAJ5Chain& chain,uint32_t lit,const std::vector<int>& gate_ids){
+  const bool inv=(lit&1u)!=0u;
+  if(lit<2) return inv?MAJ5Input::C1():MAJ5Input::C0();
+  const int idx=(int)((lit-2)/2);
+  if(idx<chain.num_inputs) return MAJ5Input::PI(idx,inv);
+  return MAJ5Input::NODE(gate_ids[idx-chain.num_inputs],inv);
+}
+
+static MAJ5Net maj5net_from_chain(const MAJ5Chain& chain){
+  MAJ5Net net; net.num_pis=chain.num_inputs;
+  std::vector<int> gate_ids;
+  for(const auto& g:chain.gates){
+    auto in=[&](int k){ return maj5_input_of(chain,g[k],gate_ids); };
+    gate_ids.push_back(net.create_maj5(in(0),in(1),in(2),in(3),in(4)));
+  }
+  MAJ5Input root=maj5_input_of(chain,chain.output,gate_ids);
+  if(root.kind==MAJ5Input::Kind::NODE) net.set_output_node(root.index,root.inv);
+  else net.set_output_node(net.create_maj5(root,root,root,root,root));
+  return net;
+}
+
+static MAJ5Chain chain_from_maj5net(const MAJ5Net& net){
+  MAJ5Chain chain; chain.num_inputs=net.num_pis;
+  auto lit=[&](const MAJ5Input& s)->uint32_t{
+    uint32_t l=0;
+    switch(s.kind){
+      case MAJ5Input::Kind::PI: l=chain.inputLit(s.index); break;
+      case MAJ5Input::Kind::CONST0: l=0; break;
+      case MAJ5Input::Kind::CONST1: l=1; break;
+      case MAJ5Input::Kind::NODE: l=chain.gateLit(s.index); break;
+    }
+    return l^(s.inv?1u:0u);
+  };
+  for(const auto& g:net.gates) chain.addGate({lit(g.a),lit(g.b),lit(g.c),lit(g.d),lit(g.e)});
+  chain.output=net.output_gate<0?0u:chain.gateLit(net.output_gate,net.output_inv);
+  return chain;
+}
+
 // ─────────────────────────── Helpers ─────────────────────────────
 static std::string hex_to_32_bits(const std::string& hex_in){
   std::string hex=hex_in;
@@ -184,54 +263,183 @@ static void set_tt_from_bits(kitty::dynamic_truth_table& tt, const std::string&
   }
 }
 
-static std::string class_bits_from_tt(const kitty::dynamic_truth_table& tt){
-  std::string s; s.resize(32);
-  for(uint32_t m=0;m<32;m++) s[31-m]=kitty::get_bit(tt,m)?'1':'0';
-  return s;
+// ─────────────────────── Exhaustive enumeration ──────────────────
+// Orbit-representative generation: a function is kept iff it is the
+// smallest member of its NPN orbit (the same representative kitty's
+// exact_npn_canonization picks).  The test stops at the first smaller
+// transform, so non-representatives cost a few word operations and no
+// visited set is needed.  Workers claim fixed-size chunks of the function
+// space and keep their hits per chunk, so the merged list is sorted and
+// identical for any thread count.
+static std::vector<uint32_t> enumerate_npn5_exhaustive(unsigned num_threads){
+  const uint64_t num_chunks=NUM_FUNCTIONS/CHUNK_SIZE;
+  std::vector<std::vector<uint32_t>> found(num_chunks);
+  std::atomic<uint64_t> next_chunk{0}, scanned{0}, classes{0};
+  std::atomic<unsigned> finished{0};
+
+  auto worker=[&](){
+    for(;;){
+      uint64_t chunk=next_chunk.fetch_add(1,std::memory_order_relaxed);
+      if(chunk>=num_chunks) break;
+      auto& reps=found[chunk];
+      const uint64_t begin=chunk*CHUNK_SIZE;
+      for(uint64_t f=begin;f<begin+CHUNK_SIZE;f++){
+        if(NPNClassifier::isNPNRepresentative(f,N_VARS)) reps.push_back((uint32_t)f);
+      }
+      // counters are only touched once per chunk
+      scanned.fetch_add(CHUNK_SIZE,std::memory_order_relaxed);
+      classes.fetch_add(reps.size(),std::memory_order_relaxed);
+    }
+    finished.fetch_add(1);
+  };
+
+  auto t0=std::chrono::steady_clock::now();
+  std::vector<std::thread> pool;
+  for(unsigned t=0;t<num_threads;t++) pool.emplace_back(worker);
+
+  auto last_report=t0;
+  while(finished.load()<num_threads){
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    auto now=std::chrono::steady_clock::now();
+    if(now-last_report<std::chrono::seconds(PROGRESS_SECONDS)) continue;
+    last_report=now;
+    double secs=std::chrono::duration<double>(now-t0).count();
+    uint64_t done=scanned.load(std::memory_order_relaxed);
+    std::cerr<<"[NPN] scanned "<<done<<"/"<<NUM_FUNCTIONS
+             <<" ("<<(100.0*done/NUM_FUNCTIONS)<<"%)"
+             <<" | classes so far: "<<classes.load(std::memory_order_relaxed)
+             <<" | "<<(done/secs/1e6)<<" M functions/s"
+             <<" | elapsed: "<<secs<<"s\n";
+  }
+  for(auto& th:pool) th.join();
+
+  std::vector<uint32_t> reps;
+  reps.reserve(classes.load());
+  for(auto& v:found) reps.insert(reps.end(),v.begin(),v.end());
+
+  double secs=std::chrono::duration<double>(std::chrono::steady_clock::now()-t0).count();
+  std::cerr<<"[NPN] exhaustive enumeration finished in "<<secs<<"s with "
+           <<num_threads<<" threads ("<<(NUM_FUNCTIONS/secs/1e6)<<" M functions/s)\n"
+           <<"[NPN] classes: "<<reps.size()<<" (expected "<<EXPECTED_CLASSES<<")\n";
+  return reps;
+}
+
+static std::string hex_of_word(uint32_t w){
+  char buf[9];
+  std::snprintf(buf,sizeof(buf),"%08x",w);
+  return buf;
 }
 
 // ─────────────────────────── Main ─────────────────────────────
-int main(){
+int main(int argc,char** argv){
   try{
-    kitty::dynamic_truth_table tt(N_VARS);
-    std::unordered_set<std::string> reps_hex;
-    reps_hex.reserve(SAMPLE_COUNT/2);
-
-    for(uint64_t i=0;i<SAMPLE_COUNT;i++){
-      kitty::create_random(tt);
-      auto canon=kitty::exact_npn_canonization(tt);
-      reps_hex.insert(kitty::to_hex(std::get<0>(canon)));
-      if(((i+1)%PROGRESS_EVERY)==0)
-        std::cerr<<"[NPN] processed "<<(i+1)<<"/"<<SAMPLE_COUNT
-                 <<" | reps so far: "<<reps_hex.size()<<"\n";
+    bool exhaustive=false,use_exact=true,write_text=false;
+    unsigned num_threads=std::max(1u,std::thread::hardware_concurrency());
+    size_t max_classes=0;
+    MAJ5ExactParams exact_ps;
+    for(int i=1;i<argc;i++){
+      std::string arg=argv[i];
+      if(arg=="--exhaustive") exhaustive=true;
+      else if(arg=="--sop") use_exact=false;
+      else if(arg=="--text") write_text=true;
+      else if(arg=="--threads"&&i+1<argc) num_threads=std::max(1,std::stoi(argv[++i]));
+      else if(arg=="--max-classes"&&i+1<argc) max_classes=std::stoull(argv[++i]);
+      else if(arg=="--timeout"&&i+1<argc) exact_ps.timeout_seconds=std::stod(argv[++i]);
+      else if(arg=="--max-gates"&&i+1<argc) exact_ps.max_gates=std::stoi(argv[++i]);
+      else{
+        std::cerr<<"Usage: "<<argv[0]<<" [--exhaustive] [--threads N] [--max-classes N]"
+                 <<" [--timeout S] [--max-gates G] [--sop] [--text]\n";
+        return 1;
+      }
     }
+    Utils::ensureDir("data");
+
+    std::vector<std::string> reps_sorted;
+    if(exhaustive){
+      auto reps=enumerate_npn5_exhaustive(num_threads);
+      reps_sorted.reserve(reps.size());
+      for(uint32_t w:reps) reps_sorted.push_back(hex_of_word(w));
 
-    std::vector<std::string> reps_sorted(reps_hex.begin(),reps_hex.end());
-    std::sort(reps_sorted.begin(),reps_sorted.end());
+      std::ofstream cls("data/npn_5var_classes.txt");
+      if(!cls){ std::cerr<<"ERROR opening data/npn_5var_classes.txt\n"; return 1; }
+      for(const auto& hex:reps_sorted) cls<<hex<<"\n";
+    }else{
+      kitty::dynamic_truth_table tt(N_VARS);
+      std::unordered_set<std::string> reps_hex;
+      reps_hex.reserve(SAMPLE_COUNT/2);
 
-    std::ofstream ofs("data/npn_5var.txt");
-    if(!ofs){ std::cerr<<"ERROR opening data/npn_5var.txt\n"; return 1; }
+      for(uint64_t i=0;i<SAMPLE_COUNT;i++){
+        kitty::create_random(tt,SAMPLE_SEED+i);  // reproducible class list for resume
+        auto canon=kitty::exact_npn_canonization(tt);
+        reps_hex.insert(kitty::to_hex(std::get<0>(canon)));
+        if(((i+1)%PROGRESS_EVERY)==0)
+          std::cerr<<"[NPN] processed "<<(i+1)<<"/"<<SAMPLE_COUNT
+                   <<" | reps so far: "<<reps_hex.size()<<"\n";
+      }
 
-    uint32_t printed=0;
-    for(const auto& hex:reps_sorted){
-      if(printed>=MAX_SYNTH) break;
-      std::string bits32=hex_to_32_bits(hex);
-      kitty::dynamic_truth_table tt5(N_VARS);
-      set_tt_from_bits(tt5,bits32);
+      reps_sorted.assign(reps_hex.begin(),reps_hex.end());
+      std::sort(reps_sorted.begin(),reps_sorted.end());
+    }
 
-      auto s0=std::chrono::steady_clock::now();
-      auto net=synthesize_maj5_from_tt_5(tt5);
-      auto s1=std::chrono::steady_clock::now();
-      double secs=std::chrono::duration<double>(s1-s0).count();
+    if(max_classes>0&&max_classes<reps_sorted.size()) reps_sorted.resize(max_classes);
 
-      std::string class_bits=class_bits_from_tt(tt5);
+    std::vector<uint64_t> words;
+    words.reserve(reps_sorted.size());
+    for(const auto& hex:reps_sorted) words.push_back(std::stoull(hex,nullptr,16));
 
-      ofs<<"CLASS "<<class_bits<<"\n"<<net.to_text();
-      ofs<<"TIME "<<secs<<"\n---\n";
+    // Exact synthesis per class, SOP construction when it gives up
+    auto synthesize=[&](size_t i){
+      ClassResult r;
+      MAJ5Net net;
+      MAJ5ExactResult ex;
+      if(use_exact) ex=synthesizeMAJ5Exact(words[i],N_VARS,exact_ps);
+      if(use_exact&&ex.status==MAJ5ExactStatus::SUCCESS){
+        net=maj5net_from_chain(ex.chain);
+        r.optimal=true;
+      }else{
+        kitty::dynamic_truth_table tt5(N_VARS);
+        set_tt_from_bits(tt5,hex_to_32_bits(reps_sorted[i]));
+        net=synthesize_maj5_from_tt_5(tt5);
+      }
+      r.success=true;
+      r.chain=chain_from_maj5net(net);
+      return r;
+    };
 
-      printed++;
+    std::ofstream ofs;
+    if(write_text){
+      ofs.open("data/npn_5var.txt");
+      if(!ofs){ std::cerr<<"ERROR opening data/npn_5var.txt\n"; return 1; }
     }
-    std::cerr<<"Completed n=5, wrote "<<printed<<" classes\n";
+    std::vector<std::pair<uint64_t,MAJ5Chain>> database;
+    database.reserve(reps_sorted.size());
+    uint32_t invalid=0;
+    auto on_result=[&](size_t i,const ClassResult& r){
+      if(r.chain.simulate()!=words[i]){
+        std::cerr<<"ERROR: network for class "<<reps_sorted[i]<<" does not match\n";
+        invalid++;
+        return;
+      }
+      database.emplace_back(words[i],r.chain);
+      if(write_text){
+        ofs<<"CLASS "<<Utils::formatBinary(words[i],32)<<"\n"<<r.chain.toText();
+        ofs<<"TIME "<<r.seconds<<"\n---\n";
+      }
+    };
+
+    ClassDriverParams ps;
+    ps.num_threads=num_threads;
+    ps.checkpoint_path=CHECKPOINT_PATH;
+    ps.progress_seconds=PROGRESS_SECONDS;
+    ClassDriverStats stats=runClassDriver(words,N_VARS,5,synthesize,on_result,ps);
+
+    NPNDatabase::write("data/npn_5var.db",N_VARS,5,std::move(database));
+    std::remove(CHECKPOINT_PATH);
+    std::cerr<<"Completed n=5, wrote "<<(stats.success-invalid)<<" classes ("<<stats.optimal<<" exact, "
+             <<invalid<<" invalid, "<<stats.resumed<<" resumed) in "<<stats.wall_seconds<<"s, "
+             <<stats.synth_seconds<<"s synthesis time\n";
+    std::cerr<<"Size distribution:\n";
+    for(const auto& [sz,count]:stats.size_hist) std::cerr<<"  "<<sz<<" gates: "<<count<<" classes\n";
     return 0;
   }catch(const std::exception& e){
     std::cerr<<"FATAL: "<<e.what()<<"\n"; return 1;
@@ -0,0 +1,253 @@
+#include "class_driver.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+double secondsSince(clock_type::time_point t) {
+  return std::chrono::duration<double>(clock_type::now() - t).count();
+}
+
+// ==========================================================
+// Journal
+// ==========================================================
+// header, then one record per class in class order:
+//   function, seconds, flags, num_words, words (output literal, fanins)
+// A record cut short by a crash is dropped on resume.
+constexpr char kMagic[8] = {'N', 'P', 'N', 'C', 'K', 'P', 'T', 0};
+constexpr uint32_t kVersion = 1;
+
+struct JournalHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t num_vars;
+  uint32_t arity;
+  uint32_t num_classes;
+  uint64_t classes_hash;
+};
+
+struct RecordHeader {
+  uint64_t function;
+  double seconds;
+  uint32_t flags;
+  uint32_t num_words;
+};
+
+constexpr uint32_t kSuccess = 1;
+constexpr uint32_t kOptimal = 2;
+
+uint64_t hashClasses(const std::vector<uint64_t>& classes) {
+  uint64_t h = 0xcbf29ce484222325ULL;   // FNV-1a over the words
+  for (uint64_t w : classes) {
+    h ^= w;
+    h *= 0x100000001b3ULL;
+  }
+  return h;
+}
+
+JournalHeader makeHeader(const std::vector<uint64_t>& classes, int n_vars, int arity) {
+  JournalHeader h{};
+  std::memcpy(h.magic, kMagic, sizeof(kMagic));
+  h.version = kVersion;
+  h.num_vars = n_vars;
+  h.arity = arity;
+  h.num_classes = (uint32_t)classes.size();
+  h.classes_hash = hashClasses(classes);
+  return h;
+}
+
+// Reads the complete records of an existing journal into results and
+// returns the byte length they cover (0 if there is no journal)
+size_t replayJournal(const std::string& path, const JournalHeader& expected,
+                     const std::vector<uint64_t>& classes, int n_vars, int arity,
+                     std::vector<ClassResult>& results) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) return 0;
+  JournalHeader h{};
+  if (!in.read(reinterpret_cast<char*>(&h), sizeof(h))) return 0;
+  if (std::memcmp(&h, &expected, sizeof(h)) != 0)
+    throw std::runtime_error("Checkpoint " + path + " belongs to a different run; delete it to start over");
+
+  size_t valid = sizeof(h);
+  RecordHeader rec{};
+  while (results.size() < classes.size() && in.read(reinterpret_cast<char*>(&rec), sizeof(rec))) {
+    if (rec.function != classes[results.size()]) break;
+    ClassResult r;
+    r.success = (rec.flags & kSuccess) != 0;
+    r.optimal = (rec.flags & kOptimal) != 0;
+    r.seconds = rec.seconds;
+    std::vector<uint32_t> words(rec.num_words);
+    if (!in.read(reinterpret_cast<char*>(words.data()), sizeof(uint32_t) * words.size())) break;
+    if (r.success && !decodeChainRecord(words.data(), words.data() + words.size(), n_vars, arity, r.chain)) break;
+    results.push_back(std::move(r));
+    valid += sizeof(rec) + sizeof(uint32_t) * words.size();
+  }
+  return valid;
+}
+
+void appendRecord(std::ofstream& out, uint64_t function, int arity, const ClassResult& r) {
+  std::vector<uint32_t> words;
+  if (r.success && !encodeChainRecord(r.chain, arity, words))
+    throw std::runtime_error("Network does not match the arity of the checkpoint");
+  RecordHeader rec{};
+  rec.function = function;
+  rec.seconds = r.seconds;
+  rec.flags = (r.success ? kSuccess : 0u) | (r.optimal ? kOptimal : 0u);
+  rec.num_words = (uint32_t)words.size();
+  out.write(reinterpret_cast<const char*>(&rec), sizeof(rec));
+  out.write(reinterpret_cast<const char*>(words.data()), sizeof(uint32_t) * words.size());
+}
+
+// ==========================================================
+// Per-worker statistics
+// ==========================================================
+// Each worker only touches its own slot; the slots are merged after join.
+struct alignas(64) WorkerStats {
+  size_t success{0};
+  size_t fail{0};
+  size_t optimal{0};
+  double synth_seconds{0.0};
+  std::map<size_t, size_t> size_hist;
+
+  void add(const ClassResult& r) {
+    synth_seconds += r.seconds;
+    if (r.success) {
+      ++success;
+      if (r.optimal) ++optimal;
+      ++size_hist[r.chain.numGates()];
+    } else {
+      ++fail;
+    }
+  }
+};
+
+} // namespace
+
+// ==========================================================
+// Driver
+// ==========================================================
+ClassDriverStats runClassDriver(
+    const std::vector<uint64_t>& classes, int n_vars, int arity,
+    const std::function<ClassResult(size_t)>& synthesize,
+    const std::function<void(size_t, const ClassResult&)>& on_result,
+    const ClassDriverParams& ps) {
+  const auto start = clock_type::now();
+  const size_t total = classes.size();
+  const unsigned num_threads = std::max(1u, ps.num_threads);
+
+  // Replay finished classes, then keep appending to the same journal
+  std::vector<ClassResult> replayed;
+  std::ofstream journal;
+  if (!ps.checkpoint_path.empty()) {
+    const JournalHeader header = makeHeader(classes, n_vars, arity);
+    const size_t valid = replayJournal(ps.checkpoint_path, header, classes, n_vars, arity, replayed);
+    if (valid > 0) {
+      std::filesystem::resize_file(ps.checkpoint_path, valid);
+      journal.open(ps.checkpoint_path, std::ios::binary | std::ios::app);
+    } else {
+      journal.open(ps.checkpoint_path, std::ios::binary | std::ios::trunc);
+      journal.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+    if (!journal) throw std::runtime_error("Cannot open checkpoint " + ps.checkpoint_path);
+  }
+
+  std::vector<WorkerStats> stats(num_threads + 1);   // last slot: replayed classes
+  const size_t first = replayed.size();
+  for (size_t i = 0; i < first; ++i) {
+    stats[num_threads].add(replayed[i]);
+    on_result(i, replayed[i]);
+  }
+  replayed.clear();
+  if (first > 0) {
+    std::cerr << "[" << ps.label << "] resumed " << first << "/" << total
+              << " classes from " << ps.checkpoint_path << "\n";
+  }
+
+  // Workers claim the next unfinished class from a shared cursor; finished
+  // results wait in their slot until everything before them is out
+  std::vector<ClassResult> results(total);
+  std::unique_ptr<std::atomic<bool>[]> ready(new std::atomic<bool>[total]);
+  for (size_t i = 0; i < total; ++i) ready[i].store(false, std::memory_order_relaxed);
+  std::atomic<size_t> next{first};
+  std::atomic<size_t> done{first};
+  std::atomic<bool> abort{false};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+
+  auto worker = [&](WorkerStats& ws) {
+    for (size_t i = next.fetch_add(1); i < total && !abort.load(); i = next.fetch_add(1)) {
+      try {
+        const auto t0 = clock_type::now();
+        ClassResult r = synthesize(i);
+        r.seconds = secondsSince(t0);
+        ws.add(r);
+        results[i] = std::move(r);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!error) error = std::current_exception();
+        abort.store(true);
+        return;
+      }
+      ready[i].store(true, std::memory_order_release);
+      done.fetch_add(1, std::memory_order_relaxed);
+    }
+  };
+  std::vector<std::thread> pool;
+  for (unsigned t = 0; t < num_threads; ++t) pool.emplace_back(worker, std::ref(stats[t]));
+
+  // Stream the ready prefix in order; report and flush periodically
+  auto last_progress = clock_type::now(), last_flush = clock_type::now();
+  size_t emitted = first;
+  while (emitted < total && !abort.load()) {
+    bool progressed = false;
+    while (emitted < total && ready[emitted].load(std::memory_order_acquire)) {
+      if (journal.is_open()) appendRecord(journal, classes[emitted], arity, results[emitted]);
+      on_result(emitted, results[emitted]);
+      results[emitted] = ClassResult{};
+      ++emitted;
+      progressed = true;
+    }
+    if (journal.is_open() && secondsSince(last_flush) >= ps.checkpoint_seconds) {
+      journal.flush();
+      last_flush = clock_type::now();
+    }
+    if (secondsSince(last_progress) >= ps.progress_seconds || emitted == total) {
+      const double secs = secondsSince(start);
+      const size_t d = done.load(std::memory_order_relaxed);
+      std::cerr << "[" << ps.label << "] " << d << "/" << total
+                << " | written: " << emitted
+                << " | " << ((d - first) / std::max(secs, 1e-9)) << " classes/s"
+                << " | elapsed: " << secs << "s\n";
+      last_progress = clock_type::now();
+    }
+    if (!progressed) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  for (auto& th : pool) th.join();
+  if (journal.is_open()) journal.flush();
+  if (error) std::rethrow_exception(error);
+
+  ClassDriverStats out;
+  out.resumed = first;
+  for (const auto& ws : stats) {
+    out.success += ws.success;
+    out.fail += ws.fail;
+    out.optimal += ws.optimal;
+    out.synth_seconds += ws.synth_seconds;
+    for (const auto& [sz, count] : ws.size_hist) out.size_hist[sz] += count;
+  }
+  out.wall_seconds = secondsSince(start);
+  return out;
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "npn_database.h"
+
+// ---------------- Class synthesis driver ----------------
+// Runs one synthesis job per NPN class on a pool of worker threads and
+// hands the results back in class order, however the workers finish.
+//
+// With a checkpoint path, every result is appended to a journal as soon as
+// it is next in order. The journal is flushed every checkpoint_seconds, so an
+// interrupted run that is restarted with the same class list replays the
+// journal and only synthesizes the classes that are missing. The caller
+// deletes the journal once its final output is written.
+
+struct ClassResult {
+  bool success{false};
+  bool optimal{false};   // chain is proven minimum size
+  MAJ5Chain chain;       // valid iff success
+  double seconds{0.0};   // synthesis time, measured by the driver
+};
+
+struct ClassDriverParams {
+  unsigned num_threads{1};
+  std::string checkpoint_path;       // empty: no journal
+  double checkpoint_seconds{30.0};   // journal flush interval
+  double progress_seconds{5.0};      // progress line interval
+  std::string label{"SYN"};          // progress line prefix
+};
+
+struct ClassDriverStats {
+  size_t success{0};
+  size_t fail{0};
+  size_t optimal{0};
+  size_t resumed{0};                 // classes replayed from the journal
+  double synth_seconds{0.0};         // sum of per-class synthesis times
+  double wall_seconds{0.0};
+  std::map<size_t, size_t> size_hist;   // gates -> successful classes
+};
+
+// synthesize(i) builds the network for classes[i] (called concurrently from
+// the workers); on_result(i, result) is called on the calling thread for
+// i = 0, 1, 2, ... in order, including replayed classes. n_vars and arity
+// identify the run in the journal. Throws std::runtime_error if the journal
+// belongs to a different class list; exceptions from synthesize stop the
+// run and are rethrown.
+ClassDriverStats runClassDriver(
+    const std::vector<uint64_t>& classes, int n_vars, int arity,
+    const std::function<ClassResult(size_t)>& synthesize,
+    const std::function<void(size_t, const ClassResult&)>& on_result,
+    const ClassDriverParams& ps);
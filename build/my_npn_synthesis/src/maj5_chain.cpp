@@ -0,0 +1,75 @@
+#include "maj5_chain.h"
+#include "truth_table.h"
+
+#include <algorithm>
+
+uint32_t MAJ5Chain::addGate(std::array<uint32_t, 5> fanins) {
+  std::sort(fanins.begin(), fanins.end());
+  gates.push_back(fanins);
+  return gateLit((int)gates.size() - 1);
+}
+
+bool MAJ5Chain::maj3Fanins(size_t j, std::array<uint32_t, 3>& fanins) const {
+  // sorted fanins: drop the first 0 (at the front) and the first 1
+  const auto& g = gates[j];
+  const auto one = std::find(g.begin(), g.end(), 1u);
+  if (g[0] != 0u || one == g.end()) return false;
+  std::copy(g.begin() + 1, one, fanins.begin());
+  std::copy(one + 1, g.end(), fanins.begin() + (one - g.begin() - 1));
+  return true;
+}
+
+bool MAJ5Chain::isMaj3() const {
+  std::array<uint32_t, 3> fanins;
+  for (size_t j = 0; j < gates.size(); ++j)
+    if (!maj3Fanins(j, fanins)) return false;
+  return true;
+}
+
+// ==========================================================
+// Simulation
+// ==========================================================
+uint64_t MAJ5Chain::simulate() const {
+  const uint64_t mask = TruthTable::packedMask(num_inputs);
+  std::vector<uint64_t> values(2 + 2 * (num_inputs + gates.size()));
+  auto set = [&](size_t base, uint64_t v) { values[base] = v; values[base + 1] = ~v & mask; };
+
+  set(0, 0);
+  for (int i = 0; i < num_inputs; ++i) {
+    set(inputLit(i), truth_table_detail::kProjections[i] & mask);
+  }
+  for (size_t j = 0; j < gates.size(); ++j) {
+    const auto& g = gates[j];
+    set(gateLit(j), g[0] == 0u && g[1] == 1u
+                        ? TruthTable::majority3(values[g[2]], values[g[3]], values[g[4]])
+                        : TruthTable::majority5(values[g[0]], values[g[1]], values[g[2]],
+                                                values[g[3]], values[g[4]]));
+  }
+  return values[output];
+}
+
+std::string MAJ5Chain::toText() const {
+  auto name = [&](uint32_t lit) {
+    if (lit < 2) return std::string(lit ? "1" : "0");
+    const uint32_t idx = (lit - 2) / 2;
+    std::string s = idx < (uint32_t)num_inputs ? "x" + std::to_string(idx) : "G" + std::to_string(idx - num_inputs);
+    if (lit & 1) s += "'";
+    return s;
+  };
+  // MIGs are printed with three fanins per gate
+  const bool maj3 = isMaj3();
+  std::string out;
+  for (size_t j = 0; j < gates.size(); ++j) {
+    std::array<uint32_t, 3> abc;
+    if (maj3) {
+      maj3Fanins(j, abc);
+      out += "G" + std::to_string(j) + " = MAJ(" + name(abc[0]) + ", " + name(abc[1]) + ", " + name(abc[2]);
+    } else {
+      out += "G" + std::to_string(j) + " = MAJ5(";
+      for (int k = 0; k < 5; ++k) out += (k ? ", " : "") + name(gates[j][k]);
+    }
+    out += ")\n";
+  }
+  out += "OUTPUT = " + name(output) + "\n";
+  return out;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// ---------------- MAJ5Chain ----------------
+// A network of majority-of-five gates over packed truth tables (n <= 6,
+// input i is bit i of the minterm index, as in kitty).
+//
+// Fanin literals: 0 = const0, 1 = const1, 2 + 2*i + c = input i,
+// 2 + 2*n + 2*j + c = gate j, where c = 1 marks a complemented fanin.
+// Gates only read earlier gates; fanins are stored in non-decreasing order.
+//
+// Majority-of-three gates are stored as MAJ(a, b, c) = MAJ5(0, 1, a, b, c),
+// so MIGs use the same type; a gate is such a gate iff it reads both 0 and 1.
+struct MAJ5Chain {
+  int num_inputs{0};
+  std::vector<std::array<uint32_t, 5>> gates;
+  uint32_t output{0};   // literal driving the output
+
+  static uint32_t constLit(bool value) { return value ? 1u : 0u; }
+  uint32_t inputLit(int i, bool inv = false) const { return 2u + 2u * i + (inv ? 1u : 0u); }
+  uint32_t gateLit(int j, bool inv = false) const { return 2u + 2u * (num_inputs + j) + (inv ? 1u : 0u); }
+  size_t numGates() const { return gates.size(); }
+
+  // Appends a gate (fanins are sorted) and returns its literal
+  uint32_t addGate(std::array<uint32_t, 5> fanins);
+  uint32_t addMaj3(uint32_t a, uint32_t b, uint32_t c) { return addGate({0u, 1u, a, b, c}); }
+
+  // Fanins a, b, c of gate j if it is a MAJ(a, b, c) gate
+  bool maj3Fanins(size_t j, std::array<uint32_t, 3>& fanins) const;
+
+  // Whether every gate is a MAJ(a, b, c) gate
+  bool isMaj3() const;
+
+  // Whole truth table of the output in one pass over the gates
+  uint64_t simulate() const;
+
+  // "G0 = MAJ5(x0, x3', G1, ...)" lines followed by "OUTPUT = Gk"
+  std::string toText() const;
+};
@@ -0,0 +1,217 @@
+#include "maj5_exact.h"
+#include "truth_table.h"
+
+#include <chrono>
+#include <stdexcept>
+
+#include <bill/sat/interface/common.hpp>
+#include <bill/sat/interface/glucose.hpp>
+
+// ==========================================================
+// SAT encoding for a fixed number of gates
+// ==========================================================
+namespace {
+
+using Solver = bill::solver<bill::solvers::glucose_41>;
+using Lit = bill::lit_type;
+
+Lit pos(uint32_t var) { return Lit(var, bill::positive_polarity); }
+Lit neg(uint32_t var) { return Lit(var, bill::negative_polarity); }
+
+// Variables for step i:
+//   sel(i, k, l)  slot k of step i reads fanin literal l
+//   arg(i, k, t)  value of slot k at minterm t
+//   out(i, t)     value of step i at minterm t
+// Symmetry breaking: slots are sorted by literal (MAJ5 is commutative), no
+// literal appears three times (the gate would be that literal), and no
+// non-constant literal appears together with its complement (the pair
+// cancels; MAJ5(0, 1, ...) covers that case).  The output is never
+// complemented because MAJ5 is self-dual, and every step but the last must
+// feed a later step.
+class MAJ5Encoder {
+public:
+  MAJ5Encoder(Solver& solver, uint64_t tt, int n_vars, int num_gates)
+      : solver(solver), tt(tt), n(n_vars), r(num_gates), rows(1 << n_vars) {}
+
+  void encode() {
+    sel_base.resize(r);
+    arg_base.resize(r);
+    out_base.resize(r);
+    uint32_t next = 0;
+    for (int i = 0; i < r; ++i) {
+      sel_base[i] = next; next += 5 * numLits(i);
+      arg_base[i] = next; next += 5 * rows;
+      out_base[i] = next; next += rows;
+    }
+    resume_var = next++;
+    solver.add_variables(next);
+
+    for (int i = 0; i < r; ++i) {
+      encodeSelection(i);
+      encodeSimulation(i);
+    }
+    for (int i = 0; i + 1 < r; ++i) {
+      std::vector<Lit> used;
+      for (int ip = i + 1; ip < r; ++ip)
+        for (int k = 0; k < 5; ++k)
+          for (int c = 0; c < 2; ++c) used.push_back(pos(sel(ip, k, gateLit(i) + c)));
+      solver.add_clause(used);
+    }
+    for (int t = 0; t < rows; ++t) {
+      solver.add_clause(((tt >> t) & 1) ? pos(out(r - 1, t)) : neg(out(r - 1, t)));
+    }
+  }
+
+  // bill returns the cached state for assumption-free calls after an
+  // undefined result, so resumed searches always pass this free literal
+  Lit resumeLiteral() const { return pos(resume_var); }
+
+  MAJ5Chain decode() const {
+    MAJ5Chain chain;
+    chain.num_inputs = n;
+    auto model = solver.get_model().model();
+    for (int i = 0; i < r; ++i) {
+      std::array<uint32_t, 5> g{};
+      for (int k = 0; k < 5; ++k)
+        for (uint32_t l = 0; l < numLits(i); ++l)
+          if (model[sel(i, k, l)] == bill::lbool_type::true_) g[k] = l;
+      chain.gates.push_back(g);
+    }
+    chain.output = chain.gateLit(r - 1);
+    return chain;
+  }
+
+private:
+  Solver& solver;
+  uint64_t tt;
+  int n, r, rows;
+  std::vector<uint32_t> sel_base, arg_base, out_base;
+  uint32_t resume_var{0};
+
+  uint32_t numLits(int i) const { return 2 + 2 * (n + i); }
+  uint32_t gateLit(int j) const { return 2 + 2 * (n + j); }
+  uint32_t sel(int i, int k, uint32_t l) const { return sel_base[i] + k * numLits(i) + l; }
+  uint32_t arg(int i, int k, int t) const { return arg_base[i] + k * rows + t; }
+  uint32_t out(int i, int t) const { return out_base[i] + t; }
+
+  void encodeSelection(int i) {
+    const uint32_t L = numLits(i);
+    for (int k = 0; k < 5; ++k) {
+      std::vector<Lit> alo;
+      for (uint32_t l = 0; l < L; ++l) alo.push_back(pos(sel(i, k, l)));
+      solver.add_clause(alo);
+      for (uint32_t l = 0; l < L; ++l)
+        for (uint32_t lp = l + 1; lp < L; ++lp)
+          solver.add_clause({neg(sel(i, k, l)), neg(sel(i, k, lp))});
+    }
+    for (int k = 0; k + 1 < 5; ++k) {
+      // slot k+1 reads l  =>  slot k reads some literal <= l
+      for (uint32_t l = 0; l < L; ++l) {
+        std::vector<Lit> cl{neg(sel(i, k + 1, l))};
+        for (uint32_t lp = 0; lp <= l; ++lp) cl.push_back(pos(sel(i, k, lp)));
+        solver.add_clause(cl);
+      }
+    }
+    for (uint32_t l = 0; l < L; ++l) {
+      for (int k = 0; k + 2 < 5; ++k) solver.add_clause({neg(sel(i, k, l)), neg(sel(i, k + 2, l))});
+    }
+    for (uint32_t l = 2; l < L; l += 2) {
+      for (int k = 0; k < 5; ++k)
+        for (int kp = k + 1; kp < 5; ++kp) solver.add_clause({neg(sel(i, k, l)), neg(sel(i, kp, l + 1))});
+    }
+  }
+
+  void encodeSimulation(int i) {
+    const uint32_t L = numLits(i);
+    for (int t = 0; t < rows; ++t) {
+      for (int k = 0; k < 5; ++k) {
+        const Lit a = pos(arg(i, k, t));
+        for (uint32_t l = 0; l < L; ++l) {
+          const Lit s = neg(sel(i, k, l));
+          const bool inv = l & 1;
+          if (l < 2 + 2 * (uint32_t)n) {
+            // constant or primary input: the value is known
+            const bool value = (l < 2 ? false : ((t >> ((l - 2) / 2)) & 1)) != inv;
+            solver.add_clause({s, value ? a : ~a});
+          } else {
+            const Lit x = pos(out((l - 2 - 2 * n) / 2, t));
+            solver.add_clause({s, ~x, inv ? ~a : a});
+            solver.add_clause({s, x, inv ? a : ~a});
+          }
+        }
+      }
+      // out = at least three of the five slots
+      const Lit o = pos(out(i, t));
+      for (int k0 = 0; k0 < 5; ++k0)
+        for (int k1 = k0 + 1; k1 < 5; ++k1)
+          for (int k2 = k1 + 1; k2 < 5; ++k2) {
+            const Lit a0 = pos(arg(i, k0, t)), a1 = pos(arg(i, k1, t)), a2 = pos(arg(i, k2, t));
+            solver.add_clause({~a0, ~a1, ~a2, o});
+            solver.add_clause({a0, a1, a2, ~o});
+          }
+    }
+  }
+};
+
+// Functions that need no gate: constants and (complemented) inputs
+bool trivialChain(uint64_t tt, int n_vars, MAJ5Chain& chain) {
+  const uint64_t mask = TruthTable::packedMask(n_vars);
+  chain.num_inputs = n_vars;
+  if (tt == 0 || tt == mask) { chain.output = MAJ5Chain::constLit(tt != 0); return true; }
+  for (int i = 0; i < n_vars; ++i) {
+    const uint64_t proj = truth_table_detail::kProjections[i] & mask;
+    if (tt == proj || tt == (~proj & mask)) { chain.output = chain.inputLit(i, tt != proj); return true; }
+  }
+  return false;
+}
+
+} // namespace
+
+// ==========================================================
+// Public API
+// ==========================================================
+MAJ5ExactResult synthesizeMAJ5Exact(uint64_t tt, int n_vars, const MAJ5ExactParams& ps) {
+  using clock = std::chrono::steady_clock;
+  const auto start = clock::now();
+  auto elapsed = [&] { return std::chrono::duration<double>(clock::now() - start).count(); };
+
+  MAJ5ExactResult res;
+  if (n_vars < 0 || n_vars > TruthTable::kMaxPackedVars)
+    throw std::invalid_argument("MAJ5 exact synthesis supports at most 6 inputs");
+  tt &= TruthTable::packedMask(n_vars);
+
+  if (trivialChain(tt, n_vars, res.chain)) {
+    res.status = MAJ5ExactStatus::SUCCESS;
+    res.seconds = elapsed();
+    return res;
+  }
+
+  for (int r = 1; r <= ps.max_gates; ++r) {
+    Solver solver;
+    MAJ5Encoder enc(solver, tt, n_vars, r);
+    enc.encode();
+
+    bill::result::states state;
+    do {
+      ++res.solver_calls;
+      state = solver.solve({enc.resumeLiteral()}, ps.conflict_slice);
+      if (state == bill::result::states::undefined && elapsed() > ps.timeout_seconds) {
+        res.status = MAJ5ExactStatus::TIMEOUT;
+        res.seconds = elapsed();
+        return res;
+      }
+    } while (state == bill::result::states::undefined);
+
+    if (state == bill::result::states::satisfiable) {
+      res.chain = enc.decode();
+      if (res.chain.simulate() != tt)
+        throw std::logic_error("MAJ5 exact synthesis produced a wrong network");
+      res.status = MAJ5ExactStatus::SUCCESS;
+      res.seconds = elapsed();
+      return res;
+    }
+  }
+  res.status = MAJ5ExactStatus::GATE_LIMIT;
+  res.seconds = elapsed();
+  return res;
+}
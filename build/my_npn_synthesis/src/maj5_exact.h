@@ -0,0 +1,26 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "maj5_chain.h"
+
+// ---------------- Exact synthesis ----------------
+struct MAJ5ExactParams {
+  int max_gates{8};                 // give up above this many gates
+  double timeout_seconds{60.0};     // per function, across all gate counts
+  uint32_t conflict_slice{10000};   // conflicts between timeout checks
+};
+
+enum class MAJ5ExactStatus { SUCCESS, TIMEOUT, GATE_LIMIT };
+
+struct MAJ5ExactResult {
+  MAJ5ExactStatus status{MAJ5ExactStatus::TIMEOUT};
+  MAJ5Chain chain;        // valid iff status == SUCCESS
+  double seconds{0.0};
+  int solver_calls{0};
+};
+
+// Minimum-size MAJ5 network for tt, found by raising the gate count from 0
+// until the SAT encoding becomes satisfiable.
+MAJ5ExactResult synthesizeMAJ5Exact(uint64_t tt, int n_vars, const MAJ5ExactParams& ps = {});
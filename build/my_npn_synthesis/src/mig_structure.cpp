@@ -1,4 +1,5 @@
 #include "mig_structure.h"
+#include "truth_table.h"
 #include <algorithm>
 #include <stdexcept>
 
@@ -74,20 +75,86 @@ int MIG::evaluate(const std::vector<int>& input_values) const {
   return output_inverted ? (out ^ 1) : out;
 }
 
-std::string MIG::getTruthTable() const {
-  int rows = 1 << n_vars;
-  std::string tt(rows, '0');
-  for (int i = 0; i < rows; i++) {
-    std::vector<int> inputs(n_vars);
+bool MIG::isTopological() const {
+  for (const auto& g : gates) {
+    for (const MIGInput* in : {&g.a, &g.b, &g.c}) {
+      if (in->kind == MIGInput::Kind::NODE && (in->index < 0 || in->index >= g.id)) return false;
+    }
+  }
+  return output_gate >= 0 && output_gate < size();
+}
+
+std::vector<uint64_t> MIG::simulate() const {
+  if (!isTopological()) return simulateByMinterm();
+
+  const size_t rows = size_t(1) << n_vars;
+  const size_t num_words = std::max<size_t>(1, rows / 64);
+  const uint64_t mask = TruthTable::packedMask(std::min(n_vars, TruthTable::kMaxPackedVars));
+
+  // Input projections: x_j is bit (n_vars - 1 - j) of the row index
+  std::vector<uint64_t> pis(size_t(n_vars) * num_words);
+  for (int j = 0; j < n_vars; ++j) {
+    const int v = n_vars - 1 - j;
+    for (size_t w = 0; w < num_words; ++w) {
+      pis[j * num_words + w] = v < 6 ? (truth_table_detail::kProjections[v] & mask)
+                                     : (((w >> (v - 6)) & 1) ? ~0ULL : 0ULL);
+    }
+  }
+
+  std::vector<uint64_t> values(gates.size() * num_words);
+  auto word = [&](const MIGInput& in, size_t w) -> uint64_t {
+    uint64_t x = 0;
+    switch (in.kind) {
+      case MIGInput::Kind::PI:     x = pis[in.index * num_words + w]; break;
+      case MIGInput::Kind::CONST0: x = 0; break;
+      case MIGInput::Kind::CONST1: x = mask; break;
+      case MIGInput::Kind::NODE:   x = values[in.index * num_words + w]; break;
+    }
+    return in.inverted ? (~x & mask) : x;
+  };
+
+  for (const auto& g : gates) {
+    for (size_t w = 0; w < num_words; ++w) {
+      values[g.id * num_words + w] = TruthTable::majority3(word(g.a, w), word(g.b, w), word(g.c, w));
+    }
+  }
+
+  std::vector<uint64_t> out(values.begin() + output_gate * num_words,
+                            values.begin() + (output_gate + 1) * num_words);
+  if (output_inverted) {
+    for (auto& w : out) w = ~w & mask;
+  }
+  return out;
+}
+
+std::vector<uint64_t> MIG::simulateByMinterm() const {
+  const size_t rows = size_t(1) << n_vars;
+  std::vector<uint64_t> out(std::max<size_t>(1, rows / 64), 0);
+  std::vector<int> inputs(n_vars);
+  for (size_t i = 0; i < rows; i++) {
     for (int j = 0; j < n_vars; j++)
-      inputs[j] = (i >> j) & 1;
-    tt[i] = evaluate(inputs) ? '1' : '0';
+      inputs[j] = (i >> (n_vars - 1 - j)) & 1;
+    if (evaluate(inputs)) out[i / 64] |= 1ULL << (i % 64);
+  }
+  return out;
+}
+
+std::string MIG::getTruthTable() const {
+  const auto words = simulate();
+  std::string tt(size_t(1) << n_vars, '0');
+  for (size_t i = 0; i < tt.size(); i++) {
+    if ((words[i / 64] >> (i % 64)) & 1) tt[i] = '1';
   }
   return tt;
 }
 
 bool MIG::validate(const std::string& tt) const {
-  return getTruthTable() == tt;
+  if (tt.size() != (size_t(1) << n_vars)) return false;
+  const auto words = simulate();
+  for (size_t i = 0; i < tt.size(); i++) {
+    if (((words[i / 64] >> (i % 64)) & 1) != uint64_t(tt[i] == '1')) return false;
+  }
+  return true;
 }
 
 std::string MIG::toText() const {
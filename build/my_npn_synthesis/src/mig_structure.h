@@ -2,6 +2,7 @@
 #include <vector>
 #include <string>
 #include <sstream>
+#include <cstdint>
 
 // ---------------- MIGInput ----------------
 struct MIGInput {
@@ -41,8 +42,19 @@ public:
   int size() const;
   int depth() const;
 
+  // Structure access
+  int numInputs() const { return n_vars; }
+  const std::vector<MIGGate>& getGates() const { return gates; }
+  int getOutputGate() const { return output_gate; }
+  bool isOutputInverted() const { return output_inverted; }
+
   // Evaluate
   int evaluate(const std::vector<int>& input_values) const;
+
+  // Whole output function as packed words (bit i = row i, input x0 is the
+  // MSB of the row index as in TruthTable), computed for every gate in one
+  // topological pass with word-wide majority
+  std::vector<uint64_t> simulate() const;
   std::string getTruthTable() const;
 
   // Check against truth table
@@ -60,4 +72,8 @@ private:
   int evalInput(const MIGInput& in,
                 const std::vector<int>& inputs,
                 std::vector<int>& memo) const;
+
+  // Per-minterm fallback for gates that read later gates
+  std::vector<uint64_t> simulateByMinterm() const;
+  bool isTopological() const;
 };
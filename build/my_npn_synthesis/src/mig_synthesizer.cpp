@@ -1,13 +1,14 @@
 #include "mig_synthesizer.h"
 #include "mig_structure.h"
+#include "strash_table.h"
 
 #include <algorithm>
 #include <array>
 #include <cctype>
+#include <cstdint>
 #include <memory>
 #include <stdexcept>
 #include <string>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -21,35 +22,23 @@ int deduce_n(std::size_t len) {
   return (p == len) ? n : -1;
 }
 
-// Encodes a MIGInput to a stable string for hashing
-std::string encode_input(const MIGInput& in) {
-  char k = '?';
-  switch (in.kind) {
-    case MIGInput::Kind::PI:     k = 'P'; break;
-    case MIGInput::Kind::CONST0: k = '0'; break;
-    case MIGInput::Kind::CONST1: k = '1'; break;
-    case MIGInput::Kind::NODE:   k = 'N'; break;
-  }
-  return std::string(1, k) + (in.inverted ? "'" : "") + "#" + std::to_string(in.index);
-}
-
-// Canonical sort key for commutative majority(a,b,c)
-struct InKey {
-  int kind_rank;      // CONST0<CONST1<PI<NODE
-  int base_index;     // index
-  bool inverted;      // false < true
-  std::string full;   // encoded (for uniqueness)
-};
+// Packs a MIGInput into a 21-bit literal for structural hashing:
+// bits 19-20 kind rank (CONST0<CONST1<PI<NODE), bits 1-18 index, bit 0
+// inversion. Sorting packed literals orders inputs by (kind, index, inv).
+constexpr int kLitBits = 21;
+constexpr int kMaxIndex = (1 << (kLitBits - 3)) - 1;
 
-InKey key_of(const MIGInput& in) {
-  int kr = 0;
+uint32_t pack_input(const MIGInput& in) {
+  uint32_t kr = 0;
   switch (in.kind) {
     case MIGInput::Kind::CONST0: kr = 0; break;
     case MIGInput::Kind::CONST1: kr = 1; break;
     case MIGInput::Kind::PI:     kr = 2; break;
     case MIGInput::Kind::NODE:   kr = 3; break;
   }
-  return {kr, in.index, in.inverted, encode_input(in)};
+  if (in.index < 0 || in.index > kMaxIndex)
+    throw std::length_error("MIG input index exceeds strash literal range");
+  return (kr << (kLitBits - 2)) | (uint32_t(in.index) << 1) | (in.inverted ? 1u : 0u);
 }
 
 bool same_base(const MIGInput& a, const MIGInput& b) {
@@ -125,8 +114,8 @@ private:
   // Reusable literal/const handles
   MIGInput c0, c1;
 
-  // Structural hashing: canonical key → node id
-  std::unordered_map<std::string, int> maj_cache;
+  // Structural hashing: packed canonical fanins → node id
+  StrashTable maj_cache;
 
   // ---------- Boolean ops via majority ----------
   MIGInput and2(const MIGInput& a, const MIGInput& b) {
@@ -180,23 +169,19 @@ private:
     if (complementary(b,c)) return a;
 
     // Canonicalize order for hashing (commutative)
-    std::array<InKey,3> arr{ key_of(a), key_of(b), key_of(c) };
-    std::sort(arr.begin(), arr.end(), [](const InKey& x, const InKey& y){
-      if (x.kind_rank != y.kind_rank) return x.kind_rank < y.kind_rank;
-      if (x.base_index != y.base_index) return x.base_index < y.base_index;
-      if (x.inverted  != y.inverted )   return x.inverted  < y.inverted;
-      return x.full < y.full;
-    });
-
-    const std::string key = "MAJ(" + arr[0].full + "," + arr[1].full + "," + arr[2].full + ")";
-    auto it = maj_cache.find(key);
-    if (it != maj_cache.end()) {
-      return MIG::NODE(it->second, /*inv=*/false);
+    std::array<uint32_t,3> lits{ pack_input(a), pack_input(b), pack_input(c) };
+    std::sort(lits.begin(), lits.end());
+
+    StrashKey key;
+    key.lo = uint64_t(lits[0]) | (uint64_t(lits[1]) << kLitBits) | (uint64_t(lits[2]) << (2 * kLitBits));
+    int gid = maj_cache.find(key);
+    if (gid >= 0) {
+      return MIG::NODE(gid, /*inv=*/false);
     }
 
     // Create real node
-    int gid = mig->addGate(a, b, c);
-    maj_cache.emplace(key, gid);
+    gid = mig->addGate(a, b, c);
+    maj_cache.insert(key, gid);
     return MIG::NODE(gid, /*inv=*/false);
   }
 
@@ -3,9 +3,79 @@
 #include <algorithm>
 #include <numeric>
 #include <set>
+#include <unordered_set>
 #include <iostream>
 #include <chrono>
 
+namespace {
+
+// Transform sequences for the packed canonizer: `swaps` lists the adjacent
+// transpositions that walk all n! permutations (Steinhaus-Johnson-Trotter),
+// `flips` lists the input to negate at each step of the n-bit Gray code.
+struct NPNWalk {
+    std::vector<int> swaps;
+    std::vector<int> flips;
+};
+
+std::vector<int> adjacentSwapSequence(int n) {
+    if (n <= 1) return {};
+    std::vector<int> sub = adjacentSwapSequence(n - 1);
+    std::vector<int> swaps;
+    bool moving_left = true;  // largest element starts on the right
+    for (size_t block = 0; block <= sub.size(); ++block) {
+        for (int i = 0; i < n - 1; ++i) {
+            swaps.push_back(moving_left ? n - 2 - i : i);
+        }
+        if (block == sub.size()) break;
+        // Largest element parked at position 0 shifts the others by one
+        swaps.push_back(moving_left ? sub[block] + 1 : sub[block]);
+        moving_left = !moving_left;
+    }
+    return swaps;
+}
+
+const NPNWalk& npnWalk(int n_vars) {
+    static const std::vector<NPNWalk> walks = [] {
+        std::vector<NPNWalk> w(TruthTable::kMaxPackedVars + 1);
+        for (int n = 0; n <= TruthTable::kMaxPackedVars; ++n) {
+            w[n].swaps = adjacentSwapSequence(n);
+            for (uint32_t k = 1; k < (1u << n); ++k) {
+                int var = 0;
+                while (!((k >> var) & 1)) ++var;  // lowest set bit of k
+                w[n].flips.push_back(var);
+            }
+        }
+        return w;
+    }();
+    return walks[n_vars];
+}
+
+// Calls fn on all n!*2^(n+1) transforms of tt until it returns false. Every
+// permutation is one adjacent swap away from the previous one and every
+// negation pattern one input flip away, so each transform costs a handful of
+// word operations. Output negation and single flips come first, which lets
+// early-exit callers reject most functions within a few steps.
+template <typename Fn>
+bool walkNPNOrbit(uint64_t tt, int n_vars, Fn&& fn) {
+    const NPNWalk& walk = npnWalk(n_vars);
+    const uint64_t mask = TruthTable::packedMask(n_vars);
+
+    uint64_t permuted = tt;
+    for (size_t p = 0;; ++p) {
+        uint64_t negated = permuted;
+        for (size_t k = 0;; ++k) {
+            if (!fn(negated) || !fn(~negated & mask)) return false;
+            if (k == walk.flips.size()) break;
+            negated = TruthTable::flipVar(negated, walk.flips[k]);
+        }
+        if (p == walk.swaps.size()) break;
+        permuted = TruthTable::swapAdjacentVars(permuted, walk.swaps[p]);
+    }
+    return true;
+}
+
+} // namespace
+
 // ==========================================================
 // Apply input/output negations
 // ==========================================================
@@ -15,22 +85,14 @@ std::string NPNClassifier::applyNegationPattern(const std::string& tt,
     int n_vars = TruthTable::getNumVars(tt);
     int num_rows = 1 << n_vars;
     std::string new_tt(num_rows, '0');
-    
+
+    // Negating input j flips bit (n_vars - 1 - j) of the row index
+    int flip_bits = 0;
+    for (int j = 0; j < n_vars; ++j) {
+        if (neg_inputs[j]) flip_bits |= 1 << (n_vars - 1 - j);
+    }
     for (int i = 0; i < num_rows; ++i) {
-        std::vector<int> inputs(n_vars);
-        int temp = i;
-        for (int j = n_vars - 1; j >= 0; --j) {
-            inputs[j] = temp & 1;
-            temp >>= 1;
-        }
-        for (int j = 0; j < n_vars; ++j) {
-            if (neg_inputs[j]) inputs[j] = 1 - inputs[j];
-        }
-        int new_index = 0;
-        for (int j = 0; j < n_vars; ++j) {
-            new_index += inputs[j] * (1 << (n_vars - 1 - j));
-        }
-        int output_val = tt[new_index] - '0';
+        int output_val = tt[i ^ flip_bits] - '0';
         if (neg_output) output_val = 1 - output_val;
         new_tt[i] = '0' + output_val;
     }
@@ -45,21 +107,12 @@ std::string NPNClassifier::applyPermutation(const std::string& tt,
     int n_vars = TruthTable::getNumVars(tt);
     int num_rows = 1 << n_vars;
     std::string new_tt(num_rows, '0');
-    
+
     for (int i = 0; i < num_rows; ++i) {
-        std::vector<int> inputs(n_vars);
-        int temp = i;
-        for (int j = n_vars - 1; j >= 0; --j) {
-            inputs[j] = temp & 1;
-            temp >>= 1;
-        }
-        std::vector<int> permuted_inputs(n_vars);
-        for (int j = 0; j < n_vars; ++j) {
-            permuted_inputs[j] = inputs[perm[j]];
-        }
         int new_index = 0;
         for (int j = 0; j < n_vars; ++j) {
-            new_index += permuted_inputs[j] * (1 << (n_vars - 1 - j));
+            int bit = (i >> (n_vars - 1 - perm[j])) & 1;
+            new_index |= bit << (n_vars - 1 - j);
         }
         new_tt[i] = tt[new_index];
     }
@@ -69,8 +122,69 @@ std::string NPNClassifier::applyPermutation(const std::string& tt,
 // ==========================================================
 // Canonical representative under NPN
 // ==========================================================
+uint64_t NPNClassifier::getNPNRepresentative(uint64_t tt, int n_vars) {
+    uint64_t min_value = tt;
+    walkNPNOrbit(tt, n_vars, [&](uint64_t value) {
+        min_value = std::min(min_value, value);
+        return true;
+    });
+    return min_value;
+}
+
+uint64_t NPNClassifier::getNPNRepresentative(uint64_t tt, int n_vars, NPNTransform& transform) {
+    // Same walk as walkNPNOrbit, tracking the transform of the current word:
+    // a flip of input v toggles phase bit v, an adjacent swap exchanges
+    // perm[v], perm[v + 1] (the phase is still zero at that point)
+    const NPNWalk& walk = npnWalk(n_vars);
+    const uint64_t mask = TruthTable::packedMask(n_vars);
+
+    NPNTransform current;
+    transform = current;
+    uint64_t min_value = tt;
+    uint64_t permuted = tt;
+    for (size_t p = 0;; ++p) {
+        uint64_t negated = permuted;
+        current.phase = 0;
+        for (size_t k = 0;; ++k) {
+            for (bool out_neg : {false, true}) {
+                const uint64_t value = out_neg ? (~negated & mask) : negated;
+                if (value < min_value) {
+                    min_value = value;
+                    transform = current;
+                    transform.out_neg = out_neg;
+                }
+            }
+            if (k == walk.flips.size()) break;
+            negated = TruthTable::flipVar(negated, walk.flips[k]);
+            current.phase ^= 1u << walk.flips[k];
+        }
+        if (p == walk.swaps.size()) break;
+        permuted = TruthTable::swapAdjacentVars(permuted, walk.swaps[p]);
+        std::swap(current.perm[walk.swaps[p]], current.perm[walk.swaps[p] + 1]);
+    }
+    return min_value;
+}
+
+bool NPNClassifier::isNPNRepresentative(uint64_t tt, int n_vars) {
+    // Cheap necessary conditions first: most functions already have a
+    // smaller neighbour one flip or one adjacent swap away.
+    if (TruthTable::complement(tt, n_vars) < tt) return false;
+    for (int v = 0; v < n_vars; ++v) {
+        if (TruthTable::flipVar(tt, v) < tt) return false;
+    }
+    for (int v = 0; v + 1 < n_vars; ++v) {
+        if (TruthTable::swapAdjacentVars(tt, v) < tt) return false;
+    }
+    return walkNPNOrbit(tt, n_vars, [tt](uint64_t value) { return value >= tt; });
+}
+
 std::string NPNClassifier::getNPNRepresentative(const std::string& tt) {
     int n_vars = TruthTable::getNumVars(tt);
+    if (n_vars <= TruthTable::kMaxPackedVars) {
+        uint64_t rep = getNPNRepresentative(TruthTable::truthTableToBinary(tt), n_vars);
+        return TruthTable::binaryToTruthTable(rep, n_vars);
+    }
+
     std::string min_tt = tt;
     uint64_t min_value = TruthTable::truthTableToBinary(tt);
 
@@ -107,12 +221,22 @@ bool NPNClassifier::areNPNEquivalent(const std::string& tt1, const std::string&
 // ==========================================================
 std::vector<std::string> NPNClassifier::findNPNClasses(const std::vector<std::string>& truth_tables) {
     std::set<std::string> reps;
+    std::vector<std::unordered_set<uint64_t>> packed_reps(TruthTable::kMaxPackedVars + 1);
 
     auto start_time = std::chrono::high_resolution_clock::now();
 
     for (size_t i = 0; i < truth_tables.size(); ++i) {
         const auto& tt = truth_tables[i];
-        reps.insert(getNPNRepresentative(tt));
+        int n_vars = TruthTable::getNumVars(tt);
+        if (n_vars <= TruthTable::kMaxPackedVars) {
+            // Stay in the packed domain; only new classes are turned back into strings
+            uint64_t rep = getNPNRepresentative(TruthTable::truthTableToBinary(tt), n_vars);
+            if (packed_reps[n_vars].insert(rep).second) {
+                reps.insert(TruthTable::binaryToTruthTable(rep, n_vars));
+            }
+        } else {
+            reps.insert(getNPNRepresentative(tt));
+        }
 
         // --- Progress printing every 1000 tables ---
         if (i % 1000 == 0) {
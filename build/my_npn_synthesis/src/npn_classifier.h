@@ -2,6 +2,19 @@
 #include <string>
 #include <vector>
 #include <set>
+#include <cstdint>
+#include <array>
+
+// ---------------- NPNTransform ----------------
+// Relates a function f to its representative r:
+//   f(x) = out_neg ^ r(y),  y_i = x_{perm[i]} ^ (bit i of phase)
+// i.e. input i of r is driven by input perm[i] of f, complemented if bit i
+// of phase is set. Inputs are numbered by their bit in the row index.
+struct NPNTransform {
+    std::array<uint8_t, 6> perm{0, 1, 2, 3, 4, 5};
+    uint32_t phase{0};
+    bool out_neg{false};
+};
 
 class NPNClassifier {
 public:
@@ -14,6 +27,16 @@ public:
 
     static std::string getNPNRepresentative(const std::string& tt);
 
+    // Packed variant (n_vars <= 6): smallest word in the NPN orbit of tt
+    static uint64_t getNPNRepresentative(uint64_t tt, int n_vars);
+
+    // Packed variant that also returns how tt is obtained from the result
+    static uint64_t getNPNRepresentative(uint64_t tt, int n_vars, NPNTransform& transform);
+
+    // Packed variant: true iff tt is the smallest word in its NPN orbit
+    // (stops at the first smaller transform)
+    static bool isNPNRepresentative(uint64_t tt, int n_vars);
+
     static bool areNPNEquivalent(const std::string& tt1, const std::string& tt2);
 
     static std::vector<std::string> findNPNClasses(const std::vector<std::string>& truth_tables);
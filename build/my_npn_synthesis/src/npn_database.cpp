@@ -0,0 +1,274 @@
+#include "npn_database.h"
+#include "npn_classifier.h"
+#include "truth_table.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ==========================================================
+// Network records
+// ==========================================================
+bool encodeChainRecord(const MAJ5Chain& chain, int arity, std::vector<uint32_t>& words) {
+  if (arity == 3 && !chain.isMaj3()) return false;
+  words.push_back(chain.output);
+  for (size_t j = 0; j < chain.numGates(); ++j) {
+    std::array<uint32_t, 3> abc;
+    if (arity == 3) {
+      chain.maj3Fanins(j, abc);
+      words.insert(words.end(), abc.begin(), abc.end());
+    } else {
+      words.insert(words.end(), chain.gates[j].begin(), chain.gates[j].end());
+    }
+  }
+  return true;
+}
+
+namespace {
+
+// Checks the length and the literals of a record without decoding it
+bool validRecord(const uint32_t* begin, const uint32_t* end, int n_vars, int arity) {
+  if (begin == end || (end - begin - 1) % arity != 0) return false;
+  const size_t num_gates = (end - begin - 1) / arity;
+  for (size_t j = 0; j < num_gates; ++j) {
+    const uint32_t first_gate_lit = 2u + 2u * (n_vars + (uint32_t)j);
+    for (int k = 0; k < arity; ++k)
+      if (begin[1 + j * arity + k] >= first_gate_lit) return false;
+  }
+  return *begin < 2u + 2u * (n_vars + num_gates);
+}
+
+} // namespace
+
+bool decodeChainRecord(const uint32_t* begin, const uint32_t* end, int n_vars, int arity,
+                       MAJ5Chain& chain) {
+  if ((arity != 3 && arity != 5) || !validRecord(begin, end, n_vars, arity)) return false;
+  chain = MAJ5Chain{};
+  chain.num_inputs = n_vars;
+  chain.output = *begin;
+  for (const uint32_t* g = begin + 1; g != end; g += arity) {
+    if (arity == 3) chain.addMaj3(g[0], g[1], g[2]);
+    else chain.addGate({g[0], g[1], g[2], g[3], g[4]});
+  }
+  return true;
+}
+
+// ==========================================================
+// File format
+// ==========================================================
+namespace {
+
+constexpr char kMagic[8] = {'N', 'P', 'N', 'D', 'B', 0, 0, 0};
+constexpr uint32_t kVersion = 1;
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t num_vars;
+  uint32_t arity;
+  uint32_t num_classes;
+  uint64_t num_words;
+};
+static_assert(sizeof(Header) == 32, "NPN database header must stay 32 bytes");
+
+size_t functionsOffset() { return sizeof(Header); }
+size_t offsetsOffset(const Header& h) { return functionsOffset() + sizeof(uint64_t) * h.num_classes; }
+size_t wordsOffset(const Header& h) { return offsetsOffset(h) + sizeof(uint32_t) * (h.num_classes + 1ull); }
+size_t fileSize(const Header& h) { return wordsOffset(h) + sizeof(uint32_t) * h.num_words; }
+
+const Header& headerOf(const unsigned char* data) { return *reinterpret_cast<const Header*>(data); }
+
+// Functions strictly ascending within num_vars, offsets ascending from 0 to
+// num_words, and every record valid; the sizes are checked by the caller
+bool validContents(const unsigned char* data) {
+  const Header& h = headerOf(data);
+  const auto* funcs = reinterpret_cast<const uint64_t*>(data + functionsOffset());
+  const auto* offs = reinterpret_cast<const uint32_t*>(data + offsetsOffset(h));
+  const auto* recs = reinterpret_cast<const uint32_t*>(data + wordsOffset(h));
+  const uint64_t mask = TruthTable::packedMask(h.num_vars);
+
+  if (offs[0] != 0 || offs[h.num_classes] != h.num_words) return false;
+  for (uint32_t i = 0; i < h.num_classes; ++i) {
+    if ((funcs[i] & ~mask) != 0 || (i > 0 && funcs[i - 1] >= funcs[i])) return false;
+    if (offs[i] > offs[i + 1] || offs[i + 1] > h.num_words) return false;
+    if (!validRecord(recs + offs[i], recs + offs[i + 1], h.num_vars, h.arity)) return false;
+  }
+  return true;
+}
+
+} // namespace
+
+// ==========================================================
+// Open / close
+// ==========================================================
+NPNDatabase::~NPNDatabase() { close(); }
+
+NPNDatabase::NPNDatabase(NPNDatabase&& other) noexcept { *this = std::move(other); }
+
+NPNDatabase& NPNDatabase::operator=(NPNDatabase&& other) noexcept {
+  if (this != &other) {
+    close();
+    data = other.data;
+    length = other.length;
+    buffer = std::move(other.buffer);
+    functions = other.functions;
+    offsets = other.offsets;
+    words = other.words;
+    other.data = nullptr;
+    other.length = 0;
+    other.buffer.clear();
+  }
+  return *this;
+}
+
+void NPNDatabase::open(const std::string& path) {
+  close();
+#ifdef _WIN32
+  std::ifstream file(path, std::ios::binary);
+  if (!file) throw std::runtime_error("Cannot open NPN database: " + path);
+  buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  data = buffer.data();
+  length = buffer.size();
+#else
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) throw std::runtime_error("Cannot open NPN database: " + path);
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(Header)) {
+    ::close(fd);
+    throw std::runtime_error("Not an NPN database: " + path);
+  }
+  void* mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED) throw std::runtime_error("Cannot map NPN database: " + path);
+  data = static_cast<const unsigned char*>(mapped);
+  length = st.st_size;
+#endif
+
+  if (length < sizeof(Header)) {
+    close();
+    throw std::runtime_error("Not an NPN database: " + path);
+  }
+  const Header& h = headerOf(data);
+  if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0 || h.version != kVersion) {
+    close();
+    throw std::runtime_error("Not an NPN database (or unsupported version): " + path);
+  }
+  if (h.num_vars > (uint32_t)TruthTable::kMaxPackedVars || (h.arity != 3 && h.arity != 5) ||
+      h.num_words > length / sizeof(uint32_t) || fileSize(h) != length || !validContents(data)) {
+    close();
+    throw std::runtime_error("Corrupt NPN database: " + path);
+  }
+  functions = reinterpret_cast<const uint64_t*>(data + functionsOffset());
+  offsets = reinterpret_cast<const uint32_t*>(data + offsetsOffset(h));
+  words = reinterpret_cast<const uint32_t*>(data + wordsOffset(h));
+}
+
+void NPNDatabase::close() {
+#ifndef _WIN32
+  if (data && buffer.empty()) munmap(const_cast<unsigned char*>(data), length);
+#endif
+  buffer.clear();
+  data = nullptr;
+  length = 0;
+  functions = nullptr;
+  offsets = nullptr;
+  words = nullptr;
+}
+
+// ==========================================================
+// Queries
+// ==========================================================
+int NPNDatabase::numVars() const { return data ? (int)headerOf(data).num_vars : 0; }
+int NPNDatabase::arity() const { return data ? (int)headerOf(data).arity : 0; }
+size_t NPNDatabase::size() const { return data ? headerOf(data).num_classes : 0; }
+
+uint64_t NPNDatabase::function(size_t i) const { return functions[i]; }
+
+long NPNDatabase::find(uint64_t canonical_tt) const {
+  const uint64_t* end = functions + size();
+  const uint64_t* it = std::lower_bound(functions, end, canonical_tt);
+  return (it != end && *it == canonical_tt) ? long(it - functions) : -1;
+}
+
+MAJ5Chain NPNDatabase::network(size_t i) const {
+  MAJ5Chain chain;
+  decodeChainRecord(words + offsets[i], words + offsets[i + 1], numVars(), arity(), chain);
+  return chain;
+}
+
+bool NPNDatabase::lookup(uint64_t tt, MAJ5Chain& result) const {
+  if (!isOpen()) return false;
+  const int n = numVars();
+  NPNTransform t;
+  const long index = find(NPNClassifier::getNPNRepresentative(tt & TruthTable::packedMask(n), n, t));
+  if (index < 0) return false;
+
+  // Input i of the representative becomes input perm[i] of tt, complemented
+  // by phase bit i; gate and constant literals are unchanged
+  result = network(index);
+  const uint32_t first_gate = 2u + 2u * n;
+  auto remap = [&](uint32_t lit) {
+    if (lit < 2 || lit >= first_gate) return lit;
+    const uint32_t i = (lit - 2) / 2;
+    return result.inputLit(t.perm[i], ((lit & 1) != 0) != (((t.phase >> i) & 1) != 0));
+  };
+  for (auto& g : result.gates) {
+    for (auto& lit : g) lit = remap(lit);
+    std::sort(g.begin(), g.end());
+  }
+  result.output = remap(result.output) ^ (t.out_neg ? 1u : 0u);
+  return true;
+}
+
+// ==========================================================
+// Writer
+// ==========================================================
+void NPNDatabase::write(const std::string& path, int n_vars, int arity,
+                        std::vector<std::pair<uint64_t, MAJ5Chain>> entries) {
+  if (n_vars < 0 || n_vars > TruthTable::kMaxPackedVars || (arity != 3 && arity != 5))
+    throw std::invalid_argument("NPN database supports up to 6 inputs and arity 3 or 5");
+  std::sort(entries.begin(), entries.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+
+  Header h{};
+  std::memcpy(h.magic, kMagic, sizeof(kMagic));
+  h.version = kVersion;
+  h.num_vars = n_vars;
+  h.arity = arity;
+  h.num_classes = (uint32_t)entries.size();
+
+  std::vector<uint64_t> funcs;
+  std::vector<uint32_t> offs{0};
+  std::vector<uint32_t> data_words;
+  funcs.reserve(entries.size());
+  offs.reserve(entries.size() + 1);
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const auto& [function, chain] = entries[i];
+    if (i > 0 && function == entries[i - 1].first)
+      throw std::invalid_argument("Duplicate class in NPN database");
+    if (chain.num_inputs != n_vars || !encodeChainRecord(chain, arity, data_words))
+      throw std::invalid_argument("Network does not match the NPN database shape");
+    funcs.push_back(function);
+    offs.push_back((uint32_t)data_words.size());
+  }
+  h.num_words = data_words.size();
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) throw std::runtime_error("Cannot open file for writing: " + path);
+  file.write(reinterpret_cast<const char*>(&h), sizeof(h));
+  file.write(reinterpret_cast<const char*>(funcs.data()), sizeof(uint64_t) * funcs.size());
+  file.write(reinterpret_cast<const char*>(offs.data()), sizeof(uint32_t) * offs.size());
+  file.write(reinterpret_cast<const char*>(data_words.data()), sizeof(uint32_t) * data_words.size());
+  if (!file) throw std::runtime_error("Error writing NPN database: " + path);
+}
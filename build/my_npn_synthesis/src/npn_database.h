@@ -0,0 +1,86 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "maj5_chain.h"
+
+// ---------------- Network records ----------------
+// A network is stored as its output literal followed by `arity` fanin
+// literals per gate. With arity 3, a gate MAJ(a, b, c) = MAJ5(0, 1, a, b, c)
+// is stored as a, b, c. The database and the class driver's journal share
+// this encoding.
+
+// Appends the record of chain to words; false if arity is 3 and a gate is
+// not a MAJ(a, b, c) gate
+bool encodeChainRecord(const MAJ5Chain& chain, int arity, std::vector<uint32_t>& words);
+
+// Decodes the record [begin, end); false if its length does not match the
+// arity or a literal reads a later gate or an input beyond n_vars
+bool decodeChainRecord(const uint32_t* begin, const uint32_t* end, int n_vars, int arity,
+                       MAJ5Chain& chain);
+
+// ---------------- NPNDatabase ----------------
+// Read-only view of a binary NPN database file, memory-mapped on open so
+// that nothing is copied or rebuilt. Layout (native byte order):
+//
+//   header     magic "NPNDB", version, num_vars, arity, num_classes, num_words
+//   functions  uint64_t[num_classes]      canonical truth tables, ascending
+//   offsets    uint32_t[num_classes + 1]  record i = words[offsets[i], offsets[i+1])
+//   words      uint32_t[num_words]        network records (see above)
+//
+// Classes are found by binary search over the functions array. Opening
+// checks the header, the offsets, the order of the functions and the
+// literals of every record, so queries on an open database stay in bounds.
+class NPNDatabase {
+public:
+  NPNDatabase() = default;
+  explicit NPNDatabase(const std::string& path) { open(path); }
+  ~NPNDatabase();
+
+  NPNDatabase(const NPNDatabase&) = delete;
+  NPNDatabase& operator=(const NPNDatabase&) = delete;
+  NPNDatabase(NPNDatabase&& other) noexcept;
+  NPNDatabase& operator=(NPNDatabase&& other) noexcept;
+
+  // Maps the file; throws std::runtime_error on I/O or format errors and
+  // leaves the database closed
+  void open(const std::string& path);
+  void close();
+  bool isOpen() const { return data != nullptr; }
+
+  // 0 if no database is open
+  int numVars() const;
+  int arity() const;
+  size_t size() const;
+
+  // Canonical function of class i
+  uint64_t function(size_t i) const;
+
+  // Index of the class whose canonical function is canonical_tt, or -1
+  long find(uint64_t canonical_tt) const;
+
+  // Stored network of class i (implements function(i))
+  MAJ5Chain network(size_t i) const;
+
+  // Network implementing tt: canonizes tt, looks up its class and maps the
+  // stored network back through the NPN transform. False if the class is
+  // not in the database or no database is open.
+  bool lookup(uint64_t tt, MAJ5Chain& result) const;
+
+  // Writes a database for (canonical function, network) pairs; the entries
+  // are sorted by function, duplicates are rejected
+  static void write(const std::string& path, int n_vars, int arity,
+                    std::vector<std::pair<uint64_t, MAJ5Chain>> entries);
+
+private:
+  const unsigned char* data{nullptr};
+  size_t length{0};
+  std::vector<unsigned char> buffer;   // file contents where mmap is unavailable
+
+  const uint64_t* functions{nullptr};
+  const uint32_t* offsets{nullptr};
+  const uint32_t* words{nullptr};
+};
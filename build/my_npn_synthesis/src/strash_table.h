@@ -0,0 +1,77 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ---------------- StrashKey ----------------
+// Up to 128 bits of packed fanin literals, sorted by the caller so that
+// commutative gates share one key.
+struct StrashKey {
+  uint64_t hi{0};
+  uint64_t lo{0};
+
+  bool operator==(const StrashKey& o) const { return hi == o.hi && lo == o.lo; }
+};
+
+// ---------------- StrashTable ----------------
+// Flat open-addressing map from gate keys to gate ids used for structural
+// hashing in the network builders. Linear probing over a power-of-two slot
+// array kept at most half full; lookups never allocate.
+class StrashTable {
+public:
+  explicit StrashTable(std::size_t expected = 64) {
+    std::size_t cap = 16;
+    while (cap < 2 * expected) cap <<= 1;
+    slots.resize(cap);
+  }
+
+  // Gate id stored for key, or -1
+  int find(const StrashKey& key) const {
+    const std::size_t mask = slots.size() - 1;
+    for (std::size_t i = hash(key) & mask;; i = (i + 1) & mask) {
+      const Slot& s = slots[i];
+      if (s.id < 0) return -1;
+      if (s.key == key) return s.id;
+    }
+  }
+
+  // key must not be present yet
+  void insert(const StrashKey& key, int id) {
+    if (2 * (count + 1) > slots.size()) grow();
+    place(key, id);
+    ++count;
+  }
+
+  std::size_t size() const { return count; }
+
+private:
+  struct Slot {
+    StrashKey key;
+    int id{-1};
+  };
+  std::vector<Slot> slots;
+  std::size_t count{0};
+
+  static uint64_t hash(const StrashKey& key) {
+    // splitmix64 finalizer over both words
+    uint64_t x = key.lo ^ (key.hi * 0x9e3779b97f4a7c15ULL);
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+  }
+
+  void place(const StrashKey& key, int id) {
+    const std::size_t mask = slots.size() - 1;
+    std::size_t i = hash(key) & mask;
+    while (slots[i].id >= 0) i = (i + 1) & mask;
+    slots[i] = {key, id};
+  }
+
+  void grow() {
+    std::vector<Slot> old(slots.size() * 2);
+    old.swap(slots);
+    for (const Slot& s : old) {
+      if (s.id >= 0) place(s.key, s.id);
+    }
+  }
+};
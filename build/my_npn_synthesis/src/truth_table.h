@@ -5,6 +5,9 @@
 
 class TruthTable {
 public:
+    // Largest function that fits the packed 64-bit representation
+    static constexpr int kMaxPackedVars = 6;
+
     // Generate all truth tables for n_vars variables
     static std::vector<std::string> generateAllTruthTables(int n_vars);
 
@@ -31,4 +34,75 @@ public:
 
     // Validate truth table
     static bool validateTruthTable(const std::string& tt);
+
+    // ---------------- Packed 64-bit words (n_vars <= 6) ----------------
+    // Bit i of the word is row i of the string form (see truthTableToBinary).
+    // Word operations address variables by their bit position in the row
+    // index, so string variable j (MSB first) is bit (n_vars - 1 - j).
+
+    // Mask of the 2^n_vars valid bits
+    static uint64_t packedMask(int n_vars);
+
+    // Output negation
+    static uint64_t complement(uint64_t tt, int n_vars);
+
+    // Negate input bit `var`
+    static uint64_t flipVar(uint64_t tt, int var);
+
+    // Exchange input bits `var` and `var + 1`
+    static uint64_t swapAdjacentVars(uint64_t tt, int var);
+
+    // Bitwise majority of three / five words (one row per bit)
+    static uint64_t majority3(uint64_t a, uint64_t b, uint64_t c);
+    static uint64_t majority5(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t e);
 };
+
+// ==========================================================
+// Packed word operations (inline: used in the NPN inner loop)
+// ==========================================================
+namespace truth_table_detail {
+
+// Rows in which input bit v is 1
+constexpr uint64_t kProjections[6] = {
+    0xaaaaaaaaaaaaaaaaULL, 0xccccccccccccccccULL, 0xf0f0f0f0f0f0f0f0ULL,
+    0xff00ff00ff00ff00ULL, 0xffff0000ffff0000ULL, 0xffffffff00000000ULL};
+
+// {unchanged rows, rows moving up, rows moving down} when swapping v, v+1
+constexpr uint64_t kSwapMasks[5][3] = {
+    {0x9999999999999999ULL, 0x2222222222222222ULL, 0x4444444444444444ULL},
+    {0xc3c3c3c3c3c3c3c3ULL, 0x0c0c0c0c0c0c0c0cULL, 0x3030303030303030ULL},
+    {0xf00ff00ff00ff00fULL, 0x00f000f000f000f0ULL, 0x0f000f000f000f00ULL},
+    {0xff0000ffff0000ffULL, 0x0000ff000000ff00ULL, 0x00ff000000ff0000ULL},
+    {0xffff00000000ffffULL, 0x00000000ffff0000ULL, 0x0000ffff00000000ULL}};
+
+} // namespace truth_table_detail
+
+inline uint64_t TruthTable::packedMask(int n_vars) {
+    return n_vars >= kMaxPackedVars ? ~0ULL : ((1ULL << (1u << n_vars)) - 1);
+}
+
+inline uint64_t TruthTable::complement(uint64_t tt, int n_vars) {
+    return ~tt & packedMask(n_vars);
+}
+
+inline uint64_t TruthTable::flipVar(uint64_t tt, int var) {
+    const uint64_t proj = truth_table_detail::kProjections[var];
+    const int shift = 1 << var;
+    return ((tt & proj) >> shift) | ((tt & ~proj) << shift);
+}
+
+inline uint64_t TruthTable::swapAdjacentVars(uint64_t tt, int var) {
+    const auto& m = truth_table_detail::kSwapMasks[var];
+    const int shift = 1 << var;
+    return (tt & m[0]) | ((tt & m[1]) << shift) | ((tt & m[2]) >> shift);
+}
+
+inline uint64_t TruthTable::majority3(uint64_t a, uint64_t b, uint64_t c) {
+    return (a & b) | (a & c) | (b & c);
+}
+
+inline uint64_t TruthTable::majority5(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t e) {
+    // at least three of five: all of a,b,c, or two of them and one of d,e,
+    // or one of them and both d,e
+    return (a & b & c) | (majority3(a, b, c) & (d | e)) | ((a | b | c) & d & e);
+}
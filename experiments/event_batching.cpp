@@ -0,0 +1,83 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2023  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+#include <fmt/format.h>
+#include <lorina/aiger.hpp>
+#include <mockturtle/algorithms/aig_resub.hpp>
+#include <mockturtle/algorithms/cleanup.hpp>
+#include <mockturtle/io/aiger_reader.hpp>
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/utils/stopwatch.hpp>
+
+#include <experiments.hpp>
+
+/* runs AIG resubstitution, once substituting through the fanout lists of
+ * `fanout_view` and once through the storage's fanout index, where the
+ * events of each substitution are delivered to the views as one batch */
+int main()
+{
+  using namespace experiments;
+  using namespace mockturtle;
+
+  experiment<std::string, uint32_t, uint32_t, uint32_t, double, double, double> exp( "event_batching", "benchmark", "size", "size_views", "size_batched", "runtime_views", "runtime_batched", "speedup" );
+
+  for ( auto const& benchmark : epfl_benchmarks() )
+  {
+    fmt::print( "[i] processing {}\n", benchmark );
+    aig_network views;
+    if ( lorina::read_aiger( benchmark_path( benchmark ), aiger_reader( views ) ) != lorina::return_code::success )
+    {
+      continue;
+    }
+    aig_network batched = views.clone();
+    uint32_t const size_before = views.num_gates();
+
+    resubstitution_params ps;
+    ps.max_inserts = 1u;
+
+    stopwatch<>::duration time_views{ 0 };
+    ps.use_fanout_index = false;
+    call_with_stopwatch( time_views, [&]() { aig_resubstitution( views, ps ); } );
+    views = cleanup_dangling( views );
+
+    stopwatch<>::duration time_batched{ 0 };
+    ps.use_fanout_index = true;
+    call_with_stopwatch( time_batched, [&]() { aig_resubstitution( batched, ps ); } );
+    batched = cleanup_dangling( batched );
+
+    double const runtime_views = to_seconds( time_views );
+    double const runtime_batched = to_seconds( time_batched );
+
+    exp( benchmark, size_before, views.num_gates(), batched.num_gates(), runtime_views, runtime_batched, runtime_views / std::max( runtime_batched, 1e-9 ) );
+  }
+
+  exp.save();
+  exp.table();
+
+  return 0;
+}
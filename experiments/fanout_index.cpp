@@ -0,0 +1,87 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2023  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+#include <fmt/format.h>
+#include <lorina/aiger.hpp>
+#include <mockturtle/algorithms/mig_algebraic_rewriting.hpp>
+#include <mockturtle/io/aiger_reader.hpp>
+#include <mockturtle/networks/mig.hpp>
+#include <mockturtle/utils/stopwatch.hpp>
+#include <mockturtle/views/depth_view.hpp>
+
+#include <experiments.hpp>
+
+/* runs MIG algebraic depth rewriting, which substitutes nodes through the
+ * network (no fanout_view), with and without the storage's fanout index;
+ * levels are updated incrementally, such that the full scan for fanouts in
+ * `substitute_node` is the remaining linear cost per rewrite */
+int main()
+{
+  using namespace experiments;
+  using namespace mockturtle;
+
+  experiment<std::string, uint32_t, uint32_t, uint32_t, double, double, double, bool> exp( "fanout_index", "benchmark", "size", "size_after", "depth_after", "runtime_scan", "runtime_index", "speedup", "same" );
+
+  for ( auto const& benchmark : epfl_benchmarks() )
+  {
+    fmt::print( "[i] processing {}\n", benchmark );
+    mig_network scan;
+    if ( lorina::read_aiger( benchmark_path( benchmark ), aiger_reader( scan ) ) != lorina::return_code::success )
+    {
+      continue;
+    }
+    mig_network indexed = scan.clone();
+    uint32_t const size_before = scan.num_gates();
+
+    mig_algebraic_depth_rewriting_params ps;
+    ps.strategy = mig_algebraic_depth_rewriting_params::selective;
+    depth_view_params dps;
+    dps.incremental = true;
+
+    stopwatch<>::duration time_scan{ 0 };
+    ps.use_fanout_index = false;
+    depth_view depth_scan{ scan, {}, dps };
+    call_with_stopwatch( time_scan, [&]() { mig_algebraic_depth_rewriting( depth_scan, ps ); } );
+
+    stopwatch<>::duration time_index{ 0 };
+    ps.use_fanout_index = true;
+    depth_view depth_indexed{ indexed, {}, dps };
+    call_with_stopwatch( time_index, [&]() { mig_algebraic_depth_rewriting( depth_indexed, ps ); } );
+
+    bool const same = scan.num_gates() == indexed.num_gates() && depth_scan.depth() == depth_indexed.depth();
+    double const runtime_scan = to_seconds( time_scan );
+    double const runtime_index = to_seconds( time_index );
+
+    exp( benchmark, size_before, indexed.num_gates(), depth_indexed.depth(), runtime_scan, runtime_index, runtime_scan / std::max( runtime_index, 1e-9 ), same );
+  }
+
+  exp.save();
+  exp.table();
+
+  return 0;
+}
@@ -0,0 +1,161 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2023  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+#include <kitty/partial_truth_table.hpp>
+#include <lorina/aiger.hpp>
+#include <mockturtle/algorithms/cut_enumeration.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/io/aiger_reader.hpp>
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/utils/stopwatch.hpp>
+#include <mockturtle/views/depth_view.hpp>
+
+#if defined( __linux__ )
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <experiments.hpp>
+
+/* counts hardware cache misses of the calling thread, reports 0 when the
+ * counter is not available (e.g., no permission or no PMU) */
+class cache_miss_counter
+{
+public:
+  cache_miss_counter()
+  {
+#if defined( __linux__ )
+    perf_event_attr attr{};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof( perf_event_attr );
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd = static_cast<int>( syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 ) );
+#endif
+  }
+
+  ~cache_miss_counter()
+  {
+#if defined( __linux__ )
+    if ( fd != -1 )
+    {
+      close( fd );
+    }
+#endif
+  }
+
+  template<class Fn>
+  uint64_t operator()( Fn&& fn )
+  {
+#if defined( __linux__ )
+    if ( fd != -1 )
+    {
+      ioctl( fd, PERF_EVENT_IOC_RESET, 0 );
+      ioctl( fd, PERF_EVENT_IOC_ENABLE, 0 );
+      fn();
+      ioctl( fd, PERF_EVENT_IOC_DISABLE, 0 );
+      uint64_t count{ 0 };
+      if ( read( fd, &count, sizeof( count ) ) == sizeof( count ) )
+      {
+        return count;
+      }
+      return 0u;
+    }
+#endif
+    fn();
+    return 0u;
+  }
+
+private:
+  int fd{ -1 };
+};
+
+/* traversal-heavy workload: simulation, depth computation, and cut enumeration */
+template<class Ntk>
+std::pair<uint64_t, double> run_workload( Ntk const& ntk, cache_miss_counter& counter )
+{
+  mockturtle::stopwatch<>::duration time{ 0 };
+  uint64_t const misses = counter( [&]() {
+    mockturtle::stopwatch t( time );
+
+    mockturtle::partial_simulator sim( ntk.num_pis(), 256u );
+    auto const values = mockturtle::simulate_nodes<kitty::partial_truth_table>( ntk, sim );
+    (void)values;
+
+    mockturtle::depth_view<Ntk> depth_ntk{ ntk };
+    (void)depth_ntk.depth();
+
+    mockturtle::cut_enumeration_params ps;
+    ps.cut_size = 4u;
+    ps.cut_limit = 8u;
+    auto const cuts = mockturtle::cut_enumeration( ntk, ps );
+    (void)cuts.total_cuts();
+  } );
+  return { misses, mockturtle::to_seconds( time ) };
+}
+
+int main()
+{
+  using namespace experiments;
+  using namespace mockturtle;
+
+  experiment<std::string, uint32_t, uint64_t, uint64_t, double, double, double> exp( "storage_layout", "benchmark", "size", "misses_aos", "misses_soa", "miss_ratio", "runtime_aos", "runtime_soa" );
+
+  cache_miss_counter counter;
+  for ( auto const& benchmark : epfl_benchmarks( experiments::arithmetic ) )
+  {
+    fmt::print( "[i] processing {}\n", benchmark );
+    aig_network aig;
+    if ( lorina::read_aiger( benchmark_path( benchmark ), aiger_reader( aig ) ) != lorina::return_code::success )
+    {
+      continue;
+    }
+    aig_soa_network soa;
+    if ( lorina::read_aiger( benchmark_path( benchmark ), aiger_reader( soa ) ) != lorina::return_code::success )
+    {
+      continue;
+    }
+
+    auto const [misses_aos, runtime_aos] = run_workload( aig, counter );
+    auto const [misses_soa, runtime_soa] = run_workload( soa, counter );
+    double const ratio = misses_aos == 0u ? 0.0 : static_cast<double>( misses_soa ) / misses_aos;
+
+    exp( benchmark, aig.size(), misses_aos, misses_soa, ratio, runtime_aos, runtime_soa );
+  }
+
+  exp.save();
+  exp.table();
+
+  return 0;
+}
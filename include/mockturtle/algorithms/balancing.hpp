@@ -132,7 +132,9 @@ struct balancing_impl
     std::shared_ptr<depth_view<Ntk, CostFn>> depth_ntk;
     if ( ps_.only_on_critical_path )
     {
-      depth_ntk = std::make_shared<depth_view<Ntk, CostFn>>( ntk_ );
+      depth_view_params dps;
+      dps.incremental = true;
+      depth_ntk = std::make_shared<depth_view<Ntk, CostFn>>( ntk_, CostFn{}, dps );
     }
 
     stopwatch<> t( st_.time_total );
@@ -41,6 +41,7 @@
 
 #include <kitty/operations.hpp>
 
+#include <cassert>
 #include <iostream>
 #include <type_traits>
 #include <vector>
@@ -570,6 +571,39 @@ template<class NtkSrc, class NtkDest = NtkSrc>
   static_assert( has_create_not_v<NtkDest>, "NtkDest does not implement the create_not method" );
   static_assert( has_is_complemented_v<NtkSrc>, "NtkDest does not implement the is_complemented method" );
 
+  /* a copy of a network without structurally equal gates needs no
+     structural hashing, the hash table is rebuilt once at the end; the
+     source has such gates if some are missing in its hash table (e.g.,
+     after `substitute_node_no_restrash`) */
+  if constexpr ( std::is_same_v<NtkSrc, NtkDest> && has_begin_bulk_v<NtkDest> && !is_crossed_network_type_v<NtkSrc> )
+  {
+    uint64_t num_gates{ 0u };
+    ntk.foreach_gate( [&]( auto const& ) {
+      ++num_gates;
+    } );
+
+    if ( num_gates == ntk.num_gates() )
+    {
+      NtkDest dest;
+      dest.begin_bulk( ntk.size() );
+
+      std::vector<signal<NtkDest>> cis;
+      detail::clone_inputs( ntk, dest, cis, remove_dangling_PIs );
+
+      node_map<signal<NtkDest>, NtkSrc> old_to_new( ntk );
+      detail::cleanup_dangling_impl( ntk, dest, cis.begin(), cis.end(), old_to_new );
+      if ( dest.end_bulk() == 0u )
+      {
+        /* all copied gates are hashed, hence counted by `num_gates` */
+        assert( dest.num_gates() + dest.num_cis() + 1u == dest.size() );
+        detail::clone_outputs( ntk, dest, old_to_new, remove_redundant_POs );
+        return dest;
+      }
+      /* gates that only become equal when trivial fanins (e.g., equal
+         children) are simplified in the copy are merged below */
+    }
+  }
+
   NtkDest dest;
 
   std::vector<signal<NtkDest>> cis;
@@ -36,23 +36,28 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
 #include <iostream>
 #include <optional>
+#include <thread>
 #include <vector>
 
 #include <kitty/constructors.hpp>
 #include <kitty/dynamic_truth_table.hpp>
+#include <kitty/static_truth_table.hpp>
 
 #include <fmt/format.h>
 
 #include "../traits.hpp"
+#include "../utils/algorithm.hpp"
 #include "../utils/cuts.hpp"
 #include "../utils/mixed_radix.hpp"
 #include "../utils/stopwatch.hpp"
 #include "../utils/truth_table_cache.hpp"
+#include "../utils/truth_table_utils.hpp"
 
 namespace mockturtle
 {
@@ -76,6 +81,9 @@ struct cut_enumeration_params
   /*! \brief Prune cuts by removing don't cares. */
   bool minimize_truth_table{ false };
 
+  /*! \brief Number of threads for `parallel_cut_enumeration` (0 uses all hardware threads). */
+  uint32_t num_threads{ 0u };
+
   /*! \brief Be verbose. */
   bool verbose{ false };
 
@@ -128,6 +136,9 @@ struct network_cuts;
 template<typename Ntk, bool ComputeTruth = false, typename CutData = empty_cut_data>
 network_cuts<Ntk, ComputeTruth, CutData> cut_enumeration( Ntk const& ntk, cut_enumeration_params const& ps = {}, cut_enumeration_stats* pst = nullptr );
 
+template<typename Ntk, bool ComputeTruth = false, typename CutData = empty_cut_data>
+network_cuts<Ntk, ComputeTruth, CutData> parallel_cut_enumeration( Ntk const& ntk, cut_enumeration_params const& ps = {}, cut_enumeration_stats* pst = nullptr );
+
 /* function to update a cut */
 template<typename CutData>
 struct cut_enumeration_update_cut
@@ -146,6 +157,9 @@ namespace detail
 {
 template<typename Ntk, bool ComputeTruth, typename CutData>
 class cut_enumeration_impl;
+
+template<typename Ntk, bool ComputeTruth, typename CutData>
+class parallel_cut_enumeration_impl;
 }
 /*! \endcond */
 
@@ -247,9 +261,15 @@ private:
   template<typename _Ntk, bool _ComputeTruth, typename _CutData>
   friend class detail::cut_enumeration_impl;
 
+  template<typename _Ntk, bool _ComputeTruth, typename _CutData>
+  friend class detail::parallel_cut_enumeration_impl;
+
   template<typename _Ntk, bool _ComputeTruth, typename _CutData>
   friend network_cuts<_Ntk, _ComputeTruth, _CutData> cut_enumeration( _Ntk const& ntk, cut_enumeration_params const& ps, cut_enumeration_stats* pst );
 
+  template<typename _Ntk, bool _ComputeTruth, typename _CutData>
+  friend network_cuts<_Ntk, _ComputeTruth, _CutData> parallel_cut_enumeration( _Ntk const& ntk, cut_enumeration_params const& ps, cut_enumeration_stats* pst );
+
 private:
   void add_zero_cut( uint32_t index )
   {
@@ -287,6 +307,37 @@ private:
 namespace detail
 {
 
+/* marks a `func_id` that refers to a thread-local truth table cache */
+static constexpr uint32_t pending_func_id = UINT32_C( 0x80000000 );
+
+/* cut database passed to `cut_enumeration_update_cut` while truth tables of
+ * new cuts are still stored in a thread-local truth table cache */
+template<typename Ntk, bool ComputeTruth, typename CutData>
+class pending_network_cuts
+{
+public:
+  using cut_t = typename network_cuts<Ntk, ComputeTruth, CutData>::cut_t;
+  using cut_set_t = typename network_cuts<Ntk, ComputeTruth, CutData>::cut_set_t;
+  static constexpr bool compute_truth = ComputeTruth;
+
+  pending_network_cuts( network_cuts<Ntk, ComputeTruth, CutData> const& cuts, truth_table_cache<kitty::dynamic_truth_table> const& pending_tts )
+      : _cuts( cuts ),
+        _pending_tts( pending_tts )
+  {
+  }
+
+  cut_set_t const& cuts( uint32_t node_index ) const { return _cuts.cuts( node_index ); }
+
+  kitty::dynamic_truth_table truth_table( cut_t const& cut ) const
+  {
+    return ( cut->func_id & pending_func_id ) ? _pending_tts[cut->func_id ^ pending_func_id] : _cuts.truth_table( cut );
+  }
+
+private:
+  network_cuts<Ntk, ComputeTruth, CutData> const& _cuts;
+  truth_table_cache<kitty::dynamic_truth_table> const& _pending_tts;
+};
+
 template<typename Ntk, bool ComputeTruth, typename CutData>
 class cut_enumeration_impl
 {
@@ -294,11 +345,15 @@ public:
   using cut_t = typename network_cuts<Ntk, ComputeTruth, CutData>::cut_t;
   using cut_set_t = typename network_cuts<Ntk, ComputeTruth, CutData>::cut_set_t;
 
-  explicit cut_enumeration_impl( Ntk const& ntk, cut_enumeration_params const& ps, cut_enumeration_stats& st, network_cuts<Ntk, ComputeTruth, CutData>& cuts )
+  /* if `pending_tts` is given, truth tables of new cuts are inserted into
+   * this cache instead of the one of `cuts`, and their `func_id` is the
+   * literal in `pending_tts` marked with `pending_func_id` */
+  explicit cut_enumeration_impl( Ntk const& ntk, cut_enumeration_params const& ps, cut_enumeration_stats& st, network_cuts<Ntk, ComputeTruth, CutData>& cuts, truth_table_cache<kitty::dynamic_truth_table>* pending_tts = nullptr )
       : ntk( ntk ),
         ps( ps ),
         st( st ),
-        cuts( cuts )
+        cuts( cuts ),
+        pending_tts( pending_tts )
   {
     assert( ps.cut_limit < cuts.max_cut_num && "cut_limit exceeds the compile-time limit for the maximum number of cuts" );
   }
@@ -326,23 +381,81 @@ public:
       }
       else
       {
-        if constexpr ( Ntk::min_fanin_size == 2 && Ntk::max_fanin_size == 2 )
-        {
-          merge_cuts2( index );
-        }
-        else
-        {
-          merge_cuts( index );
-        }
+        compute_cuts( index );
       }
     } );
+
+    cuts._total_tuples = total_tuples;
+    cuts._total_cuts = total_cuts;
+  }
+
+  /* computes the cuts of a gate from the cuts of its fanins */
+  void compute_cuts( uint32_t index )
+  {
+    if constexpr ( Ntk::min_fanin_size == 2 && Ntk::max_fanin_size == 2 )
+    {
+      merge_cuts2( index );
+    }
+    else
+    {
+      merge_cuts( index );
+    }
+  }
+
+  uint32_t num_tuples() const
+  {
+    return total_tuples;
+  }
+
+  std::size_t num_cuts() const
+  {
+    return total_cuts;
   }
 
 private:
+  uint32_t insert_truth_table( kitty::dynamic_truth_table const& tt )
+  {
+    if ( pending_tts != nullptr )
+    {
+      return pending_tts->insert( tt ) | pending_func_id;
+    }
+    return cuts._truth_tables.insert( tt );
+  }
+
+  uint32_t insert_truth_table_word( uint64_t tt, uint32_t num_vars )
+  {
+    if ( pending_tts != nullptr )
+    {
+      return pending_tts->insert_word( tt, num_vars ) | pending_func_id;
+    }
+    return cuts._truth_tables.insert_word( tt, num_vars );
+  }
+
+  void update_cut( cut_t& cut, node<Ntk> const& n )
+  {
+    if constexpr ( ComputeTruth )
+    {
+      if ( pending_tts != nullptr )
+      {
+        cut_enumeration_update_cut<CutData>::apply( cut, pending_network_cuts<Ntk, ComputeTruth, CutData>( cuts, *pending_tts ), ntk, n );
+        return;
+      }
+    }
+    cut_enumeration_update_cut<CutData>::apply( cut, cuts, ntk, n );
+  }
+
   uint32_t compute_truth_table( uint32_t index, std::vector<cut_t const*> const& vcuts, cut_t& res )
   {
     stopwatch t( st.time_truth_table );
 
+    if constexpr ( has_compute_v<Ntk, kitty::static_truth_table<6u>> )
+    {
+      if ( res.size() <= 6u )
+      {
+        return compute_truth_table_word( index, vcuts, res );
+      }
+    }
+
     std::vector<kitty::dynamic_truth_table> tt( vcuts.size() );
     auto i = 0;
     for ( auto const& cut : vcuts )
@@ -371,11 +484,43 @@ private:
           *it_leaves++ = leaves_before[*it_support++];
         }
         res.set_leaves( leaves_after.begin(), leaves_after.end() );
-        return cuts._truth_tables.insert( tt_res_shrink );
+        return insert_truth_table( tt_res_shrink );
       }
     }
 
-    return cuts._truth_tables.insert( tt_res );
+    return insert_truth_table( tt_res );
+  }
+
+  /* truth table computation for cuts with at most 6 leaves on 64-bit words */
+  uint32_t compute_truth_table_word( uint32_t index, std::vector<cut_t const*> const& vcuts, cut_t& res )
+  {
+    word_tts.resize( vcuts.size() );
+    auto i = 0u;
+    for ( auto const& cut : vcuts )
+    {
+      auto const func_id = ( *cut )->func_id;
+      word_tts[i++]._bits = expand_truth_table_word( cuts._truth_tables.word( func_id ), cuts._truth_tables.num_vars( func_id ), cut->begin(), cut->end(), res.begin(), res.end() );
+    }
+
+    auto tt_res = ntk.compute( ntk.index_to_node( index ), word_tts.begin(), word_tts.end() )._bits & truth_table_word_mask( res.size() );
+
+    if ( ps.minimize_truth_table )
+    {
+      std::array<uint8_t, 6u> support;
+      auto const num_vars = min_base_truth_table_word( tt_res, res.size(), support );
+      if ( num_vars != res.size() )
+      {
+        std::array<uint32_t, 6u> leaves;
+        for ( auto j = 0u; j < num_vars; ++j )
+        {
+          leaves[j] = *( res.begin() + support[j] );
+        }
+        res.set_leaves( leaves.begin(), leaves.begin() + num_vars );
+        return insert_truth_table_word( tt_res, num_vars );
+      }
+    }
+
+    return insert_truth_table_word( tt_res, res.size() );
   }
 
   void merge_cuts2( uint32_t index )
@@ -395,7 +540,7 @@ private:
 
     std::vector<cut_t const*> vcuts( fanin );
 
-    cuts._total_tuples += pairs;
+    total_tuples += pairs;
     for ( auto const& c1 : *lcuts[0] )
     {
       for ( auto const& c2 : *lcuts[1] )
@@ -417,7 +562,7 @@ private:
           new_cut->func_id = compute_truth_table( index, vcuts, new_cut );
         }
 
-        cut_enumeration_update_cut<CutData>::apply( new_cut, cuts, ntk, index );
+        update_cut( new_cut, index );
 
         rcuts.insert( new_cut );
       }
@@ -426,7 +571,7 @@ private:
     /* limit the maximum number of cuts */
     rcuts.limit( ps.cut_limit - 1 );
 
-    cuts._total_cuts += rcuts.size();
+    total_cuts += rcuts.size();
 
     if ( rcuts.size() > 1 || ( *rcuts.begin() )->size() > 1 )
     {
@@ -457,7 +602,7 @@ private:
 
       std::vector<cut_t const*> vcuts( fanin );
 
-      cuts._total_tuples += pairs;
+      total_tuples += pairs;
       foreach_mixed_radix_tuple( cut_sizes.begin(), cut_sizes.end(), [&]( auto begin, auto end ) {
         auto it = vcuts.begin();
         auto i = 0u;
@@ -490,7 +635,7 @@ private:
           new_cut->func_id = compute_truth_table( index, vcuts, new_cut );
         }
 
-        cut_enumeration_update_cut<CutData>::apply( new_cut, cuts, ntk, ntk.index_to_node( index ) );
+        update_cut( new_cut, ntk.index_to_node( index ) );
 
         rcuts.insert( new_cut );
 
@@ -513,7 +658,7 @@ private:
           new_cut->func_id = compute_truth_table( index, { cut }, new_cut );
         }
 
-        cut_enumeration_update_cut<CutData>::apply( new_cut, cuts, ntk, ntk.index_to_node( index ) );
+        update_cut( new_cut, ntk.index_to_node( index ) );
 
         rcuts.insert( new_cut );
       }
@@ -522,7 +667,7 @@ private:
       rcuts.limit( ps.cut_limit - 1 );
     }
 
-    cuts._total_cuts += static_cast<uint32_t>( rcuts.size() );
+    total_cuts += static_cast<uint32_t>( rcuts.size() );
 
     cuts.add_unit_cut( index );
   }
@@ -532,8 +677,13 @@ private:
   cut_enumeration_params const& ps;
   cut_enumeration_stats& st;
   network_cuts<Ntk, ComputeTruth, CutData>& cuts;
+  truth_table_cache<kitty::dynamic_truth_table>* pending_tts;
 
   std::array<cut_set_t*, Ntk::max_fanin_size + 1> lcuts;
+  std::vector<kitty::static_truth_table<6u>> word_tts;
+
+  uint32_t total_tuples{};
+  std::size_t total_cuts{};
 };
 } /* namespace detail */
 /*! \endcond */
@@ -614,6 +764,214 @@ network_cuts<Ntk, ComputeTruth, CutData> cut_enumeration( Ntk const& ntk, cut_en
   return res;
 }
 
+/*! \cond PRIVATE */
+namespace detail
+{
+
+template<typename Ntk, bool ComputeTruth, typename CutData>
+class parallel_cut_enumeration_impl
+{
+public:
+  using worker_t = cut_enumeration_impl<Ntk, ComputeTruth, CutData>;
+
+  /* gates of one level are only distributed if each thread gets this many */
+  static constexpr uint64_t min_gates_per_thread = 256u;
+
+  explicit parallel_cut_enumeration_impl( Ntk const& ntk, cut_enumeration_params const& ps, cut_enumeration_stats& st, network_cuts<Ntk, ComputeTruth, CutData>& cuts )
+      : ntk( ntk ),
+        ps( ps ),
+        st( st ),
+        cuts( cuts )
+  {
+    assert( ps.cut_limit < cuts.max_cut_num && "cut_limit exceeds the compile-time limit for the maximum number of cuts" );
+  }
+
+public:
+  void run()
+  {
+    stopwatch t( st.time_total );
+
+    auto const num_threads = ps.num_threads == 0u ? std::max( 1u, std::thread::hardware_concurrency() ) : ps.num_threads;
+
+    levelize();
+
+    /* one cut enumeration and one truth table cache per thread */
+    std::vector<cut_enumeration_stats> worker_st( num_threads );
+    std::vector<truth_table_cache<kitty::dynamic_truth_table>> pending_tts( ComputeTruth ? num_threads : 0u );
+    std::vector<worker_t> workers;
+    workers.reserve( num_threads );
+    for ( auto i = 0u; i < num_threads; ++i )
+    {
+      workers.emplace_back( ntk, ps, worker_st[i], cuts, ComputeTruth ? &pending_tts[i] : nullptr );
+    }
+
+    std::vector<uint32_t> owner( gates.size() );
+    for ( auto l = 1u; l + 1u < level_begin.size(); ++l )
+    {
+      /* gates of the same level only depend on gates of lower levels */
+      parallel_for(
+          level_begin[l], level_begin[l + 1u], num_threads, [&]( uint64_t first, uint64_t last, uint32_t thread_id ) {
+            for ( auto i = first; i < last; ++i )
+            {
+              workers[thread_id].compute_cuts( gates[i] );
+              owner[i] = thread_id;
+            }
+          },
+          min_gates_per_thread );
+
+      /* move truth tables into the shared cache in a fixed order, such that
+       * function literals do not depend on the number of threads */
+      if constexpr ( ComputeTruth )
+      {
+        for ( auto i = level_begin[l]; i < level_begin[l + 1u]; ++i )
+        {
+          auto const& tts = pending_tts[owner[i]];
+          for ( auto& cut : cuts.cuts( gates[i] ) )
+          {
+            auto& func_id = ( *cut )->func_id;
+            if ( func_id & pending_func_id )
+            {
+              auto const lit = func_id ^ pending_func_id;
+              func_id = tts.num_vars( lit ) <= 6u ? cuts._truth_tables.insert_word( tts.word( lit ), tts.num_vars( lit ) ) : cuts._truth_tables.insert( tts[lit] );
+            }
+          }
+        }
+        /* resets only the slots used in this level */
+        for ( auto& tts : pending_tts )
+        {
+          tts.clear();
+        }
+      }
+    }
+
+    for ( auto i = 0u; i < num_threads; ++i )
+    {
+      cuts._total_tuples += workers[i].num_tuples();
+      cuts._total_cuts += workers[i].num_cuts();
+      st.time_truth_table += worker_st[i].time_truth_table;
+    }
+  }
+
+private:
+  /* adds cuts of constants and CIs, and sorts the gates by level */
+  void levelize()
+  {
+    std::vector<uint32_t> levels( ntk.size(), 0u );
+    std::vector<uint32_t> order;
+    uint32_t depth{ 0u };
+
+    ntk.foreach_node( [&]( auto node ) {
+      const auto index = ntk.node_to_index( node );
+
+      if ( ntk.is_constant( node ) )
+      {
+        cuts.add_zero_cut( index );
+      }
+      else if ( ntk.is_ci( node ) )
+      {
+        cuts.add_unit_cut( index );
+      }
+      else
+      {
+        uint32_t level{ 0u };
+        ntk.foreach_fanin( node, [&]( auto const& f ) {
+          level = std::max( level, levels[ntk.node_to_index( ntk.get_node( f ) )] );
+        } );
+        levels[index] = level + 1u;
+        depth = std::max( depth, level + 1u );
+        order.push_back( index );
+      }
+    } );
+
+    /* counting sort keeps the topological order within each level */
+    level_begin.assign( depth + 2u, 0u );
+    for ( auto const index : order )
+    {
+      ++level_begin[levels[index] + 1u];
+    }
+    for ( auto l = 1u; l < level_begin.size(); ++l )
+    {
+      level_begin[l] += level_begin[l - 1u];
+    }
+    gates.resize( order.size() );
+    auto next = level_begin;
+    for ( auto const index : order )
+    {
+      gates[next[levels[index]]++] = index;
+    }
+  }
+
+private:
+  Ntk const& ntk;
+  cut_enumeration_params const& ps;
+  cut_enumeration_stats& st;
+  network_cuts<Ntk, ComputeTruth, CutData>& cuts;
+
+  std::vector<uint32_t> gates;       /* gate indexes sorted by level */
+  std::vector<uint32_t> level_begin; /* gates of level l are in [level_begin[l], level_begin[l + 1]) */
+};
+
+} /* namespace detail */
+/*! \endcond */
+
+/*! \brief Parallel cut enumeration.
+ *
+ * Computes the same cut sets as `cut_enumeration`, but the cuts of all gates
+ * in the same topological level are computed concurrently on
+ * `ps.num_threads` threads.  Each thread inserts the truth tables of its new
+ * cuts into a thread-local cache.  After each level, these truth tables are
+ * moved into the cache of the cut database in the order of the gates and
+ * their cuts.  Hence, the result, including the `func_id` of each cut, does
+ * not depend on the number of threads.  The `func_id` literals may differ from
+ * the ones assigned by `cut_enumeration`, but the truth tables are the same.
+ *
+ * The time for truth table computation in the statistics is the sum over all
+ * threads.
+ *
+ * The function `cut_enumeration_update_cut<CutData>::apply` is called from
+ * several threads.  Its argument for the cut database only provides the
+ * methods `cuts` and `truth_table`.
+ *
+ * **Required network functions:**
+ * - `is_constant`
+ * - `is_ci`
+ * - `size`
+ * - `get_node`
+ * - `node_to_index`
+ * - `foreach_node`
+ * - `foreach_fanin`
+ * - `compute` for `kitty::dynamic_truth_table` (if `ComputeTruth` is true)
+ */
+template<typename Ntk, bool ComputeTruth, typename CutData>
+network_cuts<Ntk, ComputeTruth, CutData> parallel_cut_enumeration( Ntk const& ntk, cut_enumeration_params const& ps, cut_enumeration_stats* pst )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( has_is_constant_v<Ntk>, "Ntk does not implement the is_constant method" );
+  static_assert( has_is_ci_v<Ntk>, "Ntk does not implement the is_ci method" );
+  static_assert( has_size_v<Ntk>, "Ntk does not implement the size method" );
+  static_assert( has_get_node_v<Ntk>, "Ntk does not implement the get_node method" );
+  static_assert( has_foreach_node_v<Ntk>, "Ntk does not implement the foreach_node method" );
+  static_assert( has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin method" );
+  static_assert( has_node_to_index_v<Ntk>, "Ntk does not implement the node_to_index method" );
+  static_assert( !ComputeTruth || has_compute_v<Ntk, kitty::dynamic_truth_table>, "Ntk does not implement the compute method for kitty::dynamic_truth_table" );
+
+  cut_enumeration_stats st;
+  network_cuts<Ntk, ComputeTruth, CutData> res( ntk.size() );
+  detail::parallel_cut_enumeration_impl<Ntk, ComputeTruth, CutData> p( ntk, ps, st, res );
+  p.run();
+
+  if ( ps.verbose )
+  {
+    st.report();
+  }
+  if ( pst )
+  {
+    *pst = st;
+  }
+
+  return res;
+}
+
 /* forward declarations */
 /*! \cond PRIVATE */
 template<typename Ntk, uint32_t NumVars, bool ComputeTruth, typename CutData>
@@ -826,13 +1184,21 @@ private:
   {
     stopwatch t( st.time_truth_table );
 
-    std::vector<kitty::static_truth_table<NumVars>> tt( vcuts.size() );
+    auto& tt = fanin_tts;
+    tt.resize( vcuts.size() );
     auto i = 0;
     for ( auto const& cut : vcuts )
     {
-      tt[i] = cuts._truth_tables[( *cut )->func_id];
-      const auto supp = cuts.compute_truth_table_support( *cut, res );
-      kitty::expand_inplace( tt[i], supp );
+      if constexpr ( NumVars <= 6u )
+      {
+        tt[i]._bits = expand_truth_table_word( cuts._truth_tables[( *cut )->func_id]._bits, NumVars, cut->begin(), cut->end(), res.begin(), res.end() ) & truth_table_word_mask( NumVars );
+      }
+      else
+      {
+        tt[i] = cuts._truth_tables[( *cut )->func_id];
+        const auto supp = cuts.compute_truth_table_support( *cut, res );
+        kitty::expand_inplace( tt[i], supp );
+      }
       ++i;
     }
 
@@ -840,19 +1206,36 @@ private:
 
     if ( ps.minimize_truth_table )
     {
-      const auto support = kitty::min_base_inplace( tt_res );
-      if ( support.size() != res.size() )
+      if constexpr ( NumVars <= 6u )
       {
-        std::vector<uint32_t> leaves_before( res.begin(), res.end() );
-        std::vector<uint32_t> leaves_after( support.size() );
-
-        auto it_support = support.begin();
-        auto it_leaves = leaves_after.begin();
-        while ( it_support != support.end() )
+        std::array<uint8_t, 6u> support;
+        auto const num_vars = min_base_truth_table_word( tt_res._bits, NumVars, support );
+        if ( num_vars != res.size() )
         {
-          *it_leaves++ = leaves_before[*it_support++];
+          std::array<uint32_t, 6u> leaves;
+          for ( auto j = 0u; j < num_vars; ++j )
+          {
+            leaves[j] = *( res.begin() + support[j] );
+          }
+          res.set_leaves( leaves.begin(), leaves.begin() + num_vars );
+        }
+      }
+      else
+      {
+        const auto support = kitty::min_base_inplace( tt_res );
+        if ( support.size() != res.size() )
+        {
+          std::vector<uint32_t> leaves_before( res.begin(), res.end() );
+          std::vector<uint32_t> leaves_after( support.size() );
+
+          auto it_support = support.begin();
+          auto it_leaves = leaves_after.begin();
+          while ( it_support != support.end() )
+          {
+            *it_leaves++ = leaves_before[*it_support++];
+          }
+          res.set_leaves( leaves_after.begin(), leaves_after.end() );
         }
-        res.set_leaves( leaves_after.begin(), leaves_after.end() );
       }
     }
 
@@ -1015,6 +1398,7 @@ private:
   fast_network_cuts<Ntk, NumVars, ComputeTruth, CutData>& cuts;
 
   std::array<cut_set_t*, Ntk::max_fanin_size + 1> lcuts;
+  std::vector<kitty::static_truth_table<NumVars>> fanin_tts;
 };
 } /* namespace detail */
 /*! \endcond */
@@ -1379,8 +1763,9 @@ private:
     /* variables not in the support are the most significative */
     if ( support_size != res.size() )
     {
-      std::vector<uint32_t> leaves( res.begin(), res.begin() + support_size );
-      res.set_leaves( leaves.begin(), leaves.end() );
+      std::array<uint32_t, NumVars> leaves;
+      std::copy( res.begin(), res.begin() + support_size, leaves.begin() );
+      res.set_leaves( leaves.begin(), leaves.begin() + support_size );
     }
 
     return true;
@@ -1390,13 +1775,21 @@ private:
   {
     stopwatch t( st.time_truth_table );
 
-    std::vector<kitty::static_truth_table<NumVars>> tt( vcuts.size() );
+    auto& tt = fanin_tts;
+    tt.resize( vcuts.size() );
     auto i = 0;
     for ( auto const& cut : vcuts )
     {
-      tt[i] = cuts._truth_tables[( *cut )->func_id];
-      const auto supp = cuts.compute_truth_table_support( *cut, res );
-      kitty::expand_inplace( tt[i], supp );
+      if constexpr ( NumVars <= 6u )
+      {
+        tt[i]._bits = expand_truth_table_word( cuts._truth_tables[( *cut )->func_id]._bits, NumVars, cut->begin(), cut->end(), res.begin(), res.end() ) & truth_table_word_mask( NumVars );
+      }
+      else
+      {
+        tt[i] = cuts._truth_tables[( *cut )->func_id];
+        const auto supp = cuts.compute_truth_table_support( *cut, res );
+        kitty::expand_inplace( tt[i], supp );
+      }
       ++i;
     }
 
@@ -1404,19 +1797,36 @@ private:
 
     if ( ps.minimize_truth_table && !fast_support_minimization( tt_res, res ) )
     {
-      const auto support = kitty::min_base_inplace( tt_res );
-      if ( support.size() != res.size() )
+      if constexpr ( NumVars <= 6u )
       {
-        std::vector<uint32_t> leaves_before( res.begin(), res.end() );
-        std::vector<uint32_t> leaves_after( support.size() );
-
-        auto it_support = support.begin();
-        auto it_leaves = leaves_after.begin();
-        while ( it_support != support.end() )
+        std::array<uint8_t, 6u> support;
+        auto const num_vars = min_base_truth_table_word( tt_res._bits, NumVars, support );
+        if ( num_vars != res.size() )
         {
-          *it_leaves++ = leaves_before[*it_support++];
+          std::array<uint32_t, 6u> leaves;
+          for ( auto j = 0u; j < num_vars; ++j )
+          {
+            leaves[j] = *( res.begin() + support[j] );
+          }
+          res.set_leaves( leaves.begin(), leaves.begin() + num_vars );
+        }
+      }
+      else
+      {
+        const auto support = kitty::min_base_inplace( tt_res );
+        if ( support.size() != res.size() )
+        {
+          std::vector<uint32_t> leaves_before( res.begin(), res.end() );
+          std::vector<uint32_t> leaves_after( support.size() );
+
+          auto it_support = support.begin();
+          auto it_leaves = leaves_after.begin();
+          while ( it_support != support.end() )
+          {
+            *it_leaves++ = leaves_before[*it_support++];
+          }
+          res.set_leaves( leaves_after.begin(), leaves_after.end() );
         }
-        res.set_leaves( leaves_after.begin(), leaves_after.end() );
       }
     }
 
@@ -1579,6 +1989,7 @@ private:
   dynamic_network_cuts<Ntk, NumVars, ComputeTruth, CutData>& cuts;
 
   std::array<cut_set_t*, Ntk::max_fanin_size + 1> lcuts;
+  std::vector<kitty::static_truth_table<NumVars>> fanin_tts;
 };
 } /* namespace detail */
 /*! \endcond */
@@ -54,6 +54,7 @@
 #include "../utils/node_map.hpp"
 #include "../utils/stopwatch.hpp"
 #include "../utils/tech_library.hpp"
+#include "../utils/truth_table_utils.hpp"
 #include "../views/binding_view.hpp"
 #include "../views/cell_view.hpp"
 #include "../views/choice_view.hpp"
@@ -771,7 +772,6 @@ public:
   using cut_set_t = emap_cut_set<cut_t, max_cut_num>;
   using cut_merge_t = typename std::array<cut_set_t*, Ntk::max_fanin_size + 1>;
   using fanin_cut_t = typename std::array<cut_t const*, Ntk::max_fanin_size>;
-  using support_t = typename std::array<uint8_t, CutSize>;
   using TT = kitty::static_truth_table<6>;
   using truth_compute_t = typename std::array<TT, CutSize>;
   using node_match_t = std::vector<node_match_emap<NInputs>>;
@@ -4808,30 +4808,6 @@ private:
     cut->flow = best_area_flow / ntk.fanout_size( n );
   }
 
-  /* compute positions of leave indices in cut `sub` (subset) with respect to
-   * leaves in cut `sup` (super set).
-   *
-   * Example:
-   *   compute_truth_table_support( {1, 3, 6}, {0, 1, 2, 3, 6, 7} ) = {1, 3, 4}
-   */
-  void compute_truth_table_support( cut_t const& sub, cut_t const& sup, TT& tt )
-  {
-    size_t j = 0;
-    auto itp = sup.begin();
-    for ( auto i : sub )
-    {
-      itp = std::find( itp, sup.end(), i );
-      lsupport[j++] = static_cast<uint8_t>( std::distance( sup.begin(), itp ) );
-    }
-
-    /* swap variables in the truth table */
-    for ( int i = j - 1; i >= 0; --i )
-    {
-      assert( i <= lsupport[i] );
-      kitty::swap_inplace( tt, i, lsupport[i] );
-    }
-  }
-
   void add_zero_cut( uint32_t index )
   {
     auto& cut = cuts[index].add_cut( &index, &index ); /* fake iterator for emptyness */
@@ -4905,8 +4881,9 @@ private:
     /* variables not in the support are the most significative */
     if ( support_size != res.size() )
     {
-      std::vector<uint32_t> leaves( res.begin(), res.begin() + support_size );
-      res.set_leaves( leaves.begin(), leaves.end() );
+      std::array<uint32_t, CutSize> leaves;
+      std::copy( res.begin(), res.begin() + support_size, leaves.begin() );
+      res.set_leaves( leaves.begin(), leaves.begin() + support_size );
     }
 
     return true;
@@ -4917,26 +4894,22 @@ private:
     for ( uint32_t i = 0; i < fanin; ++i )
     {
       cut_t const* cut = vcuts[i];
-      ltruth[i] = ( *cut )->function;
-      compute_truth_table_support( *cut, res, ltruth[i] );
+      ltruth[i]._bits = expand_truth_table_word( ( *cut )->function._bits, 6u, cut->begin(), cut->end(), res.begin(), res.end() );
     }
 
     auto tt_res = ntk.compute( ntk.index_to_node( index ), ltruth.begin(), ltruth.begin() + fanin );
 
     if ( ps.cut_enumeration_ps.minimize_truth_table && !fast_support_minimization( tt_res, res ) )
     {
-      const auto support = kitty::min_base_inplace( tt_res );
-
-      std::vector<uint32_t> leaves_before( res.begin(), res.end() );
-      std::vector<uint32_t> leaves_after( support.size() );
+      std::array<uint8_t, 6u> support;
+      auto const num_vars = min_base_truth_table_word( tt_res._bits, res.size(), support );
 
-      auto it_support = support.begin();
-      auto it_leaves = leaves_after.begin();
-      while ( it_support != support.end() )
+      std::array<uint32_t, CutSize> leaves;
+      for ( auto i = 0u; i < num_vars; ++i )
       {
-        *it_leaves++ = leaves_before[*it_support++];
+        leaves[i] = *( res.begin() + support[i] );
       }
-      res.set_leaves( leaves_after.begin(), leaves_after.end() );
+      res.set_leaves( leaves.begin(), leaves.begin() + num_vars );
     }
 
     res->function = tt_res;
@@ -5729,7 +5702,6 @@ private:
   cut_merge_t lcuts;           /* cut merger container */
   cut_set_t temp_cuts;         /* temporary cut set container */
   truth_compute_t ltruth;      /* truth table merger container */
-  support_t lsupport;          /* support merger container */
   uint32_t cuts_total{ 0 };    /* current computed cuts */
 
   /* multi-output matching */
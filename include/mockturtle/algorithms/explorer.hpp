@@ -354,7 +354,9 @@ mig_network explore_mig( mig_network const& ntk, explorer_params const ps = {} )
   } );
 
   expl.add_compressing_script( []( Ntk& _ntk, uint32_t i, uint32_t rand ){
-    depth_view depth_mig{ _ntk };
+    depth_view_params dps;
+    dps.incremental = true;
+    depth_view<Ntk> depth_mig{ _ntk, {}, dps };
     mig_algebraic_depth_rewriting( depth_mig );
     _ntk = cleanup_dangling( _ntk );
   } );
@@ -723,7 +725,9 @@ mig_network deepsyn_mig_depth( mig_network const& ntk, explorer_params const ps
   } );
 
   expl.add_compressing_script( []( Ntk& _ntk, uint32_t i, uint32_t rand ){
-    depth_view depth_mig{ _ntk };
+    depth_view_params dps;
+    dps.incremental = true;
+    depth_view<Ntk> depth_mig{ _ntk, {}, dps };
     mig_algebraic_depth_rewriting( depth_mig );
     _ntk = cleanup_dangling( _ntk );
   } );
@@ -844,7 +848,9 @@ mig_network deepsyn_aqfp( mig_network const& ntk, explorer_params const ps = {},
 
   // algebraic depth optimization
   expl.add_compressing_script( []( Ntk& _ntk, uint32_t i, uint32_t rand ){
-    depth_view depth_mig{ _ntk };
+    depth_view_params dps;
+    dps.incremental = true;
+    depth_view<Ntk> depth_mig{ _ntk, {}, dps };
     mig_algebraic_depth_rewriting( depth_mig );
     _ntk = cleanup_dangling( _ntk );
   } );
@@ -985,7 +991,9 @@ mig_network explore_aqfp( mig_network const& ntk, explorer_params const ps = {}
 
   // algebraic depth optimization
   expl.add_compressing_script( []( Ntk& _ntk, uint32_t i, uint32_t rand ){
-    depth_view depth_mig{ _ntk };
+    depth_view_params dps;
+    dps.incremental = true;
+    depth_view<Ntk> depth_mig{ _ntk, {}, dps };
     mig_algebraic_depth_rewriting( depth_mig );
     _ntk = cleanup_dangling( _ntk );
   }, 0.5 );
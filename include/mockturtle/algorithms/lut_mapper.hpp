@@ -46,6 +46,7 @@
 #include <kitty/esop.hpp>
 #include <kitty/isop.hpp>
 #include <kitty/operations.hpp>
+#include <kitty/static_truth_table.hpp>
 
 #include "../networks/klut.hpp"
 #include "../utils/cost_functions.hpp"
@@ -53,6 +54,7 @@
 #include "../utils/node_map.hpp"
 #include "../utils/stopwatch.hpp"
 #include "../utils/truth_table_cache.hpp"
+#include "../utils/truth_table_utils.hpp"
 #include "../views/choice_view.hpp"
 #include "../views/mapping_view.hpp"
 #include "../views/mffc_view.hpp"
@@ -2080,6 +2082,14 @@ private:
   {
     // stopwatch t( st.cut_enumeration_st.time_truth_table ); /* runtime optimized */
 
+    if constexpr ( has_compute_v<Ntk, kitty::static_truth_table<6u>> )
+    {
+      if ( res.size() <= 6u )
+      {
+        return compute_truth_table_word( index, vcuts, res );
+      }
+    }
+
     std::vector<TT> tt( vcuts.size() );
     auto i = 0;
     for ( auto const& cut : vcuts )
@@ -2114,6 +2124,38 @@ private:
     return truth_tables.insert( tt_res );
   }
 
+  /* truth table computation for cuts with at most 6 leaves on 64-bit words */
+  uint32_t compute_truth_table_word( uint32_t index, std::vector<cut_t const*> const& vcuts, cut_t& res )
+  {
+    word_tts.resize( vcuts.size() );
+    auto i = 0u;
+    for ( auto const& cut : vcuts )
+    {
+      auto const func_id = ( *cut )->func_id;
+      word_tts[i++]._bits = expand_truth_table_word( truth_tables.word( func_id ), truth_tables.num_vars( func_id ), cut->begin(), cut->end(), res.begin(), res.end() );
+    }
+
+    auto tt_res = ntk.compute( ntk.index_to_node( index ), word_tts.begin(), word_tts.end() )._bits & truth_table_word_mask( res.size() );
+
+    if ( ps.cut_enumeration_ps.minimize_truth_table )
+    {
+      std::array<uint8_t, 6u> support;
+      auto const num_vars = min_base_truth_table_word( tt_res, res.size(), support );
+      if ( num_vars != res.size() )
+      {
+        std::array<uint32_t, 6u> leaves;
+        for ( auto j = 0u; j < num_vars; ++j )
+        {
+          leaves[j] = *( res.begin() + support[j] );
+        }
+        res.set_leaves( leaves.begin(), leaves.begin() + num_vars );
+        return truth_tables.insert_word( tt_res, num_vars );
+      }
+    }
+
+    return truth_tables.insert_word( tt_res, res.size() );
+  }
+
   void compute_mffcs_mapping()
   {
     ntk.clear_mapping();
@@ -2848,6 +2890,8 @@ private:
   tt_cache truth_tables;        /* cut truth tables */
   cost_cache truth_tables_cost; /* truth tables cost */
   isop_cache isops;             /* cache for isops */
+
+  std::vector<kitty::static_truth_table<6u>> word_tts; /* fanin functions of cuts with at most 6 leaves */
 };
 #pragma endregion
 
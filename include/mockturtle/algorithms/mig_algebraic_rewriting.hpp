@@ -83,6 +83,14 @@ struct mig_algebraic_depth_rewriting_params
 
   /*! \brief Allow area increase while optimizing depth. */
   bool allow_area_increase{ true };
+
+  /*! \brief Use the network's fanout index during substitutions.
+   *
+   * If the network supports `build_fanout_index` and has no index yet, it is
+   * built before rewriting and cleared afterwards, such that every
+   * `substitute_node` only visits the fanouts of the replaced node.
+   */
+  bool use_fanout_index{ true };
 };
 
 /*! \brief Statistics for mig_algebraic_depth_rewriting. */
@@ -322,6 +330,10 @@ private:
  * only considers pairs of nodes which both implement the majority-of-3
  * function.
  *
+ * Levels are updated after every rewrite.  When `ntk` is a `depth_view`
+ * constructed with `depth_view_params::incremental`, these updates only
+ * touch the fanout cones of the rewritten nodes.
+ *
  * **Required network functions:**
  * - `get_node`
  * - `level`
@@ -363,10 +375,28 @@ void mig_algebraic_depth_rewriting( Ntk& ntk, mig_algebraic_depth_rewriting_para
   static_assert( has_value_v<Ntk>, "Ntk does not implement the value method" );
   static_assert( has_fanout_size_v<Ntk>, "Ntk does not implement the fanout_size method" );
 
+  bool build_index = false;
+  if constexpr ( has_build_fanout_index_v<Ntk> )
+  {
+    build_index = ps.use_fanout_index && !ntk.has_fanout_index();
+    if ( build_index )
+    {
+      ntk.build_fanout_index();
+    }
+  }
+
   mig_algebraic_depth_rewriting_stats st;
   detail::mig_algebraic_depth_rewriting_impl<Ntk> p( ntk, ps, st );
   p.run();
 
+  if constexpr ( has_build_fanout_index_v<Ntk> )
+  {
+    if ( build_index )
+    {
+      ntk.clear_fanout_index();
+    }
+  }
+
   if ( pst )
   {
     *pst = st;
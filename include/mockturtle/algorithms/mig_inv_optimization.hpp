@@ -318,22 +318,20 @@ private:
     if ( index >= .9 * ntk._storage->nodes.capacity() )
     {
       ntk._storage->nodes.reserve( static_cast<uint64_t>( 3.1415f * index ) );
-      ntk._storage->hash.reserve( static_cast<uint64_t>( 3.1415f * index ) );
     }
 
     ntk._storage->nodes.push_back( nd );
 
     ntk._storage->hash[nd] = index;
+    ntk._storage->fanouts.add_node();
+    ntk._storage->fanouts.add_fanins( index, nd.children );
 
     /* increase ref-count to children */
     ntk._storage->nodes[a.index].data[0].h1++;
     ntk._storage->nodes[b.index].data[0].h1++;
     ntk._storage->nodes[c.index].data[0].h1++;
 
-    for ( auto const& fn : ntk._events->on_add )
-    {
-      ( *fn )( index );
-    }
+    ntk._events->notify_add( index );
 
     return { index, 0 };
   }
@@ -39,12 +39,13 @@
 #include <vector>
 
 #include <kitty/dynamic_truth_table.hpp>
-#include <kitty/npn.hpp>
 #include <kitty/print.hpp>
+#include <kitty/static_truth_table.hpp>
 
 #include "../../algorithms/cleanup.hpp"
 #include "../../networks/mig.hpp"
 #include "../../traits.hpp"
+#include "../../utils/npn4_table.hpp"
 #include "../../views/topo_view.hpp"
 
 namespace mockturtle
@@ -93,22 +94,22 @@ public:
   void operator()( mig_network& mig, kitty::dynamic_truth_table const& function, LeavesIterator begin, LeavesIterator end, Fn&& fn ) const
   {
     assert( function.num_vars() <= 4 );
-    const auto fe = kitty::extend_to( function, 4 );
-    const auto config = kitty::exact_npn_canonization( fe );
+    const auto fe = kitty::extend_to<4u>( function );
+    auto const& config = npn4_table::get()[fe];
 
-    const auto it = class2signal.find( static_cast<uint16_t>( std::get<0>( config )._bits[0] ) );
+    const auto it = class2signal.find( config.representative );
 
     std::vector<mig_network::signal> pis( 4, mig.get_constant( false ) );
     std::copy( begin, end, pis.begin() );
 
     std::vector<mig_network::signal> pis_perm( 4 );
-    auto perm = std::get<2>( config );
+    auto const& perm = config.perm;
     for ( auto i = 0; i < 4; ++i )
     {
       pis_perm[i] = pis[perm[i]];
     }
 
-    const auto& phase = std::get<1>( config );
+    const auto phase = config.phase;
     for ( auto i = 0; i < 4; ++i )
     {
       if ( ( phase >> perm[i] ) & 1 )
@@ -49,6 +49,7 @@
 #include "../../networks/xag.hpp"
 #include "../../utils/index_list/index_list.hpp"
 #include "../../utils/node_map.hpp"
+#include "../../utils/npn4_table.hpp"
 #include "../../utils/stopwatch.hpp"
 
 namespace mockturtle
@@ -111,8 +112,7 @@ class xag_npn_resynthesis
 public:
   xag_npn_resynthesis( xag_npn_resynthesis_params const& ps = {}, xag_npn_resynthesis_stats* pst = nullptr )
       : ps( ps ),
-        pst( pst ),
-        _repr( 1u << 16u )
+        pst( pst )
   {
     static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
     static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant method" );
@@ -154,12 +154,14 @@ public:
   {
     kitty::static_truth_table<4u> tt = kitty::extend_to<4u>( function );
 
-    /* get representative of function */
-    const auto [repr, phase, perm] = _repr[*tt.cbegin()];
+    /* get NPN class of function */
+    auto const& config = npn4_table::get()[tt];
+    auto const phase = config.phase;
+    auto const& perm = config.perm;
 
     /* check if representative has circuits */
-    const auto it = _repr_to_signal.find( repr );
-    if ( it == _repr_to_signal.end() )
+    auto const& candidates = _class_to_signals[config.class_index];
+    if ( candidates.empty() )
     {
       return;
     }
@@ -174,7 +176,7 @@ public:
       db_to_ntk.insert( { i + 1, ( phase >> perm[i] & 1 ) ? ntk.create_not( pis[perm[i]] ) : pis[perm[i]] } );
     }
 
-    for ( auto const& cand : it->second )
+    for ( auto const& cand : candidates )
     {
       const auto f = copy_db_entry( ntk, _db.get_node( cand ), db_to_ntk );
       if ( !fn( _db.is_complemented( cand ) != ( phase >> 4 & 1 ) ? ntk.create_not( f ) : f ) )
@@ -208,12 +210,8 @@ private:
   {
     stopwatch t( st.time_classes );
 
-    kitty::static_truth_table<4u> tt;
-    do
-    {
-      _repr[*tt.cbegin()] = kitty::exact_npn_canonization( tt );
-      kitty::next_inplace( tt );
-    } while ( !kitty::is_const0( tt ) );
+    /* the classification is shared and only built by the first instance */
+    _class_to_signals.resize( npn4_table::get().num_classes() );
   }
 
   void build_db()
@@ -234,45 +232,29 @@ private:
     }
     const auto sim_res = simulate_nodes<kitty::static_truth_table<4u>>( _db );
 
+    auto const& classes = npn4_table::get();
     _db.foreach_node( [&]( auto n ) {
-      if ( std::get<0>( _repr[*sim_res[n].cbegin()] ) == sim_res[n] )
+      /* a function and its complement are in the same class */
+      auto const& config = classes[sim_res[n]];
+      if ( config.representative == *sim_res[n].cbegin() )
       {
-        if ( _repr_to_signal.count( sim_res[n] ) == 0 )
-        {
-          _repr_to_signal.insert( { sim_res[n], { _db.make_signal( n ) } } );
-        }
-        else
-        {
-          _repr_to_signal[sim_res[n]].push_back( _db.make_signal( n ) );
-        }
+        _class_to_signals[config.class_index].push_back( _db.make_signal( n ) );
       }
-      else
+      else if ( config.representative == ( ~*sim_res[n].cbegin() & 0xffff ) )
       {
-        const auto f = ~sim_res[n];
-        if ( std::get<0>( _repr[*f.cbegin()] ) == f )
-        {
-          if ( _repr_to_signal.count( f ) == 0 )
-          {
-            _repr_to_signal.insert( { f, { !_db.make_signal( n ) } } );
-          }
-          else
-          {
-            _repr_to_signal[f].push_back( !_db.make_signal( n ) );
-          }
-        }
+        _class_to_signals[config.class_index].push_back( !_db.make_signal( n ) );
       }
     } );
 
     st.db_size = _db.size();
-    st.covered_classes = static_cast<uint32_t>( _repr_to_signal.size() );
+    st.covered_classes = static_cast<uint32_t>( std::count_if( _class_to_signals.begin(), _class_to_signals.end(), []( auto const& v ) { return !v.empty(); } ) );
   }
 
   xag_npn_resynthesis_params ps;
   xag_npn_resynthesis_stats st;
   xag_npn_resynthesis_stats* pst{ nullptr };
 
-  std::vector<std::tuple<kitty::static_truth_table<4u>, uint32_t, std::vector<uint8_t>>> _repr;
-  std::unordered_map<kitty::static_truth_table<4u>, std::vector<signal<DatabaseNtk>>, kitty::hash<kitty::static_truth_table<4u>>> _repr_to_signal;
+  std::vector<std::vector<signal<DatabaseNtk>>> _class_to_signals;
 
   DatabaseNtk _db;
 
@@ -50,6 +50,7 @@
 #include "../../io/write_bench.hpp"
 #include "../../networks/xmg.hpp"
 #include "../../utils/node_map.hpp"
+#include "../../utils/npn4_table.hpp"
 #include "../../utils/stopwatch.hpp"
 #include "../../views/topo_view.hpp"
 
@@ -106,8 +107,7 @@ class xmg3_npn_resynthesis
 public:
   xmg3_npn_resynthesis( xmg3_npn_resynthesis_params const& ps = {}, xmg3_npn_resynthesis_stats* pst = nullptr )
       : ps( ps ),
-        pst( pst ),
-        _classes( 1 << 16 )
+        pst( pst )
   {
     static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
     static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant method" );
@@ -127,7 +127,6 @@ public:
     static_assert( has_foreach_node_v<DatabaseNtk>, "DatabaseNtk does not implement the foreach_node method" );
     static_assert( has_make_signal_v<DatabaseNtk>, "DatabaseNtk does not implement the make_signal method" );
 
-    _repr.reserve( 222u );
     build_classes();
     build_db();
   }
@@ -150,31 +149,27 @@ public:
   {
     kitty::static_truth_table<4u> tt = kitty::extend_to<4u>( function );
 
-    /* get representative of function */
-    const auto repr = _repr[_classes[*tt.cbegin()]];
+    /* get NPN class of function */
+    auto const& config = npn4_table::get()[tt];
 
     /* check if representative has circuits */
-    const auto it = _repr_to_signal.find( repr );
-    if ( it == _repr_to_signal.end() )
+    auto const& candidates = _class_to_signals[config.class_index];
+    if ( candidates.empty() )
     {
       return;
     }
 
-    const auto config = kitty::exact_npn_canonization( tt );
-
-    assert( repr == std::get<0>( config ) );
-
     std::vector<signal<Ntk>> pis( 4, ntk.get_constant( false ) );
     std::copy( begin, end, pis.begin() );
 
     std::vector<signal<Ntk>> pis_perm;
-    auto perm = std::get<2>( config );
+    auto const& perm = config.perm;
     for ( auto i = 0; i < 4; ++i )
     {
       pis_perm.push_back( pis[perm[i]] );
     }
 
-    const auto& phase = std::get<1>( config );
+    const auto phase = config.phase;
     for ( auto i = 0; i < 4; ++i )
     {
       if ( ( phase >> perm[i] ) & 1 )
@@ -183,7 +178,7 @@ public:
       }
     }
 
-    for ( auto const& cand : it->second )
+    for ( auto const& cand : candidates )
     {
       std::unordered_map<node<DatabaseNtk>, signal<Ntk>> db_to_ntk;
 
@@ -233,23 +228,8 @@ private:
   {
     stopwatch t( st.time_classes );
 
-    kitty::dynamic_truth_table map( 16u );
-    std::transform( map.cbegin(), map.cend(), map.begin(), []( auto word ) { return ~word; } );
-
-    int64_t index = 0;
-    kitty::static_truth_table<4u> tt;
-    while ( index != -1 )
-    {
-      kitty::create_from_words( tt, &index, &index + 1 );
-      const auto res = kitty::exact_npn_canonization( tt, [&]( const auto& tt ) {
-        _classes[*tt.cbegin()] = _repr.size();
-        kitty::clear_bit( map, *tt.cbegin() );
-      } );
-      _repr.push_back( std::get<0>( res ) );
-
-      /* find next non-classified truth table */
-      index = find_first_one_bit( map );
-    }
+    /* the classification is shared and only built by the first instance */
+    _class_to_signals.resize( npn4_table::get().num_classes() );
   }
 
   void build_db()
@@ -292,46 +272,29 @@ private:
 
     const auto sim_res = simulate_nodes<kitty::static_truth_table<4u>>( _db );
 
+    auto const& classes = npn4_table::get();
     _db.foreach_node( [&]( auto n ) {
-      if ( _repr[_classes[*sim_res[n].cbegin()]] == sim_res[n] )
+      /* a function and its complement are in the same class */
+      auto const& config = classes[sim_res[n]];
+      if ( config.representative == *sim_res[n].cbegin() )
       {
-        if ( _repr_to_signal.count( sim_res[n] ) == 0 )
-        {
-          _repr_to_signal.insert( { sim_res[n], { _db.make_signal( n ) } } );
-        }
-        else
-        {
-          _repr_to_signal[sim_res[n]].push_back( _db.make_signal( n ) );
-        }
+        _class_to_signals[config.class_index].push_back( _db.make_signal( n ) );
       }
-      else
+      else if ( config.representative == ( ~*sim_res[n].cbegin() & 0xffff ) )
       {
-        const auto f = ~sim_res[n];
-        if ( _repr[_classes[*f.cbegin()]] == f )
-        {
-          if ( _repr_to_signal.count( f ) == 0 )
-          {
-            _repr_to_signal.insert( { f, { !_db.make_signal( n ) } } );
-          }
-          else
-          {
-            _repr_to_signal[f].push_back( !_db.make_signal( n ) );
-          }
-        }
+        _class_to_signals[config.class_index].push_back( !_db.make_signal( n ) );
       }
     } );
 
     st.db_size = _db.size();
-    st.covered_classes = static_cast<uint32_t>( _repr_to_signal.size() );
+    st.covered_classes = static_cast<uint32_t>( std::count_if( _class_to_signals.begin(), _class_to_signals.end(), []( auto const& v ) { return !v.empty(); } ) );
   }
 
   xmg3_npn_resynthesis_params ps;
   xmg3_npn_resynthesis_stats st;
   xmg3_npn_resynthesis_stats* pst{ nullptr };
 
-  std::vector<kitty::static_truth_table<4u>> _repr;
-  std::vector<uint32_t> _classes;
-  std::unordered_map<kitty::static_truth_table<4u>, std::vector<signal<DatabaseNtk>>, kitty::hash<kitty::static_truth_table<4u>>> _repr_to_signal;
+  std::vector<std::vector<signal<DatabaseNtk>>> _class_to_signals;
 
   DatabaseNtk _db;
 
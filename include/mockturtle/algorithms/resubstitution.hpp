@@ -79,6 +79,14 @@ struct resubstitution_params
   /*! \brief Be verbose. */
   bool verbose{ false };
 
+  /*! \brief Use the fanout index of the network (if it has one) for substitution.
+   *
+   * Each substitution then notifies views of its changes in one batch of
+   * events.  Fanouts are visited in index order, which may lead to
+   * different results when substitutions cause structural hashing.
+   */
+  bool use_fanout_index{ false };
+
   /****** window-based resub engine ******/
 
   /*! \brief Use don't cares for optimization. Only used by window-based resub engine. */
@@ -171,6 +179,19 @@ namespace detail
 template<typename Ntk>
 bool substitute_fn( Ntk& ntk, typename Ntk::node const& n, typename Ntk::signal const& g )
 {
+  if constexpr ( has_build_fanout_index_v<Ntk> )
+  {
+    /* fanouts are found in the index, hence views can observe the
+     * substitution as one batch of events */
+    if ( ntk.has_fanout_index() )
+    {
+      ntk.events().begin_batch();
+      ntk.substitute_node( n, g );
+      ntk.events().commit_batch();
+      return true;
+    }
+  }
+
   ntk.substitute_node( n, g );
   return true;
 }
@@ -628,6 +649,15 @@ public:
 
     st.initial_size = ntk.num_gates();
 
+    if constexpr ( has_build_fanout_index_v<Ntk> )
+    {
+      build_index = ps.use_fanout_index && !ntk.has_fanout_index();
+      if ( build_index )
+      {
+        ntk.build_fanout_index();
+      }
+    }
+
     register_events();
   }
 
@@ -636,6 +666,14 @@ public:
     ntk.events().release_add_event( add_event );
     ntk.events().release_modified_event( modified_event );
     ntk.events().release_delete_event( delete_event );
+
+    if constexpr ( has_build_fanout_index_v<Ntk> )
+    {
+      if ( build_index )
+      {
+        ntk.clear_fanout_index();
+      }
+    }
   }
 
   void run( resub_callback_t const& callback = substitute_fn<Ntk> )
@@ -772,6 +810,9 @@ private:
   uint32_t candidates{ 0 };
   uint32_t last_gain{ 0 };
 
+  /* whether the fanout index was built for this run */
+  bool build_index{ false };
+
   /* events */
   std::shared_ptr<typename network_events<Ntk>::add_event_type> add_event;
   std::shared_ptr<typename network_events<Ntk>::modified_event_type> modified_event;
@@ -35,6 +35,7 @@
 #include "../traits.hpp"
 #include "../utils/cost_functions.hpp"
 #include "../utils/node_map.hpp"
+#include "../utils/npn4_table.hpp"
 #include "../utils/stopwatch.hpp"
 #include "../views/color_view.hpp"
 #include "../views/depth_view.hpp"
@@ -130,17 +131,6 @@ public:
   rewrite_impl( Ntk& ntk, Library&& library, rewrite_params const& ps, rewrite_stats& st, NodeCostFn const& cost_fn )
       : ntk( ntk ), library( library ), ps( ps ), st( st ), cost_fn( cost_fn ), required( ntk, UINT32_MAX )
   {
-    register_events();
-  }
-
-  ~rewrite_impl()
-  {
-    if constexpr ( has_level_v<Ntk> )
-    {
-      ntk.events().release_add_event( add_event );
-      ntk.events().release_modified_event( modified_event );
-      ntk.events().release_delete_event( delete_event );
-    }
   }
 
   void run()
@@ -190,17 +180,12 @@ private:
       uint32_t best_level = UINT32_MAX;
       bool best_phase = false;
 
-      /* update level for node */
+      /* levels are kept up to date by the incremental depth view */
       if constexpr ( has_level_v<Ntk> )
       {
         if ( ps.preserve_depth )
         {
-          uint32_t level = 0;
-          ntk.foreach_fanin( n, [&]( auto const& f ) {
-            level = std::max( level, ntk.level( ntk.get_node( f ) ) );
-          } );
-          ntk.set_level( n, level + 1 );
-          best_level = level + 1;
+          best_level = ntk.level( n );
         }
       }
 
@@ -218,10 +203,11 @@ private:
         }
 
         /* Boolean matching */
-        auto config = kitty::exact_npn_canonization( cuts.truth_table( *cut ) );
-        auto tt_npn = std::get<0>( config );
-        auto neg = std::get<1>( config );
-        auto perm = std::get<2>( config );
+        auto const& config = npn4_table::get()[cuts.truth_table( *cut )];
+        kitty::static_truth_table<num_vars> tt_npn;
+        tt_npn._bits = config.representative;
+        uint32_t const neg = config.phase;
+        auto const& perm = config.perm;
 
         auto const structures = library.get_supergates( tt_npn );
 
@@ -316,7 +302,12 @@ private:
         assert( n != ntk.get_node( new_f ) );
 
         _estimated_gain += best_gain;
+
+        /* the fanouts of `n` are collected before the first change, hence
+         * the views can observe the substitution as one batch of events */
+        ntk.events().begin_batch();
         ntk.substitute_node_no_restrash( n, new_f ^ best_phase );
+        ntk.events().commit_batch();
 
         if constexpr ( has_level_v<Ntk> )
         {
@@ -372,17 +363,12 @@ private:
       uint32_t best_level = UINT32_MAX;
       bool best_phase = false;
 
-      /* update level for node */
+      /* levels are kept up to date by the incremental depth view */
       if constexpr ( has_level_v<Ntk> )
       {
         if ( ps.preserve_depth )
         {
-          uint32_t level = 0;
-          ntk.foreach_fanin( n, [&]( auto const& f ) {
-            level = std::max( level, ntk.level( ntk.get_node( f ) ) );
-          } );
-          ntk.set_level( n, level + 1 );
-          best_level = level + 1;
+          best_level = ntk.level( n );
         }
       }
 
@@ -410,10 +396,11 @@ private:
         }
 
         /* Boolean matching */
-        auto config = kitty::exact_npn_canonization( cuts.truth_table( *cut ) );
-        auto tt_npn = std::get<0>( config );
-        auto neg = std::get<1>( config );
-        auto perm = std::get<2>( config );
+        auto const& config = npn4_table::get()[cuts.truth_table( *cut )];
+        kitty::static_truth_table<num_vars> tt_npn;
+        tt_npn._bits = config.representative;
+        uint32_t neg = config.phase;
+        std::vector<uint8_t> perm( config.perm.begin(), config.perm.end() );
 
         kitty::static_truth_table<num_vars> care;
 
@@ -542,7 +529,12 @@ private:
         assert( n != ntk.get_node( new_f ) );
 
         _estimated_gain += best_gain;
+
+        /* the fanouts of `n` are collected before the first change, hence
+         * the views can observe the substitution as one batch of events */
+        ntk.events().begin_batch();
         ntk.substitute_node_no_restrash( n, new_f ^ best_phase );
+        ntk.events().commit_batch();
 
         if constexpr ( has_level_v<Ntk> )
         {
@@ -798,65 +790,6 @@ private:
     } );
   }
 
-private:
-  void register_events()
-  {
-    if constexpr ( has_level_v<Ntk> )
-    {
-      auto const update_level_of_new_node = [&]( const auto& n ) {
-        ntk.resize_levels();
-        update_node_level( n );
-      };
-
-      auto const update_level_of_existing_node = [&]( node<Ntk> const& n, const auto& old_children ) {
-        (void)old_children;
-        ntk.resize_levels();
-        update_node_level( n );
-      };
-
-      auto const update_level_of_deleted_node = [&]( node<Ntk> const& n ) {
-        ntk.set_level( n, -1 );
-      };
-
-      add_event = ntk.events().register_add_event( update_level_of_new_node );
-      modified_event = ntk.events().register_modified_event( update_level_of_existing_node );
-      delete_event = ntk.events().register_delete_event( update_level_of_deleted_node );
-    }
-  }
-
-  /* maybe it should be moved to depth_view */
-  void update_node_level( node<Ntk> const& n, bool top_most = true )
-  {
-    if constexpr ( has_level_v<Ntk> )
-    {
-      uint32_t curr_level = ntk.level( n );
-
-      uint32_t max_level = 0;
-      ntk.foreach_fanin( n, [&]( const auto& f ) {
-        auto const p = ntk.get_node( f );
-        auto const fanin_level = ntk.level( p );
-        if ( fanin_level > max_level )
-        {
-          max_level = fanin_level;
-        }
-      } );
-      ++max_level;
-
-      if ( curr_level != max_level )
-      {
-        ntk.set_level( n, max_level );
-
-        /* update only one more level */
-        if ( top_most )
-        {
-          ntk.foreach_fanout( n, [&]( const auto& p ) {
-            update_node_level( p, false );
-          } );
-        }
-      }
-    }
-  }
-
 private:
   Ntk& ntk;
   Library&& library;
@@ -868,11 +801,6 @@ private:
 
   uint32_t _candidates{ 0 };
   uint32_t _estimated_gain{ 0 };
-
-  /* events */
-  std::shared_ptr<typename network_events<Ntk>::add_event_type> add_event;
-  std::shared_ptr<typename network_events<Ntk>::modified_event_type> modified_event;
-  std::shared_ptr<typename network_events<Ntk>::delete_event_type> delete_event;
 };
 
 } /* namespace detail */
@@ -883,6 +811,9 @@ private:
  * The algorithm performs changes in-place and keeps the substituted structures dangling
  * in the network.
  *
+ * With `preserve_depth`, levels are maintained by an incremental `depth_view`,
+ * also if `ntk` already implements `level` (whose levels are then not used).
+ *
  * **Required network functions:**
  * - `get_node`
  * - `size`
@@ -920,12 +851,16 @@ void rewrite( Ntk& ntk, Library&& library, rewrite_params const& ps = {}, rewrit
 
   if ( ps.preserve_depth || ps.use_dont_cares )
   {
-    using depth_view_t = depth_view<Ntk, NodeCostFn>;
-    depth_view_t depth_ntk{ ntk };
-    using fanout_view_t = fanout_view<depth_view_t>;
-    fanout_view_t fanout_view{ depth_ntk };
+    /* the depth view propagates level changes along the fanouts of the fanout view;
+     * it does not reuse the levels of `ntk`, which may not be updated on events */
+    using fanout_view_t = fanout_view<Ntk>;
+    using depth_view_t = depth_view<fanout_view_t, NodeCostFn, false>;
+    depth_view_params dps;
+    dps.incremental = true;
+    fanout_view_t fanout_ntk{ ntk };
+    depth_view_t depth_ntk{ fanout_ntk, cost_fn, dps };
 
-    detail::rewrite_impl<fanout_view_t, Library, NodeCostFn> p( fanout_view, library, ps, st, cost_fn );
+    detail::rewrite_impl<depth_view_t, Library, NodeCostFn> p( depth_ntk, library, ps, st, cost_fn );
     p.run();
   }
   else
@@ -35,13 +35,23 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
 #include <cstdint>
 #include <fstream>
+#include <limits>
 #include <random>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "../traits.hpp"
 #include "../utils/node_map.hpp"
+#include "../utils/simd.hpp"
+#include "../views/topo_view.hpp"
 
 #include <kitty/bit_operations.hpp>
 #include <kitty/constructors.hpp>
@@ -258,6 +268,25 @@ public:
     return num_patterns;
   }
 
+  /*! \brief Copy a block of simulation patterns of a primary input.
+   *
+   * Copies the patterns `first`, ..., `first + tt.num_bits() - 1` of the
+   * primary input `index` into `tt`.
+   *
+   * \param index Index of the primary input.
+   * \param first Index of the first pattern, must be a multiple of 64.
+   * \param tt Partial truth table that receives the patterns.
+   */
+  void compute_pi_block( uint32_t index, uint32_t first, kitty::partial_truth_table& tt ) const
+  {
+    assert( first % 64u == 0u );
+    assert( first + tt.num_bits() <= patterns.at( index ).num_bits() );
+
+    auto const& pattern = patterns.at( index );
+    std::copy_n( pattern._bits.begin() + ( first >> 6 ), tt.num_blocks(), tt._bits.begin() );
+    tt.mask_bits();
+  }
+
   /*! \brief Add a pattern (primary input assignment) into the pattern set.
    *
    * \param pattern The pattern. Length should be the same as number of PIs.
@@ -556,6 +585,8 @@ node_map<SimulationType, Ntk> simulate_nodes( Ntk const& ntk, Simulator const& s
     node_to_value[n] = sim.compute_pi( i );
   } );
 
+  /* reused for all gates, such that the fanin values keep their memory */
+  std::vector<SimulationType> fanin_values;
   ntk.foreach_gate( [&]( auto const& n ) {
     // skip crossings
     if constexpr ( has_is_crossing_v<Ntk> )
@@ -566,7 +597,7 @@ node_map<SimulationType, Ntk> simulate_nodes( Ntk const& ntk, Simulator const& s
       }
     }
 
-    std::vector<SimulationType> fanin_values( ntk.fanin_size( n ) );
+    fanin_values.resize( ntk.fanin_size( n ) );
     auto const fanin_fun = [&]( auto const& f, auto i ) {
       fanin_values[i] = node_to_value[f];
     };
@@ -585,6 +616,357 @@ node_map<SimulationType, Ntk> simulate_nodes( Ntk const& ntk, Simulator const& s
   return node_to_value;
 }
 
+/*! \brief Parameters for simulate_nodes_parallel.
+ *
+ * The data structure `parallel_simulation_params` holds configurable
+ * parameters with default arguments for `simulate_nodes_parallel`.
+ */
+struct parallel_simulation_params
+{
+  /*! \brief Number of threads (0 uses all hardware threads). */
+  uint32_t num_threads{ 0u };
+
+  /*! \brief Minimum number of 64-bit words simulated per thread and level.
+   *
+   * Levels with less work are simulated by a single thread.
+   */
+  uint64_t min_words_per_thread{ 16384u };
+};
+
+namespace detail
+{
+
+template<class SimulationType>
+struct is_word_simulation_type : std::false_type
+{
+};
+
+template<>
+struct is_word_simulation_type<kitty::partial_truth_table> : std::true_type
+{
+};
+
+template<>
+struct is_word_simulation_type<kitty::dynamic_truth_table> : std::true_type
+{
+};
+
+/* all threads wait until the last one arrives */
+class simulation_barrier
+{
+public:
+  explicit simulation_barrier( uint32_t num_threads )
+      : _num_threads( num_threads )
+  {
+  }
+
+  void arrive_and_wait()
+  {
+    auto const generation = _generation.load( std::memory_order_acquire );
+    if ( _count.fetch_add( 1u, std::memory_order_acq_rel ) + 1u == _num_threads )
+    {
+      _count.store( 0u, std::memory_order_relaxed );
+      _generation.fetch_add( 1u, std::memory_order_acq_rel );
+      return;
+    }
+    while ( _generation.load( std::memory_order_acquire ) == generation )
+    {
+      std::this_thread::yield();
+    }
+  }
+
+private:
+  uint32_t const _num_threads;
+  std::atomic<uint32_t> _count{ 0u };
+  std::atomic<uint32_t> _generation{ 0u };
+};
+
+/* computes AND, XOR, MAJ, and XOR3 gates from the words of the fanins */
+template<class Ntk, class TT, class FaninValue>
+bool simulate_gate_words( Ntk const& ntk, typename Ntk::node const& n, TT& value, FaninValue&& fanin_value )
+{
+  auto const num_fanins = ntk.fanin_size( n );
+  if ( num_fanins != 2u && num_fanins != 3u )
+  {
+    return false;
+  }
+
+  std::array<typename Ntk::signal, 3u> fanins;
+  ntk.foreach_fanin( n, [&]( auto const& f, auto i ) {
+    fanins[i] = f;
+  } );
+
+  auto const word = [&]( uint32_t i ) { return fanin_value( fanins[i] )._bits.data(); };
+  auto const mask = [&]( uint32_t i ) { return complement_mask( ntk.is_complemented( fanins[i] ) ); };
+
+  auto const& first = fanin_value( fanins[0] );
+  if ( value.num_blocks() != first.num_blocks() || value.num_bits() != first.num_bits() )
+  {
+    value = first.construct();
+  }
+  auto const num_words = value.num_blocks();
+
+  if ( num_fanins == 2u )
+  {
+    if constexpr ( has_is_and_v<Ntk> )
+    {
+      if ( ntk.is_and( n ) )
+      {
+        and_words( value._bits.data(), word( 0 ), word( 1 ), mask( 0 ), mask( 1 ), num_words );
+        value.mask_bits();
+        return true;
+      }
+    }
+    if constexpr ( has_is_xor_v<Ntk> )
+    {
+      if ( ntk.is_xor( n ) )
+      {
+        xor_words( value._bits.data(), word( 0 ), word( 1 ), mask( 0 ) ^ mask( 1 ), num_words );
+        value.mask_bits();
+        return true;
+      }
+    }
+  }
+  else
+  {
+    if constexpr ( has_is_maj_v<Ntk> )
+    {
+      if ( ntk.is_maj( n ) )
+      {
+        maj_words( value._bits.data(), word( 0 ), word( 1 ), word( 2 ), mask( 0 ), mask( 1 ), mask( 2 ), num_words );
+        value.mask_bits();
+        return true;
+      }
+    }
+    if constexpr ( has_is_xor3_v<Ntk> )
+    {
+      if ( ntk.is_xor3( n ) )
+      {
+        xor3_words( value._bits.data(), word( 0 ), word( 1 ), word( 2 ), mask( 0 ) ^ mask( 1 ) ^ mask( 2 ), num_words );
+        value.mask_bits();
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+template<class SimulationType, class Ntk>
+class level_simulation_impl
+{
+public:
+  using node = typename Ntk::node;
+  using signal = typename Ntk::signal;
+
+  level_simulation_impl( Ntk const& ntk, node_map<SimulationType, Ntk>& node_to_value, parallel_simulation_params const& ps )
+      : ntk( ntk ), node_to_value( node_to_value ), ps( ps )
+  {
+  }
+
+  void run()
+  {
+    levelize();
+
+    auto num_threads = ps.num_threads == 0u ? std::max( 1u, std::thread::hardware_concurrency() ) : ps.num_threads;
+    num_threads = static_cast<uint32_t>( std::min<uint64_t>( num_threads, std::max<uint64_t>( 1u, gates.size() ) ) );
+
+    /* number of threads that share each level */
+    uint64_t num_words = 1u;
+    if constexpr ( is_word_simulation_type<SimulationType>::value )
+    {
+      num_words = std::max<uint64_t>( 1u, node_to_value[ntk.get_constant( false )].num_blocks() );
+    }
+    auto const min_nodes = std::max<uint64_t>( 1u, ps.min_words_per_thread / num_words );
+    level_threads.resize( level_offset.size() - 1u );
+    for ( auto l = 0u; l + 1u < level_offset.size(); ++l )
+    {
+      auto const size = level_offset[l + 1u] - level_offset[l];
+      level_threads[l] = static_cast<uint32_t>( std::clamp<uint64_t>( size / min_nodes, 1u, num_threads ) );
+    }
+
+    if ( num_threads == 1u || std::all_of( level_threads.begin(), level_threads.end(), []( auto t ) { return t == 1u; } ) )
+    {
+      std::vector<SimulationType> fanin_values;
+      simulate_range( 0u, gates.size(), fanin_values );
+      return;
+    }
+
+    simulation_barrier barrier( num_threads );
+    std::vector<std::thread> threads;
+    threads.reserve( num_threads - 1u );
+    for ( auto t = 1u; t < num_threads; ++t )
+    {
+      threads.emplace_back( [&, t]() { worker( t, barrier ); } );
+    }
+    worker( 0u, barrier );
+    for ( auto& t : threads )
+    {
+      t.join();
+    }
+  }
+
+private:
+  /* sorts the gates by level (gates on the same level are independent) */
+  void levelize()
+  {
+    std::vector<uint32_t> level( ntk.size(), 0u );
+    uint32_t max_level = 0u;
+    uint64_t num_gates = 0u;
+    ntk.foreach_gate( [&]( auto const& n ) {
+      uint32_t l = 0u;
+      ntk.foreach_fanin( n, [&]( auto const& f ) {
+        l = std::max( l, level[ntk.node_to_index( ntk.get_node( f ) )] );
+      } );
+      level[ntk.node_to_index( n )] = l + 1u;
+      max_level = std::max( max_level, l + 1u );
+      ++num_gates;
+    } );
+
+    level_offset.assign( max_level + 2u, 0u );
+    ntk.foreach_gate( [&]( auto const& n ) {
+      ++level_offset[level[ntk.node_to_index( n )] + 1u];
+    } );
+    for ( auto l = 1u; l < level_offset.size(); ++l )
+    {
+      level_offset[l] += level_offset[l - 1u];
+    }
+
+    gates.resize( num_gates );
+    auto position = level_offset;
+    ntk.foreach_gate( [&]( auto const& n ) {
+      gates[position[level[ntk.node_to_index( n )]]++] = n;
+    } );
+  }
+
+  void worker( uint32_t t, simulation_barrier& barrier )
+  {
+    std::vector<SimulationType> fanin_values;
+    auto const num_levels = level_threads.size();
+    for ( auto l = 0u; l < num_levels; ++l )
+    {
+      auto const begin = level_offset[l], end = level_offset[l + 1u];
+      auto const active = level_threads[l];
+      if ( t < active )
+      {
+        auto const chunk = ( end - begin + active - 1u ) / active;
+        auto const first = std::min<uint64_t>( end, begin + t * chunk );
+        simulate_range( first, std::min<uint64_t>( end, first + chunk ), fanin_values );
+      }
+
+      /* consecutive levels simulated by thread 0 alone need no synchronization */
+      if ( active > 1u || ( l + 1u < num_levels && level_threads[l + 1u] > 1u ) )
+      {
+        barrier.arrive_and_wait();
+      }
+    }
+  }
+
+  void simulate_range( uint64_t begin, uint64_t end, std::vector<SimulationType>& fanin_values )
+  {
+    for ( auto i = begin; i < end; ++i )
+    {
+      simulate_gate( gates[i], fanin_values );
+    }
+  }
+
+  void simulate_gate( node const& n, std::vector<SimulationType>& fanin_values )
+  {
+    if constexpr ( is_word_simulation_type<SimulationType>::value && has_is_complemented_v<Ntk> )
+    {
+      if ( simulate_gate_words( ntk, n, node_to_value[n], [&]( auto const& f ) -> SimulationType const& { return node_to_value[f]; } ) )
+      {
+        return;
+      }
+    }
+
+    fanin_values.resize( ntk.fanin_size( n ) );
+    ntk.foreach_fanin( n, [&]( auto const& f, auto i ) {
+      fanin_values[i] = node_to_value[f];
+    } );
+    node_to_value[n] = ntk.compute( n, fanin_values.begin(), fanin_values.end() );
+  }
+
+private:
+  Ntk const& ntk;
+  node_map<SimulationType, Ntk>& node_to_value;
+  parallel_simulation_params const& ps;
+
+  std::vector<node> gates;
+  std::vector<uint64_t> level_offset;
+  std::vector<uint32_t> level_threads;
+};
+
+} // namespace detail
+
+/*! \brief Simulates a network level by level on several threads.
+ *
+ * Computes the same simulation values as `simulate_nodes`.  The gates are
+ * sorted by level once; the gates of one level do not depend on each other
+ * and are split among the threads, which synchronize after each level.
+ * Levels with little work are simulated by one thread without
+ * synchronization (see `parallel_simulation_params::min_words_per_thread`).
+ *
+ * For `kitty::partial_truth_table` and `kitty::dynamic_truth_table`, AND,
+ * XOR, MAJ, and XOR3 gates (as reported by `is_and`, `is_xor`, `is_maj`,
+ * and `is_xor3`) are computed directly from the words of their fanins with
+ * the kernels in `utils/simd.hpp`, without copying fanin values.  Other
+ * gates and simulation types use `compute`.
+ *
+ * Networks with crossings are simulated by `simulate_nodes`.
+ *
+ * **Required network functions:**
+ * - `get_constant`
+ * - `constant_value`
+ * - `get_node`
+ * - `node_to_index`
+ * - `foreach_pi`
+ * - `foreach_gate`
+ * - `foreach_fanin`
+ * - `fanin_size`
+ * - `compute<SimulationType>`
+ *
+ * \param ntk Network
+ * \param sim Simulator, which implements the simulator interface
+ * \param ps Parameters
+ */
+template<class SimulationType, class Ntk, class Simulator = default_simulator<SimulationType>>
+node_map<SimulationType, Ntk> simulate_nodes_parallel( Ntk const& ntk, Simulator const& sim = Simulator(), parallel_simulation_params const& ps = {} )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant method" );
+  static_assert( has_constant_value_v<Ntk>, "Ntk does not implement the constant_value method" );
+  static_assert( has_get_node_v<Ntk>, "Ntk does not implement the get_node method" );
+  static_assert( has_node_to_index_v<Ntk>, "Ntk does not implement the node_to_index method" );
+  static_assert( has_foreach_pi_v<Ntk>, "Ntk does not implement the foreach_pi method" );
+  static_assert( has_foreach_gate_v<Ntk>, "Ntk does not implement the foreach_gate method" );
+  static_assert( has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin method" );
+  static_assert( has_fanin_size_v<Ntk>, "Ntk does not implement the fanin_size method" );
+  static_assert( has_compute_v<Ntk, SimulationType>, "Ntk does not implement the compute method for SimulationType" );
+
+  if constexpr ( is_crossed_network_type_v<Ntk> || has_is_crossing_v<Ntk> )
+  {
+    (void)ps;
+    return simulate_nodes<SimulationType, Ntk, Simulator>( ntk, sim );
+  }
+  else
+  {
+    node_map<SimulationType, Ntk> node_to_value( ntk );
+
+    node_to_value[ntk.get_node( ntk.get_constant( false ) )] = sim.compute_constant( ntk.constant_value( ntk.get_node( ntk.get_constant( false ) ) ) );
+    if ( ntk.get_node( ntk.get_constant( false ) ) != ntk.get_node( ntk.get_constant( true ) ) )
+    {
+      node_to_value[ntk.get_node( ntk.get_constant( true ) )] = sim.compute_constant( ntk.constant_value( ntk.get_node( ntk.get_constant( true ) ) ) );
+    }
+    ntk.foreach_pi( [&]( auto const& n, auto i ) {
+      node_to_value[n] = sim.compute_pi( i );
+    } );
+
+    detail::level_simulation_impl<SimulationType, Ntk> p( ntk, node_to_value, ps );
+    p.run();
+    return node_to_value;
+  }
+}
+
 namespace detail
 {
 
@@ -624,6 +1006,7 @@ void simulate_nodes_with_node_map( Ntk const& ntk, Container& node_to_value, Sim
   } );
 
   /* gates */
+  std::vector<SimulationType> fanin_values;
   ntk.foreach_gate( [&]( auto const& n ) {
     // skip crossings
     if constexpr ( has_is_crossing_v<Ntk> )
@@ -636,7 +1019,7 @@ void simulate_nodes_with_node_map( Ntk const& ntk, Container& node_to_value, Sim
 
     if ( !node_to_value.has( n ) )
     {
-      std::vector<SimulationType> fanin_values( ntk.fanin_size( n ) );
+      fanin_values.resize( ntk.fanin_size( n ) );
       auto const fanin_fun = [&]( auto const& f, auto i ) {
         fanin_values[i] = node_to_value[ntk.get_node( f )];
       };
@@ -824,9 +1207,11 @@ void simulate_node( Ntk const& ntk, typename Ntk::node const& n, Container& node
  * \param simulate_whole_tt When this parameter is true, it is assumed that `node_to_value.has( n )` is false for every node.
  * In contrast, when this parameter is false, only the last block of `partial_truth_table` will be re-computed,
  * and it is assumed that `node_to_value.has( n )` is true for every node.
+ * \param ps Parameters for simulating all gates level by level (see `simulate_nodes_parallel`),
+ * by default on a single thread.
  */
 template<class Ntk, class Simulator = partial_simulator, class Container = unordered_node_map<kitty::partial_truth_table, Ntk>>
-void simulate_nodes( Ntk const& ntk, Container& node_to_value, Simulator const& sim, bool simulate_whole_tt )
+void simulate_nodes( Ntk const& ntk, Container& node_to_value, Simulator const& sim, bool simulate_whole_tt, parallel_simulation_params const& ps = { 1u } )
 {
   static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
   static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant method" );
@@ -844,6 +1229,20 @@ void simulate_nodes( Ntk const& ntk, Container& node_to_value, Simulator const&
   /* gates */
   if ( simulate_whole_tt )
   {
+    if constexpr ( std::is_same_v<Container, unordered_node_map<kitty::partial_truth_table, Ntk>> && std::is_same_v<Simulator, partial_simulator> && has_node_to_index_v<Ntk> && has_num_pis_v<Ntk> )
+    {
+      /* no gate is simulated yet: simulate all of them level by level */
+      auto const num_constants = ntk.get_node( ntk.get_constant( false ) ) != ntk.get_node( ntk.get_constant( true ) ) ? 2u : 1u;
+      if ( node_to_value.size() == ntk.num_pis() + num_constants )
+      {
+        auto values = simulate_nodes_parallel<kitty::partial_truth_table>( ntk, sim, ps );
+        ntk.foreach_gate( [&]( auto const& n ) {
+          node_to_value[n] = std::move( values[n] );
+        } );
+        return;
+      }
+    }
+
     ntk.foreach_gate( [&]( auto const& n ) {
       if ( !node_to_value.has( n ) )
       {
@@ -913,6 +1312,289 @@ std::vector<SimulationType> simulate( Ntk const& ntk, Simulator const& sim = Sim
   return po_values;
 }
 
+/*! \brief Parameters for simulate_blocks.
+ *
+ * The data structure `block_simulation_params` holds configurable
+ * parameters with default arguments for `simulate_blocks`.
+ */
+struct block_simulation_params
+{
+  /*! \brief Number of patterns per block (rounded up to a multiple of 64). */
+  uint32_t block_size{ 4096u };
+};
+
+/*! \brief Statistics for simulate_blocks. */
+struct block_simulation_stats
+{
+  /*! \brief Number of simulated blocks. */
+  uint32_t num_blocks{ 0u };
+
+  /*! \brief Largest number of node values kept at the same time. */
+  uint32_t max_live_values{ 0u };
+};
+
+/*! \brief Simulates a network block by block with bounded memory.
+ *
+ * Simulates the patterns of `sim` in blocks of `ps.block_size` patterns.
+ * For each block, `fn` is called with the index of the first pattern in
+ * the block, the values of the primary outputs (taking complemented
+ * attributes into account), and the values of the nodes in `nodes`.
+ *
+ * Node values are only kept while they are needed: each node has a
+ * reference count of its fanouts that lead to an output or to a node in
+ * `nodes`, and its value is released when the last of them has been
+ * simulated.  Values are stored in a pool that is reused for every block,
+ * such that the memory depends on the block size and the largest number of
+ * simultaneously live values, but not on the number of patterns.  Gates
+ * that are not needed for any output are not simulated.  Gates are
+ * simulated in index order, or in topological order if some fanin has a
+ * larger index than its fanout.
+ *
+ * The simulator must implement the two methods:
+ * - `uint32_t num_bits()`, the total number of patterns
+ * - `void compute_pi_block(uint32_t index, uint32_t first, kitty::partial_truth_table& tt)`,
+ *   which copies the patterns from `first` on of the primary input `index`
+ *   into `tt` (see `partial_simulator::compute_pi_block`)
+ *
+ * Simulators that generate or read patterns on demand can be used to
+ * simulate more patterns than fit into memory.
+ *
+ * The callback has the signature `void( uint32_t first, std::vector<kitty::partial_truth_table> const& po_values, std::vector<kitty::partial_truth_table> const& node_values )`.
+ *
+ * **Required network functions:**
+ * - `get_constant`
+ * - `constant_value`
+ * - `get_node`
+ * - `node_to_index`
+ * - `size`
+ * - `foreach_pi`
+ * - `foreach_po`
+ * - `foreach_gate`
+ * - `foreach_fanin`
+ * - `fanin_size`
+ * - `is_complemented`
+ * - `compute<kitty::partial_truth_table>`
+ *
+ * \param ntk Network
+ * \param sim Simulator, which provides the patterns block by block
+ * \param fn Callback for each block
+ * \param nodes Nodes whose values are passed to the callback
+ * \param ps Parameters
+ * \param pst Statistics
+ */
+template<class Ntk, class Simulator, class Fn>
+void simulate_blocks( Ntk const& ntk, Simulator const& sim, Fn&& fn, std::vector<typename Ntk::node> const& nodes = {}, block_simulation_params const& ps = {}, block_simulation_stats* pst = nullptr )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( !is_crossed_network_type_v<Ntk>, "Ntk must not be a crossed network" );
+  static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant method" );
+  static_assert( has_constant_value_v<Ntk>, "Ntk does not implement the constant_value method" );
+  static_assert( has_get_node_v<Ntk>, "Ntk does not implement the get_node method" );
+  static_assert( has_node_to_index_v<Ntk>, "Ntk does not implement the node_to_index method" );
+  static_assert( has_size_v<Ntk>, "Ntk does not implement the size method" );
+  static_assert( has_foreach_pi_v<Ntk>, "Ntk does not implement the foreach_pi method" );
+  static_assert( has_foreach_po_v<Ntk>, "Ntk does not implement the foreach_po method" );
+  static_assert( has_foreach_gate_v<Ntk>, "Ntk does not implement the foreach_gate method" );
+  static_assert( has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin method" );
+  static_assert( has_fanin_size_v<Ntk>, "Ntk does not implement the fanin_size method" );
+  static_assert( has_is_complemented_v<Ntk>, "Ntk does not implement the is_complemented method" );
+  static_assert( has_compute_v<Ntk, kitty::partial_truth_table>, "Ntk does not implement the compute method for kitty::partial_truth_table" );
+
+  using node = typename Ntk::node;
+  constexpr auto no_slot = std::numeric_limits<uint32_t>::max();
+
+  /* outputs of each node (complemented POs are stored with the MSB set) */
+  std::vector<uint32_t> output_offset( ntk.size() + 1u, 0u );
+  ntk.foreach_po( [&]( auto const& f ) {
+    ++output_offset[ntk.node_to_index( ntk.get_node( f ) ) + 1u];
+  } );
+  for ( auto const& n : nodes )
+  {
+    ++output_offset[ntk.node_to_index( n ) + 1u];
+  }
+  for ( auto i = 1u; i < output_offset.size(); ++i )
+  {
+    output_offset[i] += output_offset[i - 1u];
+  }
+  std::vector<uint32_t> outputs( output_offset.back() );
+  {
+    auto position = output_offset;
+    ntk.foreach_po( [&]( auto const& f, auto i ) {
+      outputs[position[ntk.node_to_index( ntk.get_node( f ) )]++] = i | ( ntk.is_complemented( f ) ? 0x80000000 : 0u );
+    } );
+    for ( auto i = 0u; i < nodes.size(); ++i )
+    {
+      outputs[position[ntk.node_to_index( nodes[i] )]++] = ntk.num_pos() + i;
+    }
+  }
+
+  /* gates that are needed for some output, and the number of their fanouts;
+     gates are simulated in index order unless some fanin has a larger
+     index than its fanout (e.g., after substitutions), then in topological
+     order */
+  std::vector<node> gates;
+  bool index_order = true;
+  ntk.foreach_gate( [&]( auto const& n ) {
+    gates.push_back( n );
+    ntk.foreach_fanin( n, [&]( auto const& f ) {
+      if ( ntk.node_to_index( ntk.get_node( f ) ) > ntk.node_to_index( n ) )
+      {
+        index_order = false;
+      }
+    } );
+  } );
+  if ( !index_order )
+  {
+    gates.clear();
+    topo_view<Ntk>{ ntk }.foreach_gate( [&]( auto const& n ) {
+      gates.push_back( n );
+    } );
+  }
+  std::vector<uint32_t> refs( ntk.size(), 0u );
+  std::vector<bool> needed( ntk.size(), false );
+  for ( auto i = 0u; i < output_offset.size() - 1u; ++i )
+  {
+    needed[i] = output_offset[i] != output_offset[i + 1u];
+  }
+  for ( auto it = gates.rbegin(); it != gates.rend(); ++it )
+  {
+    if ( !needed[ntk.node_to_index( *it )] )
+    {
+      continue;
+    }
+    ntk.foreach_fanin( *it, [&]( auto const& f ) {
+      auto const index = ntk.node_to_index( ntk.get_node( f ) );
+      needed[index] = true;
+      ++refs[index];
+    } );
+  }
+
+  std::vector<kitty::partial_truth_table> pool;
+  std::vector<uint32_t> free_slots;
+  std::vector<uint32_t> slot( ntk.size(), no_slot );
+  std::vector<uint32_t> refs_left( ntk.size() );
+  std::vector<kitty::partial_truth_table> fanin_values;
+  std::vector<kitty::partial_truth_table> po_values( ntk.num_pos() );
+  std::vector<kitty::partial_truth_table> node_values( nodes.size() );
+
+  uint32_t num_blocks = 0u;
+  uint32_t max_live_values = 0u;
+  auto const block_size = std::max( 64u, ( ps.block_size + 63u ) & ~63u );
+  auto const num_bits = sim.num_bits();
+
+  for ( uint32_t first = 0u; first < num_bits; first += block_size )
+  {
+    auto const size = std::min( block_size, num_bits - first );
+    std::copy( refs.begin(), refs.end(), refs_left.begin() );
+
+    /* takes a value from the pool */
+    auto const allocate = [&]( node const& n ) -> kitty::partial_truth_table& {
+      auto const index = ntk.node_to_index( n );
+      if ( free_slots.empty() )
+      {
+        free_slots.push_back( static_cast<uint32_t>( pool.size() ) );
+        pool.emplace_back( size );
+      }
+      slot[index] = free_slots.back();
+      free_slots.pop_back();
+      max_live_values = std::max( max_live_values, static_cast<uint32_t>( pool.size() - free_slots.size() ) );
+
+      auto& value = pool[slot[index]];
+      if ( value.num_bits() != size )
+      {
+        value.resize( size );
+      }
+      return value;
+    };
+
+    /* copies the value of a node to its outputs, and releases it if it is not needed anymore */
+    auto const finish = [&]( node const& n ) {
+      auto const index = ntk.node_to_index( n );
+      auto const& value = pool[slot[index]];
+      for ( auto i = output_offset[index]; i < output_offset[index + 1u]; ++i )
+      {
+        auto const output = outputs[i] & 0x7fffffff;
+        auto& output_value = output < ntk.num_pos() ? po_values[output] : node_values[output - ntk.num_pos()];
+        output_value = ( outputs[i] & 0x80000000 ) ? ~value : value;
+      }
+      if ( refs_left[index] == 0u )
+      {
+        free_slots.push_back( slot[index] );
+        slot[index] = no_slot;
+      }
+    };
+
+    auto const release_fanin = [&]( node const& n ) {
+      auto const index = ntk.node_to_index( n );
+      if ( --refs_left[index] == 0u )
+      {
+        free_slots.push_back( slot[index] );
+        slot[index] = no_slot;
+      }
+    };
+
+    /* constants and primary inputs */
+    auto const load_constant = [&]( node const& n ) {
+      if ( needed[ntk.node_to_index( n )] )
+      {
+        auto& value = allocate( n );
+        std::fill( value._bits.begin(), value._bits.end(), ntk.constant_value( n ) ? ~UINT64_C( 0 ) : UINT64_C( 0 ) );
+        value.mask_bits();
+        finish( n );
+      }
+    };
+    load_constant( ntk.get_node( ntk.get_constant( false ) ) );
+    if ( ntk.get_node( ntk.get_constant( true ) ) != ntk.get_node( ntk.get_constant( false ) ) )
+    {
+      load_constant( ntk.get_node( ntk.get_constant( true ) ) );
+    }
+    ntk.foreach_pi( [&]( auto const& n, auto i ) {
+      if ( needed[ntk.node_to_index( n )] )
+      {
+        sim.compute_pi_block( i, first, allocate( n ) );
+        finish( n );
+      }
+    } );
+
+    /* gates */
+    for ( auto const& n : gates )
+    {
+      if ( !needed[ntk.node_to_index( n )] )
+      {
+        continue;
+      }
+
+      auto& value = allocate( n );
+      auto const fanin_value = [&]( auto const& f ) -> kitty::partial_truth_table const& {
+        assert( slot[ntk.node_to_index( ntk.get_node( f ) )] != no_slot );
+        return pool[slot[ntk.node_to_index( ntk.get_node( f ) )]];
+      };
+      if ( !detail::simulate_gate_words( ntk, n, value, fanin_value ) )
+      {
+        fanin_values.resize( ntk.fanin_size( n ) );
+        ntk.foreach_fanin( n, [&]( auto const& f, auto i ) {
+          fanin_values[i] = fanin_value( f );
+        } );
+        value = ntk.compute( n, fanin_values.begin(), fanin_values.end() );
+      }
+
+      ntk.foreach_fanin( n, [&]( auto const& f ) {
+        release_fanin( ntk.get_node( f ) );
+      } );
+      finish( n );
+    }
+
+    fn( first, std::as_const( po_values ), std::as_const( node_values ) );
+    ++num_blocks;
+  }
+
+  if ( pst )
+  {
+    pst->num_blocks = num_blocks;
+    pst->max_live_values = max_live_values;
+  }
+}
+
 /*! \brief Simulates a buffered network
  *
  * The implementation is only slightly different from `simulate` by
@@ -235,6 +235,11 @@ public:
 
     std::vector<signal> fs;
     Ntk ntk;
+    if constexpr ( has_reserve_v<Ntk> )
+    {
+      ntk.reserve( 1u + _num_pis + _num_gates );
+    }
+    fs.reserve( 1u + _num_pis + _num_gates );
 
     /* generate constant */
     fs.emplace_back( ntk.get_constant( false ) );
@@ -118,6 +118,38 @@ public:
    */
   network clone();
 
+#pragma region Bulk construction
+  /*! \brief Reserves space for a number of nodes.
+   *
+   * The number includes constants and inputs.  Avoids reallocations and
+   * rehashing when the final size of the network is known in advance.
+   *
+   * \param num_nodes Expected number of nodes
+   */
+  void reserve( uint64_t num_nodes );
+
+  /*! \brief Starts appending nodes without structural hashing.
+   *
+   * Reserves space for ``num_nodes`` nodes.  Until ``end_bulk`` is called,
+   * node creation neither looks up nor inserts nodes in the structural hash
+   * table.  Only nodes may be created in between, e.g., when copying a
+   * network in topological order.
+   *
+   * \param num_nodes Expected number of nodes
+   */
+  void begin_bulk( uint64_t num_nodes );
+
+  /*! \brief Rebuilds the structural hash table after ``begin_bulk``.
+   *
+   * Returns the number of gates created since ``begin_bulk`` that are
+   * structurally equal to an earlier gate.  These gates are not in the hash
+   * table and not counted by ``num_gates``.
+   *
+   * \param num_threads Number of threads to compute hash values (0 for all)
+   */
+  uint64_t end_bulk( uint32_t num_threads = 0u );
+#pragma endregion
+
 #pragma region Primary I / O and constants
   /*! \brief Gets constant value represented by network.
    *
@@ -130,7 +130,7 @@ public:
     }
   }
 
-  void on_header( uint64_t, uint64_t num_inputs, uint64_t num_latches, uint64_t, uint64_t ) const override
+  void on_header( uint64_t, uint64_t num_inputs, uint64_t num_latches, uint64_t, uint64_t num_ands ) const override
   {
     (void)num_latches;
     if constexpr ( !has_create_ri_v<Ntk> || !has_create_ro_v<Ntk> )
@@ -140,6 +140,13 @@ public:
 
     _num_inputs = static_cast<uint32_t>( num_inputs );
 
+    /* allocate nodes and hash table once from the header counts */
+    signals.reserve( 1u + num_inputs + num_latches + num_ands );
+    if constexpr ( has_reserve_v<Ntk> )
+    {
+      _ntk.reserve( 1u + num_inputs + num_latches + num_ands );
+    }
+
     /* constant */
     signals.push_back( _ntk.get_constant( false ) );
 
@@ -215,7 +215,7 @@ public:
     }
 
     /* hash */
-    if ( !const_cast<aig_storage&>( storage ).hash.dump( os ) )
+    if ( !storage.hash.dump( os ) )
     {
       return false;
     }
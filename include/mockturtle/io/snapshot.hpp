@@ -0,0 +1,623 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2022  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file snapshot.hpp
+  \brief Binary snapshots of networks
+
+  This file implements functions to save the storage of an `aig_network`,
+  `xag_network`, `mig_network`, `xmg_network`, `klut_network`, or
+  `block_network` into a versioned binary snapshot and to restore it.  The
+  snapshot contains the node array in the layout of `storage`, the inputs,
+  the outputs, the slots of the structural hash table, and the truth table
+  cache, each as one contiguous section.  Restoring a snapshot maps the file
+  into memory and copies each section with a single `memcpy`; the hash table
+  is not rebuilt.  Like `serialize_network`, snapshots are meant as
+  checkpoints on one platform and are not portable (use, e.g.,
+  `write_aiger` instead).
+*/
+
+#pragma once
+
+#include "../networks/aig.hpp"
+#include "../networks/block.hpp"
+#include "../networks/klut.hpp"
+#include "../networks/mig.hpp"
+#include "../networks/xag.hpp"
+#include "../networks/xmg.hpp"
+
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mockturtle
+{
+
+namespace detail
+{
+
+/* version of the snapshot layout, to be increased on any change */
+inline constexpr uint32_t snapshot_version = 1u;
+inline constexpr char snapshot_magic[8] = { 'M', 'T', 'S', 'N', 'A', 'P', '\0', '\0' };
+inline constexpr uint32_t snapshot_byte_order = 0x01020304u;
+
+template<class Ntk>
+struct snapshot_network_id;
+
+template<>
+struct snapshot_network_id<aig_network> : std::integral_constant<uint32_t, 1u>
+{
+};
+
+template<>
+struct snapshot_network_id<xag_network> : std::integral_constant<uint32_t, 2u>
+{
+};
+
+template<>
+struct snapshot_network_id<mig_network> : std::integral_constant<uint32_t, 3u>
+{
+};
+
+template<>
+struct snapshot_network_id<xmg_network> : std::integral_constant<uint32_t, 4u>
+{
+};
+
+template<>
+struct snapshot_network_id<klut_network> : std::integral_constant<uint32_t, 5u>
+{
+};
+
+template<>
+struct snapshot_network_id<block_network> : std::integral_constant<uint32_t, 6u>
+{
+};
+
+template<class Ntk, class = void>
+inline constexpr bool has_snapshot_network_id_v = false;
+
+template<class Ntk>
+inline constexpr bool has_snapshot_network_id_v<Ntk, std::void_t<decltype( snapshot_network_id<Ntk>::value )>> = true;
+
+template<class Storage, class = void>
+inline constexpr bool has_strash_table_v = false;
+
+template<class Storage>
+inline constexpr bool has_strash_table_v<Storage, std::void_t<decltype( std::declval<Storage&>().hash )>> = true;
+
+template<class Storage, class = void>
+inline constexpr bool has_truth_table_cache_v = false;
+
+template<class Storage>
+inline constexpr bool has_truth_table_cache_v<Storage, std::void_t<decltype( std::declval<Storage&>().data.cache )>> = true;
+
+struct snapshot_header
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint32_t network;
+  uint32_t node_size;
+};
+
+class snapshot_writer
+{
+public:
+  explicit snapshot_writer( std::ostream& os )
+      : _os( os )
+  {
+  }
+
+  bool dump( char const* data, std::size_t size )
+  {
+    _os.write( data, size );
+    _pos += size;
+    return static_cast<bool>( _os );
+  }
+
+  template<typename T>
+  bool dump_value( T const& value )
+  {
+    return dump( reinterpret_cast<char const*>( &value ), sizeof( T ) );
+  }
+
+  /* sections start at multiples of 8 bytes, such that mapped arrays are aligned */
+  bool align()
+  {
+    static constexpr char zeros[8] = {};
+    return dump( zeros, ( 8u - _pos % 8u ) % 8u );
+  }
+
+  template<typename T>
+  bool dump_array( std::vector<T> const& values )
+  {
+    static_assert( std::is_trivially_copyable_v<T>, "array elements must be trivially copyable" );
+    return dump_value( static_cast<uint64_t>( values.size() ) ) &&
+           dump( reinterpret_cast<char const*>( values.data() ), sizeof( T ) * values.size() ) &&
+           align();
+  }
+
+private:
+  std::ostream& _os;
+  uint64_t _pos{ 0 };
+};
+
+class snapshot_reader
+{
+public:
+  snapshot_reader( char const* data, std::size_t size )
+      : _data( data ), _size( size )
+  {
+  }
+
+  bool load( char* data, std::size_t size )
+  {
+    if ( size > _size - _pos )
+    {
+      return false;
+    }
+    std::memcpy( data, _data + _pos, size );
+    _pos += size;
+    return true;
+  }
+
+  template<typename T>
+  bool load_value( T& value )
+  {
+    return load( reinterpret_cast<char*>( &value ), sizeof( T ) );
+  }
+
+  /* number of bytes left to read */
+  std::size_t remaining() const
+  {
+    return _size - _pos;
+  }
+
+  bool align()
+  {
+    auto const pos = ( _pos + 7u ) & ~std::size_t( 7u );
+    if ( pos > _size )
+    {
+      return false;
+    }
+    _pos = pos;
+    return true;
+  }
+
+  template<typename T>
+  bool load_array( std::vector<T>& values )
+  {
+    static_assert( std::is_trivially_copyable_v<T>, "array elements must be trivially copyable" );
+    uint64_t count;
+    if ( !load_value( count ) || count > ( _size - _pos ) / sizeof( T ) )
+    {
+      return false;
+    }
+    values.resize( count );
+    return load( reinterpret_cast<char*>( values.data() ), sizeof( T ) * count ) && align();
+  }
+
+private:
+  char const* _data;
+  std::size_t _size;
+  std::size_t _pos{ 0 };
+};
+
+/* read-only view of a file, memory-mapped if possible */
+class snapshot_file
+{
+public:
+  explicit snapshot_file( std::string const& filename )
+  {
+#if defined( __unix__ ) || defined( __APPLE__ )
+    auto const fd = ::open( filename.c_str(), O_RDONLY );
+    if ( fd < 0 )
+    {
+      return;
+    }
+    struct stat st;
+    if ( ::fstat( fd, &st ) == 0 && st.st_size > 0 )
+    {
+      auto const addr = ::mmap( nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+      if ( addr != MAP_FAILED )
+      {
+        _mapped = static_cast<char const*>( addr );
+        _size = st.st_size;
+      }
+    }
+    ::close( fd );
+#else
+    std::ifstream in( filename, std::ifstream::binary );
+    _buffer.assign( std::istreambuf_iterator<char>( in ), std::istreambuf_iterator<char>() );
+    _size = _buffer.size();
+#endif
+  }
+
+  ~snapshot_file()
+  {
+#if defined( __unix__ ) || defined( __APPLE__ )
+    if ( _mapped != nullptr )
+    {
+      ::munmap( const_cast<char*>( _mapped ), _size );
+    }
+#endif
+  }
+
+  snapshot_file( snapshot_file const& ) = delete;
+  snapshot_file& operator=( snapshot_file const& ) = delete;
+
+  char const* data() const
+  {
+    return _mapped != nullptr ? _mapped : _buffer.data();
+  }
+
+  std::size_t size() const
+  {
+    return _size;
+  }
+
+private:
+  char const* _mapped{ nullptr };
+  std::vector<char> _buffer;
+  std::size_t _size{ 0 };
+};
+
+template<class Nodes>
+bool dump_snapshot_nodes( snapshot_writer& writer, Nodes const& nodes )
+{
+  using node_type = typename Nodes::value_type;
+
+  if constexpr ( std::is_trivially_copyable_v<node_type> )
+  {
+    return writer.dump_array( nodes );
+  }
+  else
+  {
+    /* nodes with fanin and data vectors are stored as counts and flat arrays */
+    std::vector<uint32_t> num_children, num_data;
+    std::vector<uint64_t> children, data;
+    num_children.reserve( nodes.size() );
+    num_data.reserve( nodes.size() );
+    for ( auto const& n : nodes )
+    {
+      num_children.push_back( static_cast<uint32_t>( n.children.size() ) );
+      num_data.push_back( static_cast<uint32_t>( n.data.size() ) );
+      for ( auto const& c : n.children )
+      {
+        children.push_back( c.data );
+      }
+      for ( auto const& d : n.data )
+      {
+        data.push_back( d.n );
+      }
+    }
+    return writer.dump_array( num_children ) && writer.dump_array( num_data ) &&
+           writer.dump_array( children ) && writer.dump_array( data );
+  }
+}
+
+template<class Nodes>
+bool load_snapshot_nodes( snapshot_reader& reader, Nodes& nodes )
+{
+  using node_type = typename Nodes::value_type;
+
+  if constexpr ( std::is_trivially_copyable_v<node_type> )
+  {
+    return reader.load_array( nodes );
+  }
+  else
+  {
+    std::vector<uint32_t> num_children, num_data;
+    std::vector<uint64_t> children, data;
+    if ( !reader.load_array( num_children ) || !reader.load_array( num_data ) ||
+         !reader.load_array( children ) || !reader.load_array( data ) ||
+         num_children.size() != num_data.size() )
+    {
+      return false;
+    }
+
+    nodes.resize( num_children.size() );
+    std::size_t child_pos{ 0 }, data_pos{ 0 };
+    for ( auto i = 0u; i < nodes.size(); ++i )
+    {
+      auto& n = nodes[i];
+      if ( num_children[i] > children.size() - child_pos || num_data[i] > data.size() - data_pos )
+      {
+        return false;
+      }
+      n.children.resize( num_children[i] );
+      for ( auto& c : n.children )
+      {
+        c.data = children[child_pos++];
+      }
+      if constexpr ( std::is_same_v<decltype( n.data ), std::vector<cauint64_t>> )
+      {
+        n.data.resize( num_data[i] );
+      }
+      else if ( num_data[i] != n.data.size() )
+      {
+        return false;
+      }
+      for ( auto& d : n.data )
+      {
+        d.n = data[data_pos++];
+      }
+    }
+    return true;
+  }
+}
+
+/* checks that all fanins, inputs, and outputs refer to stored nodes */
+template<class Storage>
+bool check_snapshot_indices( Storage const& storage, std::vector<uint64_t> const& outputs )
+{
+  using pointer_type = typename Storage::node_type::pointer_type;
+
+  auto const num_nodes = storage.nodes.size();
+  if ( num_nodes == 0u )
+  {
+    return false;
+  }
+  for ( auto const& n : storage.nodes )
+  {
+    for ( auto const& c : n.children )
+    {
+      if ( c.index >= num_nodes )
+      {
+        return false;
+      }
+    }
+  }
+  return std::all_of( storage.inputs.begin(), storage.inputs.end(), [&]( auto const index ) { return index < num_nodes; } ) &&
+         std::all_of( outputs.begin(), outputs.end(), [&]( auto const data ) { return pointer_type( data ).index < num_nodes; } );
+}
+
+template<class Cache>
+bool dump_snapshot_cache( snapshot_writer& writer, Cache const& cache )
+{
+  /* the cache is restored by inserting its normal truth tables in order */
+  std::vector<uint32_t> num_vars;
+  std::vector<uint64_t> words;
+  for ( auto i = 0u; i < cache.size(); ++i )
+  {
+    auto const tt = cache[2u * i];
+    num_vars.push_back( tt.num_vars() );
+    words.insert( words.end(), tt.begin(), tt.end() );
+  }
+  return writer.dump_array( num_vars ) && writer.dump_array( words );
+}
+
+template<class Cache>
+bool load_snapshot_cache( snapshot_reader& reader, Cache& cache )
+{
+  std::vector<uint32_t> num_vars;
+  std::vector<uint64_t> words;
+  if ( !reader.load_array( num_vars ) || !reader.load_array( words ) )
+  {
+    return false;
+  }
+
+  cache = Cache( static_cast<uint32_t>( num_vars.size() ) );
+  std::size_t pos{ 0 };
+  for ( auto i = 0u; i < num_vars.size(); ++i )
+  {
+    if ( num_vars[i] > 32u )
+    {
+      return false;
+    }
+    kitty::dynamic_truth_table tt( num_vars[i] );
+    if ( tt.num_blocks() > words.size() - pos )
+    {
+      return false;
+    }
+    kitty::create_from_words( tt, words.begin() + pos, words.begin() + pos + tt.num_blocks() );
+    pos += tt.num_blocks();
+    if ( cache.insert( tt ) != 2u * i )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+} /* namespace detail */
+
+/*! \brief Writes a binary snapshot of a network into an output stream.
+ *
+ * The snapshot contains the complete storage of the network, including
+ * dangling and dead nodes, and can be restored with `read_snapshot`.
+ *
+ * **Required network types:** `aig_network`, `xag_network`, `mig_network`,
+ * `xmg_network`, `klut_network`, or `block_network`
+ *
+ * \param ntk Network
+ * \param os Output stream (opened in binary mode)
+ * \return True, if the snapshot has been written successfully
+ */
+template<class Ntk>
+bool write_snapshot( Ntk const& ntk, std::ostream& os )
+{
+  static_assert( detail::has_snapshot_network_id_v<Ntk>, "Ntk is not a network type with snapshot support" );
+
+  auto const& storage = *ntk._storage;
+  using storage_type = std::decay_t<decltype( storage )>;
+  using node_type = typename storage_type::node_type;
+
+  detail::snapshot_header header{};
+  std::memcpy( header.magic, detail::snapshot_magic, sizeof( header.magic ) );
+  header.version = detail::snapshot_version;
+  header.byte_order = detail::snapshot_byte_order;
+  header.network = detail::snapshot_network_id<Ntk>::value;
+  header.node_size = std::is_trivially_copyable_v<node_type> ? sizeof( node_type ) : 0u;
+
+  std::vector<uint64_t> outputs;
+  outputs.reserve( storage.outputs.size() );
+  for ( auto const& o : storage.outputs )
+  {
+    outputs.push_back( o.data );
+  }
+
+  detail::snapshot_writer writer( os );
+  if ( !writer.dump_value( header ) || !writer.dump_value( static_cast<uint64_t>( storage.trav_id ) ) ||
+       !detail::dump_snapshot_nodes( writer, storage.nodes ) ||
+       !writer.dump_array( storage.inputs ) || !writer.dump_array( outputs ) )
+  {
+    return false;
+  }
+
+  if constexpr ( detail::has_strash_table_v<storage_type> )
+  {
+    if ( !storage.hash.dump( writer ) || !writer.align() )
+    {
+      return false;
+    }
+  }
+
+  if constexpr ( detail::has_truth_table_cache_v<storage_type> )
+  {
+    if ( !detail::dump_snapshot_cache( writer, storage.data.cache ) )
+    {
+      return false;
+    }
+  }
+
+  os.flush();
+  return static_cast<bool>( os );
+}
+
+/*! \brief Writes a binary snapshot of a network into a file.
+ *
+ * \param ntk Network
+ * \param filename Filename
+ * \return True, if the snapshot has been written successfully
+ */
+template<class Ntk>
+bool write_snapshot( Ntk const& ntk, std::string const& filename )
+{
+  std::ofstream os( filename.c_str(), std::ofstream::out | std::ofstream::binary );
+  return os.is_open() && write_snapshot( ntk, os );
+}
+
+/*! \brief Restores a network from a binary snapshot in memory.
+ *
+ * Returns `std::nullopt` if the data is not a snapshot of a network of type
+ * `Ntk` written with the same snapshot version, if it is truncated, or if
+ * it refers to nodes that are not stored (in fanins, inputs, outputs, or
+ * the structural hash table).
+ *
+ * \param data Pointer to the snapshot
+ * \param size Size of the snapshot in bytes
+ * \return Restored network
+ */
+template<class Ntk>
+std::optional<Ntk> read_snapshot( char const* data, std::size_t size )
+{
+  static_assert( detail::has_snapshot_network_id_v<Ntk>, "Ntk is not a network type with snapshot support" );
+
+  Ntk ntk;
+  auto& storage = *ntk._storage;
+  using storage_type = std::decay_t<decltype( storage )>;
+  using node_type = typename storage_type::node_type;
+
+  detail::snapshot_reader reader( data, size );
+  detail::snapshot_header header;
+  if ( !reader.load_value( header ) ||
+       std::memcmp( header.magic, detail::snapshot_magic, sizeof( header.magic ) ) != 0 ||
+       header.version != detail::snapshot_version ||
+       header.byte_order != detail::snapshot_byte_order ||
+       header.network != detail::snapshot_network_id<Ntk>::value ||
+       header.node_size != ( std::is_trivially_copyable_v<node_type> ? sizeof( node_type ) : 0u ) )
+  {
+    return std::nullopt;
+  }
+
+  uint64_t trav_id;
+  std::vector<uint64_t> outputs;
+  if ( !reader.load_value( trav_id ) || !detail::load_snapshot_nodes( reader, storage.nodes ) ||
+       !reader.load_array( storage.inputs ) || !reader.load_array( outputs ) ||
+       !detail::check_snapshot_indices( storage, outputs ) )
+  {
+    return std::nullopt;
+  }
+  storage.trav_id = static_cast<uint32_t>( trav_id );
+  storage.outputs.assign( outputs.begin(), outputs.end() );
+
+  if constexpr ( detail::has_strash_table_v<storage_type> )
+  {
+    if ( !storage.hash.load( reader ) || !reader.align() )
+    {
+      return std::nullopt;
+    }
+  }
+
+  if constexpr ( detail::has_truth_table_cache_v<storage_type> )
+  {
+    if ( !detail::load_snapshot_cache( reader, storage.data.cache ) )
+    {
+      return std::nullopt;
+    }
+  }
+
+  return ntk;
+}
+
+/*! \brief Restores a network from a binary snapshot file.
+ *
+ * The file is memory-mapped (if supported by the platform) and each section
+ * is copied into the storage of the network at once.
+ *
+ * \param filename Filename
+ * \return Restored network, or `std::nullopt` on failure
+ */
+template<class Ntk>
+std::optional<Ntk> read_snapshot( std::string const& filename )
+{
+  detail::snapshot_file file( filename );
+  if ( file.size() == 0u )
+  {
+    return std::nullopt;
+  }
+  return read_snapshot<Ntk>( file.data(), file.size() );
+}
+
+} /* namespace mockturtle */
@@ -45,6 +45,7 @@
 #include <kitty/print.hpp>
 #include <lorina/verilog.hpp>
 
+#include <algorithm>
 #include <array>
 #include <fstream>
 #include <iostream>
@@ -463,6 +464,68 @@ void write_verilog( Ntk const& ntk, std::ostream& os, write_verilog_params const
     }
     else
     {
+      if constexpr ( has_is_maj5_v<Ntk> )
+      {
+        if ( ntk.is_maj5( n ) )
+        {
+          std::array<signal<Ntk>, 5> children;
+          ntk.foreach_fanin( n, [&]( auto const& f, auto i ) { children[i] = f; } );
+          auto const fanin = detail::format_fanin<Ntk>( ntk, n, node_names );
+
+          /* a pair of complementary constants cancels out, the remaining
+             constants turn the majority into an AND or an OR */
+          std::vector<std::pair<bool, std::string>> vs;
+          uint32_t num_zeros{ 0u }, num_ones{ 0u };
+          for ( auto i = 0u; i < 5u; ++i )
+          {
+            if ( !ntk.is_constant( ntk.get_node( children[i] ) ) )
+            {
+              vs.emplace_back( fanin[i] );
+            }
+            else if ( ntk.is_complemented( children[i] ) != ntk.constant_value( ntk.get_node( children[i] ) ) )
+            {
+              ++num_ones;
+            }
+            else
+            {
+              ++num_zeros;
+            }
+          }
+          const auto num_pairs = std::min( num_zeros, num_ones );
+          num_zeros -= num_pairs;
+          num_ones -= num_pairs;
+
+          if ( vs.size() == 3u && num_zeros + num_ones == 0u )
+          {
+            writer.on_assign_maj3( node_names[n], vs );
+          }
+          else if ( vs.size() > 1u && vs.size() == num_zeros + num_ones + 1u )
+          {
+            /* all the remaining fanins (or any of them) have to be 1 */
+            writer.on_assign( node_names[n], vs, num_zeros > 0u ? "&" : "|" );
+          }
+          else
+          {
+            /* at least three of the five fanins are 1 */
+            std::vector<std::pair<bool, std::string>> terms;
+            for ( auto i = 0u; i < 5u; ++i )
+            {
+              for ( auto j = i + 1u; j < 5u; ++j )
+              {
+                for ( auto k = j + 1u; k < 5u; ++k )
+                {
+                  terms.emplace_back( false, fmt::format( "( {}{} & {}{} & {}{} )",
+                                                          fanin[i].first ? "~" : "", fanin[i].second,
+                                                          fanin[j].first ? "~" : "", fanin[j].second,
+                                                          fanin[k].first ? "~" : "", fanin[k].second ) );
+                }
+              }
+            }
+            writer.on_assign( node_names[n], terms, "|" );
+          }
+          return true;
+        }
+      }
       if constexpr ( has_is_nary_and_v<Ntk> )
       {
         if ( ntk.is_nary_and( n ) )
@@ -149,6 +149,7 @@
 #include "mockturtle/io/genlib_reader.hpp"
 #include "mockturtle/io/pla_reader.hpp"
 #include "mockturtle/io/serialize.hpp"
+#include "mockturtle/io/snapshot.hpp"
 #include "mockturtle/io/super_reader.hpp"
 #include "mockturtle/io/verilog_reader.hpp"
 #include "mockturtle/io/write_aiger.hpp"
@@ -166,6 +167,7 @@
 #include "mockturtle/networks/detail/foreach.hpp"
 #include "mockturtle/networks/events.hpp"
 #include "mockturtle/networks/klut.hpp"
+#include "mockturtle/networks/maj5.hpp"
 #include "mockturtle/networks/mig.hpp"
 #include "mockturtle/networks/muxig.hpp"
 #include "mockturtle/networks/sequential.hpp"
@@ -192,8 +194,10 @@
 #include "mockturtle/utils/network_cache.hpp"
 #include "mockturtle/utils/network_utils.hpp"
 #include "mockturtle/utils/node_map.hpp"
+#include "mockturtle/utils/npn4_table.hpp"
 #include "mockturtle/utils/progress_bar.hpp"
 #include "mockturtle/utils/recursive_cost_functions.hpp"
+#include "mockturtle/utils/simd.hpp"
 #include "mockturtle/utils/stopwatch.hpp"
 #include "mockturtle/utils/string_utils.hpp"
 #include "mockturtle/utils/super_utils.hpp"
@@ -214,5 +218,6 @@
 #include "mockturtle/views/mffc_view.hpp"
 #include "mockturtle/views/names_view.hpp"
 #include "mockturtle/views/topo_view.hpp"
+#include "mockturtle/views/traversal_view.hpp"
 #include "mockturtle/views/window_view.hpp"
 #include "mockturtle/views/rank_view.hpp"
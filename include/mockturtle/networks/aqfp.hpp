@@ -292,10 +292,7 @@ public:
     _storage->nodes[b.index].data[0].h1++;
     _storage->nodes[c.index].data[0].h1++;
 
-    for ( auto const& fn : _events->on_add )
-    {
-      ( *fn )( index );
-    }
+    _events->notify_add( index );
 
     return { index, node_complement };
   }
@@ -370,10 +367,7 @@ public:
       _storage->nodes[c.index].data[0].h1++;
     }
 
-    for ( auto const& fn : _events->on_add )
-    {
-      ( *fn )( index );
-    }
+    _events->notify_add( index );
 
     return { index, node_complement };
   }
@@ -498,10 +492,7 @@ public:
 
     /* TODO: Do the simplifications if possible and ordering */
 
-    for ( auto const& fn : _events->on_modified )
-    {
-      ( *fn )( n, old_children );
-    }
+    _events->notify_modified( n, old_children );
 
     return std::nullopt;
   }
@@ -530,10 +521,7 @@ public:
     auto& nobj = _storage->nodes[n];
     nobj.data[0].h1 = UINT32_C( 0x80000000 ); /* fanout size 0, but dead */
 
-    for ( auto const& fn : _events->on_delete )
-    {
-      ( *fn )( n );
-    }
+    _events->notify_delete( n );
 
     for ( auto i = 0u; i < nobj.children.size(); ++i )
     {
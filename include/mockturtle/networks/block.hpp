@@ -453,10 +453,7 @@ public:
 
     set_value( index, 0 );
 
-    for ( auto const& fn : _events->on_add )
-    {
-      ( *fn )( index );
-    }
+    _events->notify_add( index );
 
     return { index, 0 };
   }
@@ -483,10 +480,7 @@ public:
 
     set_value( index, 0 );
 
-    for ( auto const& fn : _events->on_add )
-    {
-      ( *fn )( index );
-    }
+    _events->notify_add( index );
 
     return { index, 0 };
   }
@@ -568,10 +562,7 @@ public:
       }
     }
 
-    for ( auto const& fn : _events->on_modified )
-    {
-      ( *fn )( n, old_children );
-    }
+    _events->notify_modified( n, old_children );
   }
 
   void replace_in_node_no_restrash( node const& n, node const& old_node, signal new_signal )
@@ -616,10 +607,7 @@ public:
       nobj.data[i].h2 = 0;
     }
 
-    for ( auto const& fn : _events->on_delete )
-    {
-      ( *fn )( n );
-    }
+    _events->notify_delete( n );
 
     /* if the node has been deleted, then deref fanout_size of
        fanins and try to take them out if their fanout_size become 0 */
@@ -55,6 +55,8 @@ public:
     auto& node = _storage->nodes.emplace_back();
     node.children[0] = a;
     node.children[1] = !a;
+    _storage->fanouts.add_node();
+    _storage->fanouts.add_fanins( index, node.children );
 
     if ( index >= .9 * _storage->nodes.capacity() )
     {
@@ -64,10 +66,7 @@ public:
     /* increase ref-count to children */
     _storage->nodes[a.index].data[0].h1++;
 
-    for ( auto const& fn : _events->on_add )
-    {
-      ( *fn )( index );
-    }
+    _events->notify_add( index );
 
     return { index, 0 };
   }
@@ -305,6 +304,8 @@ public:
     node.children[0] = a;
     node.children[1] = !a;
     // node.children[2] = a; // not used
+    _storage->fanouts.add_node();
+    _storage->fanouts.add_fanins( index, node.children );
 
     if ( index >= .9 * _storage->nodes.capacity() )
     {
@@ -314,10 +315,7 @@ public:
     /* increase ref-count to children */
     _storage->nodes[a.index].data[0].h1++;
 
-    for ( auto const& fn : _events->on_add )
-    {
-      ( *fn )( index );
-    }
+    _events->notify_add( index );
 
     return { index, 0 };
   }
@@ -350,6 +348,8 @@ public:
     assert( is_buf( old_node ) );
     auto& node = _storage->nodes[n];
 
+    const auto old_children = node.children;
+
     if ( is_buf( n ) )
     {
       assert( node.children[0].index == old_node );
@@ -357,6 +357,7 @@ public:
       node.children[0] = new_signal;
       node.children[1] = !new_signal;
       _storage->nodes[new_signal.index].data[0].h1++;
+      _storage->fanouts.update_fanins( n, old_children, node.children );
       return;
     }
 
@@ -395,6 +396,8 @@ public:
 
     // update the reference counter of the new signal
     _storage->nodes[new_signal.index].data[0].h1++;
+
+    _storage->fanouts.update_fanins( n, old_children, node.children );
   }
   void replace_in_outputs( node const& old_node, signal const& new_signal )
   {
@@ -421,11 +424,9 @@ public:
 
     auto& nobj = _storage->nodes[n];
     nobj.data[0].h1 = UINT32_C( 0x80000000 ); /* fanout size 0, but dead */
+    _storage->fanouts.remove_fanins( n, nobj.children );
 
-    for ( auto const& fn : _events->on_delete )
-    {
-      ( *fn )( n );
-    }
+    _events->notify_delete( n );
 
     if ( decr_fanout_size( nobj.children[0].index ) == 0 )
     {
@@ -681,10 +682,7 @@ public:
     /* increase ref-count to children */
     _storage->nodes[a.index].data[0].h1++;
 
-    for ( auto const& fn : _events->on_add )
-    {
-      ( *fn )( index );
-    }
+    _events->notify_add( index );
 
     return { index, 0 };
   }
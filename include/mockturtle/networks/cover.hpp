@@ -392,10 +392,7 @@ public:
 
     set_value( index, 0 );
 
-    for ( auto const& fn : _events->on_add )
-    {
-      ( *fn )( index );
-    }
+    _events->notify_add( index );
 
     return index;
   }
@@ -470,10 +467,7 @@ public:
           // increment fan-out of new node
           _storage->nodes[new_signal].data[0].h1++;
 
-          for ( auto const& fn : _events->on_modified )
-          {
-            ( *fn )( i, old_children );
-          }
+          _events->notify_modified( i, old_children );
         }
       }
     }
@@ -322,10 +322,7 @@ public:
       _storage->nodes[c.index].data[0].h1++;
     }
 
-    for ( auto const& fn : _events->on_add )
-    {
-      ( *fn )( index );
-    }
+    _events->notify_add( index );
 
     return signal( index, 0 );
   }
@@ -377,10 +374,7 @@ public:
     _storage->nodes[in2.index].data[0].h1++;
 
     /* TODO: not sure if this is wanted/needed? */
-    for ( auto const& fn : _events->on_add )
-    {
-      ( *fn )( index );
-    }
+    _events->notify_add( index );
 
     return std::make_pair( signal( index, 0 ), signal( index, 1 ) );
   }
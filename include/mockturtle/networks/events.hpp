@@ -36,11 +36,15 @@
 
 #include "../traits.hpp"
 
+#include <cassert>
+#include <cstdint>
 #include <functional>
 #include <vector>
 #include <iostream>
 #include <memory>
 #include <algorithm>
+#include <initializer_list>
+#include <unordered_map>
 
 namespace mockturtle
 {
@@ -50,6 +54,25 @@ namespace mockturtle
  * This data structure can be returned by a network.  Clients can add functions
  * to network events to call code whenever an event occurs.  Events are adding
  * a node, modifying a node, and deleting a node.
+ *
+ * Networks announce events through `notify_add`, `notify_modified`, and
+ * `notify_delete`, which return immediately if no callback is registered.
+ *
+ * Between `begin_batch` and `commit_batch`, events are not delivered but
+ * collected, and `commit_batch` delivers the net effect of the batch once per
+ * node: an add event for each node that was added (or revived) and is still
+ * alive, a modified event with the children at the beginning of the batch for
+ * each other modified node, and a delete event for each other node that was
+ * deleted.  Add events are delivered first, then modified events, and then
+ * delete events; each callback receives all events of one kind before the
+ * next callback.  Callbacks therefore observe the network after the batch,
+ * and state derived from events (e.g., in views) is only updated at commit;
+ * in particular, edits inside a batch must not rely on such state.  For
+ * instance, `fanout_view::substitute_node` then substitutes through the
+ * network, which finds fanouts in its fanout index (if built) or by scanning
+ * all nodes.  `rewrite` and `resubstitution` (with
+ * `resubstitution_params::use_fanout_index`) batch the events of each
+ * substitution.
  */
 template<class Ntk>
 class network_events
@@ -117,6 +140,132 @@ public:
                      std::end( on_delete ) );
   }
 
+  /*! \brief Calls the add events for node `n`. */
+  void notify_add( node<Ntk> const& n )
+  {
+    if ( _batch_depth > 0u )
+    {
+      auto& entry = batch_entry( n, true );
+      entry.alive = true;
+      return;
+    }
+
+    for ( auto const& fn : on_add )
+    {
+      ( *fn )( n );
+    }
+  }
+
+  /*! \brief Calls the modified events for node `n`. */
+  void notify_modified( node<Ntk> const& n, std::vector<signal<Ntk>> const& previous_children )
+  {
+    if ( _batch_depth > 0u )
+    {
+      auto& entry = batch_entry( n, false );
+      if ( !entry.added && !entry.modified )
+      {
+        entry.modified = true;
+        entry.previous_children = previous_children;
+      }
+      return;
+    }
+
+    for ( auto const& fn : on_modified )
+    {
+      ( *fn )( n, previous_children );
+    }
+  }
+
+  /*! \brief Calls the modified events for node `n`.
+   *
+   * The children are only copied into a vector if they are needed.
+   */
+  void notify_modified( node<Ntk> const& n, std::initializer_list<signal<Ntk>> previous_children )
+  {
+    if ( on_modified.empty() && _batch_depth == 0u )
+    {
+      return;
+    }
+    notify_modified( n, std::vector<signal<Ntk>>( previous_children ) );
+  }
+
+  /*! \brief Calls the delete events for node `n`. */
+  void notify_delete( node<Ntk> const& n )
+  {
+    if ( _batch_depth > 0u )
+    {
+      batch_entry( n, false ).alive = false;
+      return;
+    }
+
+    for ( auto const& fn : on_delete )
+    {
+      ( *fn )( n );
+    }
+  }
+
+  /*! \brief Starts collecting events instead of delivering them.
+   *
+   * Batches can be nested; events are delivered when the outermost batch is
+   * committed.
+   */
+  void begin_batch()
+  {
+    ++_batch_depth;
+  }
+
+  /*! \brief Delivers the events collected since the matching `begin_batch`. */
+  void commit_batch()
+  {
+    assert( _batch_depth > 0u );
+    if ( --_batch_depth > 0u )
+    {
+      return;
+    }
+
+    /* events raised by callbacks during delivery are not batched */
+    auto entries = std::move( _batch_entries );
+    _batch_entries.clear();
+    _batch_index.clear();
+
+    for ( auto const& fn : on_add )
+    {
+      for ( auto const& entry : entries )
+      {
+        if ( entry.added && entry.alive )
+        {
+          ( *fn )( entry.n );
+        }
+      }
+    }
+    for ( auto const& fn : on_modified )
+    {
+      for ( auto const& entry : entries )
+      {
+        if ( !entry.added && entry.modified )
+        {
+          ( *fn )( entry.n, entry.previous_children );
+        }
+      }
+    }
+    for ( auto const& fn : on_delete )
+    {
+      for ( auto const& entry : entries )
+      {
+        if ( !entry.added && !entry.alive )
+        {
+          ( *fn )( entry.n );
+        }
+      }
+    }
+  }
+
+  /*! \brief Returns whether events are currently collected. */
+  bool in_batch() const
+  {
+    return _batch_depth > 0u;
+  }
+
 public:
   /*! \brief Event when node `n` is added. */
   std::vector<std::shared_ptr<add_event_type>> on_add;
@@ -130,6 +279,31 @@ public:
 
   /*! \brief Event when `n` is deleted. */
   std::vector<std::shared_ptr<delete_event_type>> on_delete;
+
+private:
+  struct batched_node
+  {
+    node<Ntk> n;
+    bool added;
+    bool alive{ true };
+    bool modified{ false };
+    std::vector<signal<Ntk>> previous_children;
+  };
+
+  /* entry of `n` in the batch, created by its first event */
+  batched_node& batch_entry( node<Ntk> const& n, bool added )
+  {
+    auto const [it, inserted] = _batch_index.emplace( n, static_cast<uint32_t>( _batch_entries.size() ) );
+    if ( inserted )
+    {
+      _batch_entries.push_back( batched_node{ n, added } );
+    }
+    return _batch_entries[it->second];
+  }
+
+  uint32_t _batch_depth{ 0 };
+  std::vector<batched_node> _batch_entries;
+  std::unordered_map<node<Ntk>, uint32_t> _batch_index;
 };
 
 } // namespace mockturtle
\ No newline at end of file
@@ -422,10 +422,7 @@ public:
 
     set_value( index, 0 );
 
-    for ( auto const& fn : _events->on_add )
-    {
-      ( *fn )( index );
-    }
+    _events->notify_add( index );
 
     return index;
   }
@@ -486,10 +483,7 @@ public:
         // increment fan-out of new node
         _storage->nodes[new_signal].data[0].h1++;
 
-        for ( auto const& fn : _events->on_modified )
-        {
-          ( *fn )( n, old_children );
-        }
+        _events->notify_modified( n, old_children );
       }
     }
     return std::nullopt;
@@ -524,10 +518,7 @@ public:
       _register_information->erase( n );
     }
 
-    for ( auto const& fn : _events->on_delete )
-    {
-      ( *fn )( n );
-    }
+    _events->notify_delete( n );
 
     for ( auto& child : nobj.children )
     {
@@ -570,10 +561,7 @@ public:
           // increment fan-out of new node
           _storage->nodes[new_signal].data[0].h1++;
 
-          for ( auto const& fn : _events->on_modified )
-          {
-            ( *fn )( i, old_children );
-          }
+          _events->notify_modified( i, old_children );
         }
       }
     }
@@ -0,0 +1,1209 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2022  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file maj5.hpp
+  \brief Majority-5 logic network implementation
+
+  The network mirrors `mig_network` with 5-input majority gates.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <stack>
+#include <string>
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/operators.hpp>
+
+#include "../traits.hpp"
+#include "../utils/algorithm.hpp"
+#include "detail/foreach.hpp"
+#include "events.hpp"
+#include "storage.hpp"
+
+namespace mockturtle
+{
+
+/*! \brief MAJ5 storage container
+
+  MAJ5 networks have nodes with fan-in 5.  We split of one bit of the index
+  pointer to store a complemented attribute.  Every node has 64-bit of
+  additional data used for the following purposes:
+
+  `data[0].h1`: Fan-out size (we use MSB to indicate whether a node is dead)
+  `data[0].h2`: Application-specific value
+  `data[1].h1`: Visited flag
+  `data[1].h2`: Is terminal node (PI or CI)
+*/
+using maj5_storage = storage<regular_node<5, 2, 1>>;
+
+/*! \brief Majority-5 network
+
+  Nodes compute the majority of five fanins.  Gates are kept in a canonical
+  form before structural hashing:
+
+  - fanins are sorted,
+  - a pair of complementary fanins `x, !x` cancels out; what remains is a
+    3-input majority and is stored as `<0, 1, a, b, c>`,
+  - a fanin that appears in a (remaining) majority, i.e., three times out of
+    five or twice out of three, is returned directly,
+  - by self-duality, at most two of the five fanins are complemented; the
+    output is complemented instead.
+
+  Hence `create_maj`, `create_and`, and `create_or` share nodes with
+  `create_maj5` calls that compute the same function.
+*/
+class maj5_network
+{
+public:
+#pragma region Types and constructors
+  static constexpr auto min_fanin_size = 5u;
+  static constexpr auto max_fanin_size = 5u;
+
+  using base_type = maj5_network;
+  using storage = std::shared_ptr<maj5_storage>;
+  using node = uint64_t;
+
+  struct signal
+  {
+    signal() = default;
+
+    signal( uint64_t index, uint64_t complement )
+        : complement( complement ), index( index )
+    {
+    }
+
+    explicit signal( uint64_t data )
+        : data( data )
+    {
+    }
+
+    signal( maj5_storage::node_type::pointer_type const& p )
+        : complement( p.weight ), index( p.index )
+    {
+    }
+
+    union
+    {
+      struct
+      {
+        uint64_t complement : 1;
+        uint64_t index : 63;
+      };
+      uint64_t data;
+    };
+
+    signal operator!() const
+    {
+      return signal( data ^ 1 );
+    }
+
+    signal operator+() const
+    {
+      return { index, 0 };
+    }
+
+    signal operator-() const
+    {
+      return { index, 1 };
+    }
+
+    signal operator^( bool complement ) const
+    {
+      return signal( data ^ ( complement ? 1 : 0 ) );
+    }
+
+    bool operator==( signal const& other ) const
+    {
+      return data == other.data;
+    }
+
+    bool operator!=( signal const& other ) const
+    {
+      return data != other.data;
+    }
+
+    bool operator<( signal const& other ) const
+    {
+      return data < other.data;
+    }
+
+    operator maj5_storage::node_type::pointer_type() const
+    {
+      return { index, complement };
+    }
+
+#if __cplusplus > 201703L
+    bool operator==( maj5_storage::node_type::pointer_type const& other ) const
+    {
+      return data == other.data;
+    }
+#endif
+  };
+
+  maj5_network()
+      : _storage( std::make_shared<maj5_storage>() ),
+        _events( std::make_shared<decltype( _events )::element_type>() )
+  {
+  }
+
+  maj5_network( std::shared_ptr<maj5_storage> storage )
+      : _storage( storage ),
+        _events( std::make_shared<decltype( _events )::element_type>() )
+  {
+  }
+
+  maj5_network clone() const
+  {
+    return { std::make_shared<maj5_storage>( *_storage ) };
+  }
+#pragma endregion
+
+#pragma region Primary I / O and constants
+  signal get_constant( bool value ) const
+  {
+    return { 0, static_cast<uint64_t>( value ? 1 : 0 ) };
+  }
+
+  signal create_pi()
+  {
+    const auto index = _storage->nodes.size();
+    auto& node = _storage->nodes.emplace_back();
+    for ( auto& c : node.children )
+    {
+      c.data = _storage->inputs.size();
+    }
+    node.data[1].h2 = 1; // mark as PI
+    _storage->inputs.emplace_back( index );
+    return { index, 0 };
+  }
+
+  uint32_t create_po( signal const& f )
+  {
+    /* increase ref-count to children */
+    _storage->nodes[f.index].data[0].h1++;
+    auto const po_index = static_cast<uint32_t>( _storage->outputs.size() );
+    _storage->outputs.emplace_back( f.index, f.complement );
+    return po_index;
+  }
+
+  bool is_combinational() const
+  {
+    return true;
+  }
+
+  bool is_constant( node const& n ) const
+  {
+    return n == 0;
+  }
+
+  bool is_ci( node const& n ) const
+  {
+    return _storage->nodes[n].data[1].h2 == 1;
+  }
+
+  bool is_pi( node const& n ) const
+  {
+    return _storage->nodes[n].data[1].h2 == 1 && !is_constant( n );
+  }
+
+  bool constant_value( node const& n ) const
+  {
+    (void)n;
+    return false;
+  }
+#pragma endregion
+
+#pragma region Create unary functions
+  signal create_buf( signal const& a )
+  {
+    return a;
+  }
+
+  signal create_not( signal const& a )
+  {
+    return !a;
+  }
+#pragma endregion
+
+#pragma region Create binary / ternary functions
+  signal create_maj5( signal a, signal b, signal c, signal d, signal e )
+  {
+    std::array<signal, 5u> fs{ a, b, c, d, e };
+
+    /* order inputs and check for trivial cases */
+    if ( const auto trivial = simplify_fanins( fs ); trivial )
+    {
+      return *trivial;
+    }
+
+    /* complemented edges minimization */
+    const auto node_complement = normalize_complements( fs );
+
+    storage::element_type::node_type node;
+    std::copy( fs.begin(), fs.end(), node.children.begin() );
+
+    /* structural hashing */
+    const auto it = _storage->hash.find( node );
+    if ( it != _storage->hash.end() )
+    {
+      return { it->second, node_complement };
+    }
+
+    const auto index = _storage->nodes.size();
+
+    if ( index >= .9 * _storage->nodes.capacity() )
+    {
+      _storage->nodes.reserve( static_cast<uint64_t>( 3.1415f * index ) );
+    }
+
+    _storage->nodes.push_back( node );
+
+    _storage->hash[node] = index;
+
+    /* increase ref-count to children */
+    for ( auto const& f : fs )
+    {
+      _storage->nodes[f.index].data[0].h1++;
+    }
+
+    _events->notify_add( index );
+
+    return { index, node_complement };
+  }
+
+  signal create_maj( signal const& a, signal const& b, signal const& c )
+  {
+    return create_maj5( get_constant( false ), get_constant( true ), a, b, c );
+  }
+
+  signal create_and( signal const& a, signal const& b )
+  {
+    return create_maj( get_constant( false ), a, b );
+  }
+
+  signal create_nand( signal const& a, signal const& b )
+  {
+    return !create_and( a, b );
+  }
+
+  signal create_or( signal const& a, signal const& b )
+  {
+    return create_maj( get_constant( true ), a, b );
+  }
+
+  signal create_nor( signal const& a, signal const& b )
+  {
+    return !create_or( a, b );
+  }
+
+  signal create_lt( signal const& a, signal const& b )
+  {
+    return create_and( !a, b );
+  }
+
+  signal create_le( signal const& a, signal const& b )
+  {
+    return !create_and( a, !b );
+  }
+
+  signal create_xor( signal const& a, signal const& b )
+  {
+    const auto fcompl = a.complement ^ b.complement;
+    const auto c1 = create_and( +a, -b );
+    const auto c2 = create_and( +b, -a );
+    return create_and( !c1, !c2 ) ^ !fcompl;
+  }
+
+  signal create_ite( signal cond, signal f_then, signal f_else )
+  {
+    bool f_compl{ false };
+    if ( f_then.index < f_else.index )
+    {
+      std::swap( f_then, f_else );
+      cond.complement ^= 1;
+    }
+    if ( f_then.complement )
+    {
+      f_then.complement = 0;
+      f_else.complement ^= 1;
+      f_compl = true;
+    }
+
+    return create_and( !create_and( !cond, f_else ), !create_and( cond, f_then ) ) ^ !f_compl;
+  }
+
+  signal create_xor3( signal const& a, signal const& b, signal const& c )
+  {
+    const auto f = create_maj( a, !b, c );
+    const auto g = create_maj( a, b, !c );
+    return create_maj( !a, f, g );
+  }
+#pragma endregion
+
+#pragma region Create nary functions
+  signal create_nary_and( std::vector<signal> const& fs )
+  {
+    return tree_reduce( fs.begin(), fs.end(), get_constant( true ), [this]( auto const& a, auto const& b ) { return create_and( a, b ); } );
+  }
+
+  signal create_nary_or( std::vector<signal> const& fs )
+  {
+    return tree_reduce( fs.begin(), fs.end(), get_constant( false ), [this]( auto const& a, auto const& b ) { return create_or( a, b ); } );
+  }
+
+  signal create_nary_xor( std::vector<signal> const& fs )
+  {
+    return tree_reduce( fs.begin(), fs.end(), get_constant( false ), [this]( auto const& a, auto const& b ) { return create_xor( a, b ); } );
+  }
+#pragma endregion
+
+#pragma region Create arbitrary functions
+  signal clone_node( maj5_network const& other, node const& source, std::vector<signal> const& children )
+  {
+    (void)other;
+    (void)source;
+    assert( children.size() == 5u );
+    return create_maj5( children[0u], children[1u], children[2u], children[3u], children[4u] );
+  }
+#pragma endregion
+
+#pragma region Has node
+  std::optional<signal> has_maj5( signal a, signal b, signal c, signal d, signal e )
+  {
+    std::array<signal, 5u> fs{ a, b, c, d, e };
+
+    /* order inputs and check for trivial cases */
+    if ( const auto trivial = simplify_fanins( fs ); trivial )
+    {
+      return *trivial;
+    }
+
+    /* complemented edges minimization */
+    const auto node_complement = normalize_complements( fs );
+
+    storage::element_type::node_type node;
+    std::copy( fs.begin(), fs.end(), node.children.begin() );
+
+    /* structural hashing */
+    const auto it = _storage->hash.find( node );
+    if ( it != _storage->hash.end() )
+    {
+      assert( !is_dead( it->second ) );
+      return signal( it->second, node_complement );
+    }
+
+    return {};
+  }
+
+  std::optional<signal> has_maj( signal const& a, signal const& b, signal const& c )
+  {
+    return has_maj5( get_constant( false ), get_constant( true ), a, b, c );
+  }
+#pragma endregion
+
+#pragma region Restructuring
+  std::optional<std::pair<node, signal>> replace_in_node( node const& n, node const& old_node, signal new_signal )
+  {
+    auto& node = _storage->nodes[n];
+
+    std::array<signal, 5u> fs;
+    std::copy( node.children.begin(), node.children.end(), fs.begin() );
+
+    const auto it_fanin = std::find_if( fs.begin(), fs.end(), [&]( auto const& f ) { return f.index == old_node; } );
+    if ( it_fanin == fs.end() )
+    {
+      return std::nullopt;
+    }
+    new_signal.complement ^= it_fanin->complement;
+    *it_fanin = new_signal;
+
+    // determine potential new children of node n and check for trivial cases
+    if ( const auto trivial = simplify_fanins( fs ); trivial )
+    {
+      return std::make_pair( n, *trivial );
+    }
+
+    // node already in hash table
+    storage::element_type::node_type _hash_obj;
+    std::copy( fs.begin(), fs.end(), _hash_obj.children.begin() );
+    if ( const auto it = _storage->hash.find( _hash_obj ); it != _storage->hash.end() && it->second != old_node )
+    {
+      return std::make_pair( n, signal( it->second, 0 ) );
+    }
+
+    // remember before
+    std::vector<signal> old_children( node.children.begin(), node.children.end() );
+
+    // erase old node in hash table
+    _storage->hash.erase( node );
+
+    // insert updated node into hash table
+    std::copy( fs.begin(), fs.end(), node.children.begin() );
+    _storage->hash[node] = n;
+
+    // update the reference counters; a complementary pair may have been
+    // replaced by constants, so all children are recounted
+    for ( auto const& f : fs )
+    {
+      _storage->nodes[f.index].data[0].h1++;
+    }
+    for ( auto const& f : old_children )
+    {
+      _storage->nodes[f.index].data[0].h1--;
+    }
+
+    _events->notify_modified( n, old_children );
+
+    return std::nullopt;
+  }
+
+  void replace_in_node_no_restrash( node const& n, node const& old_node, signal new_signal )
+  {
+    auto& node = _storage->nodes[n];
+
+    std::array<signal, 5u> fs;
+    std::copy( node.children.begin(), node.children.end(), fs.begin() );
+
+    const auto it_fanin = std::find_if( fs.begin(), fs.end(), [&]( auto const& f ) { return f.index == old_node; } );
+    if ( it_fanin == fs.end() )
+    {
+      return;
+    }
+    new_signal.complement ^= it_fanin->complement;
+    *it_fanin = new_signal;
+
+    // determine potential new children of node n
+    sort_fanins( fs );
+
+    // don't check for trivial cases
+
+    // remember before
+    std::vector<signal> old_children( node.children.begin(), node.children.end() );
+
+    // erase old node in hash table
+    _storage->hash.erase( node );
+
+    // insert updated node into hash table
+    std::copy( fs.begin(), fs.end(), node.children.begin() );
+    if ( _storage->hash.find( node ) == _storage->hash.end() )
+    {
+      _storage->hash[node] = n;
+    }
+
+    // update the reference counter of the new signal
+    _storage->nodes[new_signal.index].data[0].h1++;
+    // update the reference counter of the old signal
+    _storage->nodes[old_node].data[0].h1--;
+
+    _events->notify_modified( n, old_children );
+  }
+
+  void replace_in_outputs( node const& old_node, signal const& new_signal )
+  {
+    if ( is_dead( old_node ) )
+      return;
+
+    for ( auto& output : _storage->outputs )
+    {
+      if ( output.index == old_node )
+      {
+        output.index = new_signal.index;
+        output.weight ^= new_signal.complement;
+
+        if ( old_node != new_signal.index )
+        {
+          // increment fan-out of new node
+          _storage->nodes[new_signal.index].data[0].h1++;
+          // decrement fan-out of old node
+          _storage->nodes[old_node].data[0].h1--;
+        }
+      }
+    }
+  }
+
+  void take_out_node( node const& n )
+  {
+    /* we cannot delete CIs, constants, or already dead nodes */
+    if ( n == 0 || is_ci( n ) || is_dead( n ) )
+      return;
+
+    auto& nobj = _storage->nodes[n];
+    nobj.data[0].h1 = UINT32_C( 0x80000000 ); /* fanout size 0, but dead */
+    _storage->hash.erase( nobj );
+
+    _events->notify_delete( n );
+
+    for ( auto i = 0u; i < 5u; ++i )
+    {
+      if ( fanout_size( nobj.children[i].index ) == 0 )
+      {
+        continue;
+      }
+      if ( decr_fanout_size( nobj.children[i].index ) == 0 )
+      {
+        take_out_node( nobj.children[i].index );
+      }
+    }
+  }
+
+  void revive_node( node const& n )
+  {
+    if ( !is_dead( n ) )
+      return;
+
+    assert( n < _storage->nodes.size() );
+    auto& nobj = _storage->nodes[n];
+    nobj.data[0].h1 = UINT32_C( 0 ); /* fanout size 0, but not dead (like just created) */
+    _storage->hash[nobj] = n;
+
+    _events->notify_add( n );
+
+    /* revive its children if dead, and increment their fanout_size */
+    for ( auto i = 0u; i < 5u; ++i )
+    {
+      if ( is_dead( nobj.children[i].index ) )
+      {
+        revive_node( nobj.children[i].index );
+      }
+      incr_fanout_size( nobj.children[i].index );
+    }
+  }
+
+  inline bool is_dead( node const& n ) const
+  {
+    return ( _storage->nodes[n].data[0].h1 >> 31 ) & 1;
+  }
+
+  void substitute_node( node const& old_node, signal const& new_signal )
+  {
+    std::unordered_map<node, signal> old_to_new;
+    std::stack<std::pair<node, signal>> to_substitute;
+    to_substitute.push( { old_node, new_signal } );
+
+    while ( !to_substitute.empty() )
+    {
+      const auto [_old, _curr] = to_substitute.top();
+      to_substitute.pop();
+
+      signal _new = _curr;
+      /* find the real new node */
+      if ( is_dead( get_node( _new ) ) )
+      {
+        auto it = old_to_new.find( get_node( _new ) );
+        while ( it != old_to_new.end() )
+        {
+          _new = is_complemented( _new ) ? create_not( it->second ) : it->second;
+          it = old_to_new.find( get_node( _new ) );
+        }
+      }
+      /* revive */
+      if ( is_dead( get_node( _new ) ) )
+      {
+        revive_node( get_node( _new ) );
+      }
+
+      for ( auto idx = 1u; idx < _storage->nodes.size(); ++idx )
+      {
+        if ( is_ci( idx ) || is_dead( idx ) )
+          continue; /* ignore CIs */
+
+        if ( const auto repl = replace_in_node( idx, _old, _new ); repl )
+        {
+          to_substitute.push( *repl );
+        }
+      }
+
+      /* check outputs */
+      replace_in_outputs( _old, _new );
+
+      // reset fan-in of old node
+      if ( _old != _new.index )
+      {
+        old_to_new.insert( { _old, _new } );
+        take_out_node( _old );
+      }
+    }
+  }
+
+  void substitute_node_no_restrash( node const& old_node, signal const& new_signal )
+  {
+    if ( is_dead( get_node( new_signal ) ) )
+    {
+      revive_node( get_node( new_signal ) );
+    }
+
+    for ( auto idx = 1u; idx < _storage->nodes.size(); ++idx )
+    {
+      if ( is_ci( idx ) || is_dead( idx ) )
+        continue; /* ignore CIs and dead nodes */
+
+      replace_in_node_no_restrash( idx, old_node, new_signal );
+    }
+
+    /* check outputs */
+    replace_in_outputs( old_node, new_signal );
+
+    /* recursively reset old node */
+    if ( old_node != new_signal.index )
+    {
+      take_out_node( old_node );
+    }
+  }
+#pragma endregion
+
+#pragma region Structural properties
+  auto size() const
+  {
+    return static_cast<uint32_t>( _storage->nodes.size() );
+  }
+
+  auto num_cis() const
+  {
+    return static_cast<uint32_t>( _storage->inputs.size() );
+  }
+
+  auto num_cos() const
+  {
+    return static_cast<uint32_t>( _storage->outputs.size() );
+  }
+
+  auto num_pis() const
+  {
+    return static_cast<uint32_t>( _storage->inputs.size() );
+  }
+
+  auto num_pos() const
+  {
+    return static_cast<uint32_t>( _storage->outputs.size() );
+  }
+
+  auto num_gates() const
+  {
+    return static_cast<uint32_t>( _storage->hash.size() );
+  }
+
+  uint32_t fanin_size( node const& n ) const
+  {
+    if ( is_constant( n ) || is_ci( n ) )
+      return 0;
+    return 5;
+  }
+
+  uint32_t fanout_size( node const& n ) const
+  {
+    return _storage->nodes[n].data[0].h1 & UINT32_C( 0x7FFFFFFF );
+  }
+
+  uint32_t incr_fanout_size( node const& n ) const
+  {
+    return _storage->nodes[n].data[0].h1++ & UINT32_C( 0x7FFFFFFF );
+  }
+
+  uint32_t decr_fanout_size( node const& n ) const
+  {
+    return --_storage->nodes[n].data[0].h1 & UINT32_C( 0x7FFFFFFF );
+  }
+
+  bool is_and( node const& n ) const
+  {
+    (void)n;
+    return false;
+  }
+
+  bool is_or( node const& n ) const
+  {
+    (void)n;
+    return false;
+  }
+
+  bool is_xor( node const& n ) const
+  {
+    (void)n;
+    return false;
+  }
+
+  bool is_maj( node const& n ) const
+  {
+    (void)n;
+    return false;
+  }
+
+  bool is_maj5( node const& n ) const
+  {
+    return n > 0 && !is_ci( n );
+  }
+
+  bool is_ite( node const& n ) const
+  {
+    (void)n;
+    return false;
+  }
+
+  bool is_xor3( node const& n ) const
+  {
+    (void)n;
+    return false;
+  }
+
+  bool is_nary_and( node const& n ) const
+  {
+    (void)n;
+    return false;
+  }
+
+  bool is_nary_or( node const& n ) const
+  {
+    (void)n;
+    return false;
+  }
+
+  bool is_nary_xor( node const& n ) const
+  {
+    (void)n;
+    return false;
+  }
+#pragma endregion
+
+#pragma region Functional properties
+  kitty::dynamic_truth_table node_function( const node& n ) const
+  {
+    (void)n;
+    kitty::dynamic_truth_table _maj5( 5 );
+    _maj5._bits[0] = 0xfee8e880;
+    return _maj5;
+  }
+#pragma endregion
+
+#pragma region Nodes and signals
+  node get_node( signal const& f ) const
+  {
+    return f.index;
+  }
+
+  signal make_signal( node const& n ) const
+  {
+    return signal( n, 0 );
+  }
+
+  bool is_complemented( signal const& f ) const
+  {
+    return f.complement;
+  }
+
+  uint32_t node_to_index( node const& n ) const
+  {
+    return static_cast<uint32_t>( n );
+  }
+
+  node index_to_node( uint32_t index ) const
+  {
+    return index;
+  }
+
+  node ci_at( uint32_t index ) const
+  {
+    assert( index < _storage->inputs.size() );
+    return *( _storage->inputs.begin() + index );
+  }
+
+  signal co_at( uint32_t index ) const
+  {
+    assert( index < _storage->outputs.size() );
+    return *( _storage->outputs.begin() + index );
+  }
+
+  node pi_at( uint32_t index ) const
+  {
+    assert( index < _storage->inputs.size() );
+    return *( _storage->inputs.begin() + index );
+  }
+
+  signal po_at( uint32_t index ) const
+  {
+    assert( index < _storage->outputs.size() );
+    return *( _storage->outputs.begin() + index );
+  }
+
+  uint32_t ci_index( node const& n ) const
+  {
+    assert( _storage->nodes[n].children[0].data == _storage->nodes[n].children[1].data &&
+            _storage->nodes[n].children[0].data == _storage->nodes[n].children[4].data );
+    return static_cast<uint32_t>( _storage->nodes[n].children[0].data );
+  }
+
+  uint32_t co_index( signal const& s ) const
+  {
+    uint32_t i = -1;
+    foreach_co( [&]( const auto& x, auto index ) {
+      if ( x == s )
+      {
+        i = index;
+        return false;
+      }
+      return true;
+    } );
+    return i;
+  }
+
+  uint32_t pi_index( node const& n ) const
+  {
+    assert( _storage->nodes[n].children[0].data == _storage->nodes[n].children[1].data &&
+            _storage->nodes[n].children[0].data == _storage->nodes[n].children[4].data );
+    return static_cast<uint32_t>( _storage->nodes[n].children[0].data );
+  }
+
+  uint32_t po_index( signal const& s ) const
+  {
+    uint32_t i = -1;
+    foreach_po( [&]( const auto& x, auto index ) {
+      if ( x == s )
+      {
+        i = index;
+        return false;
+      }
+      return true;
+    } );
+    return i;
+  }
+#pragma endregion
+
+#pragma region Node and signal iterators
+  template<typename Fn>
+  void foreach_node( Fn&& fn ) const
+  {
+    auto r = range<uint64_t>( _storage->nodes.size() );
+    detail::foreach_element_if(
+        r.begin(), r.end(),
+        [this]( auto n ) { return !is_dead( n ); },
+        fn );
+  }
+
+  template<typename Fn>
+  void foreach_ci( Fn&& fn ) const
+  {
+    detail::foreach_element( _storage->inputs.begin(), _storage->inputs.end(), fn );
+  }
+
+  template<typename Fn>
+  void foreach_co( Fn&& fn ) const
+  {
+    detail::foreach_element( _storage->outputs.begin(), _storage->outputs.end(), fn );
+  }
+
+  template<typename Fn>
+  void foreach_pi( Fn&& fn ) const
+  {
+    detail::foreach_element( _storage->inputs.begin(), _storage->inputs.end(), fn );
+  }
+
+  template<typename Fn>
+  void foreach_po( Fn&& fn ) const
+  {
+    detail::foreach_element( _storage->outputs.begin(), _storage->outputs.end(), fn );
+  }
+
+  template<typename Fn>
+  void foreach_gate( Fn&& fn ) const
+  {
+    auto r = range<uint64_t>( 1u, _storage->nodes.size() ); // start from 1 to avoid constant
+    detail::foreach_element_if(
+        r.begin(), r.end(),
+        [this]( auto n ) { return !is_ci( n ) && !is_dead( n ); },
+        fn );
+  }
+
+  template<typename Fn>
+  void foreach_fanin( node const& n, Fn&& fn ) const
+  {
+    if ( n == 0 || is_ci( n ) )
+      return;
+
+    using IteratorType = decltype( _storage->nodes[n].children.begin() );
+    detail::foreach_element_transform<IteratorType, signal>(
+        _storage->nodes[n].children.begin(), _storage->nodes[n].children.end(), []( auto f ) { return signal( f ); }, fn );
+  }
+#pragma endregion
+
+#pragma region Value simulation
+  template<typename Iterator>
+  iterates_over_t<Iterator, bool>
+  compute( node const& n, Iterator begin, Iterator end ) const
+  {
+    (void)end;
+
+    assert( n != 0 && !is_ci( n ) );
+
+    auto ones = 0u;
+    for ( auto const& c : _storage->nodes[n].children )
+    {
+      ones += ( *begin++ ^ c.weight ) ? 1u : 0u;
+    }
+    return ones >= 3u;
+  }
+
+  template<typename Iterator>
+  iterates_over_truth_table_t<Iterator>
+  compute( node const& n, Iterator begin, Iterator end ) const
+  {
+    (void)end;
+
+    assert( n != 0 && !is_ci( n ) );
+
+    auto const& c = _storage->nodes[n].children;
+
+    auto tt1 = *begin++;
+    auto tt2 = *begin++;
+    auto tt3 = *begin++;
+    auto tt4 = *begin++;
+    auto tt5 = *begin++;
+
+    if ( c[0].weight )
+      tt1 = ~tt1;
+    if ( c[1].weight )
+      tt2 = ~tt2;
+    if ( c[2].weight )
+      tt3 = ~tt3;
+    if ( c[3].weight )
+      tt4 = ~tt4;
+    if ( c[4].weight )
+      tt5 = ~tt5;
+
+    /* at least three ones: all of the first three, two of them and one of
+       the last two, or one of them and both of the last two */
+    return ( tt1 & tt2 & tt3 ) | ( kitty::ternary_majority( tt1, tt2, tt3 ) & ( tt4 | tt5 ) ) | ( ( tt1 | tt2 | tt3 ) & tt4 & tt5 );
+  }
+
+  /*! \brief Re-compute the last block. */
+  template<typename Iterator>
+  void compute( node const& n, kitty::partial_truth_table& result, Iterator begin, Iterator end ) const
+  {
+    static_assert( iterates_over_v<Iterator, kitty::partial_truth_table>, "begin and end have to iterate over partial_truth_tables" );
+
+    (void)end;
+    assert( n != 0 && !is_ci( n ) );
+
+    auto const& c = _storage->nodes[n].children;
+
+    std::array<uint64_t, 5u> words;
+    uint32_t num_bits = 0u;
+    for ( auto i = 0u; i < 5u; ++i )
+    {
+      auto const& tt = *begin++;
+      assert( tt.num_bits() > 0 && "truth tables must not be empty" );
+      assert( i == 0u || tt.num_bits() == num_bits );
+      num_bits = tt.num_bits();
+      words[i] = c[i].weight ? ~tt._bits.back() : tt._bits.back();
+    }
+
+    assert( num_bits >= result.num_bits() );
+    assert( result.num_blocks() == ( num_bits + 63 ) / 64 || ( result.num_blocks() == ( num_bits + 63 ) / 64 - 1 && result.num_bits() % 64 == 0 ) );
+
+    const auto maj3 = ( words[0] & words[1] ) | ( words[0] & words[2] ) | ( words[1] & words[2] );
+
+    result.resize( num_bits );
+    result._bits.back() =
+        ( words[0] & words[1] & words[2] ) |
+        ( maj3 & ( words[3] | words[4] ) ) |
+        ( ( words[0] | words[1] | words[2] ) & words[3] & words[4] );
+    result.mask_bits();
+  }
+#pragma endregion
+
+#pragma region Custom node values
+  void clear_values() const
+  {
+    std::for_each( _storage->nodes.begin(), _storage->nodes.end(), []( auto& n ) { n.data[0].h2 = 0; } );
+  }
+
+  auto value( node const& n ) const
+  {
+    return _storage->nodes[n].data[0].h2;
+  }
+
+  void set_value( node const& n, uint32_t v ) const
+  {
+    _storage->nodes[n].data[0].h2 = v;
+  }
+
+  auto incr_value( node const& n ) const
+  {
+    return _storage->nodes[n].data[0].h2++;
+  }
+
+  auto decr_value( node const& n ) const
+  {
+    return --_storage->nodes[n].data[0].h2;
+  }
+#pragma endregion
+
+#pragma region Visited flags
+  void clear_visited() const
+  {
+    std::for_each( _storage->nodes.begin(), _storage->nodes.end(), []( auto& n ) { n.data[1].h1 = 0; } );
+  }
+
+  auto visited( node const& n ) const
+  {
+    return _storage->nodes[n].data[1].h1;
+  }
+
+  void set_visited( node const& n, uint32_t v ) const
+  {
+    _storage->nodes[n].data[1].h1 = v;
+  }
+
+  uint32_t trav_id() const
+  {
+    return _storage->trav_id;
+  }
+
+  void incr_trav_id() const
+  {
+    ++_storage->trav_id;
+  }
+#pragma endregion
+
+#pragma region General methods
+  auto& events() const
+  {
+    return *_events;
+  }
+#pragma endregion
+
+private:
+#pragma region Canonization
+  /* insertion sort on the signal data, i.e., by index and then complement */
+  static void sort_fanins( std::array<signal, 5u>& fs )
+  {
+    for ( auto i = 1u; i < 5u; ++i )
+    {
+      for ( auto j = i; j > 0u && fs[j].data < fs[j - 1].data; --j )
+      {
+        std::swap( fs[j], fs[j - 1] );
+      }
+    }
+  }
+
+  /* sorts the fanins and brings them into the canonical form described at
+     the class; returns the equivalent signal if the majority is trivial */
+  std::optional<signal> simplify_fanins( std::array<signal, 5u>& fs ) const
+  {
+    sort_fanins( fs );
+
+    /* cancel complementary pairs; after sorting, `!x` directly follows the
+       copies of `x` */
+    std::array<signal, 5u> rest;
+    auto k = 0u;
+    for ( auto const& f : fs )
+    {
+      if ( k > 0u && rest[k - 1u] == !f )
+      {
+        --k;
+      }
+      else
+      {
+        rest[k++] = f;
+      }
+    }
+
+    switch ( k )
+    {
+    case 1u:
+      return rest[0];
+    case 3u:
+      if ( rest[0] == rest[1] || rest[1] == rest[2] )
+      {
+        return rest[1];
+      }
+      fs = { get_constant( false ), get_constant( true ), rest[0], rest[1], rest[2] };
+      sort_fanins( fs );
+      return std::nullopt;
+    default:
+      assert( k == 5u );
+      for ( auto i = 0u; i < 3u; ++i )
+      {
+        if ( fs[i] == fs[i + 2u] )
+        {
+          return fs[i];
+        }
+      }
+      return std::nullopt;
+    }
+  }
+
+  /* keeps at most two complemented fanins (self-duality); returns whether
+     the output has to be complemented */
+  static bool normalize_complements( std::array<signal, 5u>& fs )
+  {
+    auto num_complemented = 0u;
+    for ( auto const& f : fs )
+    {
+      num_complemented += f.complement;
+    }
+    if ( num_complemented < 3u )
+    {
+      return false;
+    }
+    for ( auto& f : fs )
+    {
+      f.complement = !f.complement;
+    }
+    sort_fanins( fs );
+    return true;
+  }
+#pragma endregion
+
+public:
+  std::shared_ptr<maj5_storage> _storage;
+  std::shared_ptr<network_events<base_type>> _events;
+};
+
+} // namespace mockturtle
+
+namespace std
+{
+
+template<>
+struct hash<mockturtle::maj5_network::signal>
+{
+  uint64_t operator()( mockturtle::maj5_network::signal const& s ) const noexcept
+  {
+    uint64_t k = s.data;
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccd;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53;
+    k ^= k >> 33;
+    return k;
+  }
+}; /* hash */
+
+} // namespace std
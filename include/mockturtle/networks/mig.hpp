@@ -71,109 +71,165 @@ namespace mockturtle
 */
 using mig_storage = storage<regular_node<3, 2, 1>>;
 
-class mig_network
-{
-public:
-#pragma region Types and constructors
-  static constexpr auto min_fanin_size = 3u;
-  static constexpr auto max_fanin_size = 3u;
+/*! \brief MIG storage container with a structure-of-arrays layout
 
-  using base_type = mig_network;
-  using storage = std::shared_ptr<mig_storage>;
-  using node = uint64_t;
+  Same node contents as `mig_storage`, but the fanins and each data word are
+  kept in separate contiguous arrays (see `soa_node_vector`).
+*/
+using mig_soa_storage = storage<regular_node<3, 2, 1>,
+                                empty_storage_data,
+                                node_hash<regular_node<3, 2, 1>>,
+                                soa_node_vector<3, 2, 1>>;
 
-  struct signal
-  {
-    signal() = default;
+struct mig_signal
+{
+  mig_signal() = default;
 
-    signal( uint64_t index, uint64_t complement )
-        : complement( complement ), index( index )
-    {
-    }
+  mig_signal( uint64_t index, uint64_t complement )
+      : complement( complement ), index( index )
+  {
+  }
 
-    explicit signal( uint64_t data )
-        : data( data )
-    {
-    }
+  explicit mig_signal( uint64_t data )
+      : data( data )
+  {
+  }
 
-    signal( mig_storage::node_type::pointer_type const& p )
-        : complement( p.weight ), index( p.index )
-    {
-    }
+  mig_signal( mig_storage::node_type::pointer_type const& p )
+      : complement( p.weight ), index( p.index )
+  {
+  }
 
-    union
+  union
+  {
+    struct
     {
-      struct
-      {
-        uint64_t complement : 1;
-        uint64_t index : 63;
-      };
-      uint64_t data;
+      uint64_t complement : 1;
+      uint64_t index : 63;
     };
+    uint64_t data;
+  };
 
-    signal operator!() const
-    {
-      return signal( data ^ 1 );
-    }
+  mig_signal operator!() const
+  {
+    return mig_signal( data ^ 1 );
+  }
 
-    signal operator+() const
-    {
-      return { index, 0 };
-    }
+  mig_signal operator+() const
+  {
+    return { index, 0 };
+  }
 
-    signal operator-() const
-    {
-      return { index, 1 };
-    }
+  mig_signal operator-() const
+  {
+    return { index, 1 };
+  }
 
-    signal operator^( bool complement ) const
-    {
-      return signal( data ^ ( complement ? 1 : 0 ) );
-    }
+  mig_signal operator^( bool complement ) const
+  {
+    return mig_signal( data ^ ( complement ? 1 : 0 ) );
+  }
 
-    bool operator==( signal const& other ) const
-    {
-      return data == other.data;
-    }
+  bool operator==( mig_signal const& other ) const
+  {
+    return data == other.data;
+  }
 
-    bool operator!=( signal const& other ) const
-    {
-      return data != other.data;
-    }
+  bool operator!=( mig_signal const& other ) const
+  {
+    return data != other.data;
+  }
 
-    bool operator<( signal const& other ) const
-    {
-      return data < other.data;
-    }
+  bool operator<( mig_signal const& other ) const
+  {
+    return data < other.data;
+  }
 
-    operator mig_storage::node_type::pointer_type() const
-    {
-      return { index, complement };
-    }
+  operator mig_storage::node_type::pointer_type() const
+  {
+    return { index, complement };
+  }
 
 #if __cplusplus > 201703L
-    bool operator==( mig_storage::node_type::pointer_type const& other ) const
-    {
-      return data == other.data;
-    }
+  bool operator==( mig_storage::node_type::pointer_type const& other ) const
+  {
+    return data == other.data;
+  }
 #endif
-  };
+};
+/*! \brief MIG over the storage container `Storage`
 
-  mig_network()
-      : _storage( std::make_shared<mig_storage>() ),
-        _events( std::make_shared<decltype( _events )::element_type>() )
+  Use `mig_network` (array of nodes) or `mig_soa_network` (structure of arrays).
+*/
+template<class Storage>
+class basic_mig_network
+{
+public:
+#pragma region Types and constructors
+  static constexpr auto min_fanin_size = 3u;
+  static constexpr auto max_fanin_size = 3u;
+
+  using base_type = basic_mig_network;
+  using storage = std::shared_ptr<Storage>;
+  using node = uint64_t;
+
+  using signal = mig_signal;
+
+  basic_mig_network()
+      : _storage( std::make_shared<Storage>() ),
+        _events( std::make_shared<typename decltype( _events )::element_type>() )
   {
   }
 
-  mig_network( std::shared_ptr<mig_storage> storage )
+  basic_mig_network( std::shared_ptr<Storage> storage )
       : _storage( storage ),
-        _events( std::make_shared<decltype( _events )::element_type>() )
+        _events( std::make_shared<typename decltype( _events )::element_type>() )
   {
   }
 
-  mig_network clone() const
+  basic_mig_network clone() const
   {
-    return { std::make_shared<mig_storage>( *_storage ) };
+    return { std::make_shared<Storage>( *_storage ) };
+  }
+
+  /*! \brief Reserves space for `num_nodes` nodes, including constant and PIs.
+   *
+   * Avoids repeated reallocation of the node vector and rehashing of the
+   * structural hash table when the final size is known in advance, e.g.,
+   * from the header of a file.
+   */
+  void reserve( uint64_t num_nodes )
+  {
+    /* nodes are reallocated at 90% of the capacity */
+    _storage->nodes.reserve( num_nodes + num_nodes / 8u + 1u );
+    _storage->hash.reserve( num_nodes );
+  }
+
+  /*! \brief Starts appending nodes without structural hashing.
+   *
+   * Reserves space for `num_nodes` nodes and suspends the structural hash
+   * table: `create_*` and `clone_node` still normalize their fanins and
+   * resolve trivial cases, but neither look up nor insert the node.  Use it
+   * only to create nodes (e.g., to copy a network in topological order)
+   * until `end_bulk` is called.
+   */
+  void begin_bulk( uint64_t num_nodes )
+  {
+    reserve( num_nodes );
+    _storage->hash.suspend();
+  }
+
+  /*! \brief Rebuilds the structural hash table after `begin_bulk`.
+   *
+   * Hashes all gates appended since `begin_bulk` on up to `num_threads`
+   * threads (all hardware threads for 0) and inserts them.  Returns the
+   * number of appended gates that are structurally equal to an earlier
+   * gate; these remain in the network, but are not in the hash table and
+   * hence not counted by `num_gates` (as after `substitute_node_no_restrash`).
+   */
+  uint64_t end_bulk( uint32_t num_threads = 0u )
+  {
+    return _storage->hash.resume( [this]( uint64_t n ) { return is_ci( static_cast<node>( n ) ) || is_dead( static_cast<node>( n ) ); }, num_threads );
   }
 #pragma endregion
 
@@ -186,10 +242,11 @@ public:
   signal create_pi()
   {
     const auto index = _storage->nodes.size();
-    auto& node = _storage->nodes.emplace_back();
+    auto&& node = _storage->nodes.emplace_back();
     node.children[0].data = node.children[1].data = node.children[2].data = _storage->inputs.size();
     node.data[1].h2 = 1; // mark as PI
     _storage->inputs.emplace_back( index );
+    _storage->fanouts.add_node();
     return { index, 0 };
   }
 
@@ -283,7 +340,7 @@ public:
       c.complement = !c.complement;
     }
 
-    storage::element_type::node_type node;
+    typename storage::element_type::node_type node;
     node.children[0] = a;
     node.children[1] = b;
     node.children[2] = c;
@@ -300,22 +357,20 @@ public:
     if ( index >= .9 * _storage->nodes.capacity() )
     {
       _storage->nodes.reserve( static_cast<uint64_t>( 3.1415f * index ) );
-      _storage->hash.reserve( static_cast<uint64_t>( 3.1415f * index ) );
     }
 
     _storage->nodes.push_back( node );
 
     _storage->hash[node] = index;
+    _storage->fanouts.add_node();
+    _storage->fanouts.add_fanins( index, node.children );
 
     /* increase ref-count to children */
     _storage->nodes[a.index].data[0].h1++;
     _storage->nodes[b.index].data[0].h1++;
     _storage->nodes[c.index].data[0].h1++;
 
-    for ( auto const& fn : _events->on_add )
-    {
-      ( *fn )( index );
-    }
+    _events->notify_add( index );
 
     return { index, node_complement };
   }
@@ -402,7 +457,7 @@ public:
 #pragma endregion
 
 #pragma region Create arbitrary functions
-  signal clone_node( mig_network const& other, node const& source, std::vector<signal> const& children )
+  signal clone_node( basic_mig_network const& other, node const& source, std::vector<signal> const& children )
   {
     (void)other;
     (void)source;
@@ -453,7 +508,7 @@ public:
       c.complement = !c.complement;
     }
 
-    storage::element_type::node_type node;
+    typename storage::element_type::node_type node;
     node.children[0] = a;
     node.children[1] = b;
     node.children[2] = c;
@@ -473,7 +528,7 @@ public:
 #pragma region Restructuring
   std::optional<std::pair<node, signal>> replace_in_node( node const& n, node const& old_node, signal new_signal )
   {
-    auto& node = _storage->nodes[n];
+    auto&& node = _storage->nodes[n];
 
     uint32_t fanin = 0u;
     for ( auto i = 0u; i < 4u; ++i )
@@ -525,7 +580,7 @@ public:
     }
 
     // node already in hash table
-    storage::element_type::node_type _hash_obj;
+    typename storage::element_type::node_type _hash_obj;
     _hash_obj.children[0] = child0;
     _hash_obj.children[1] = child1;
     _hash_obj.children[2] = child2;
@@ -553,17 +608,16 @@ public:
     // update the reference counter of the old signal
     _storage->nodes[old_node].data[0].h1--;
 
-    for ( auto const& fn : _events->on_modified )
-    {
-      ( *fn )( n, { old_child0, old_child1, old_child2 } );
-    }
+    _storage->fanouts.update_fanins( n, std::array{ old_child0, old_child1, old_child2 }, node.children );
+
+    _events->notify_modified( n, { old_child0, old_child1, old_child2 } );
 
     return std::nullopt;
   }
 
   void replace_in_node_no_restrash( node const& n, node const& old_node, signal new_signal )
   {
-    auto& node = _storage->nodes[n];
+    auto&& node = _storage->nodes[n];
 
     uint32_t fanin = 0u;
     for ( auto i = 0u; i < 4u; ++i )
@@ -626,10 +680,9 @@ public:
     // update the reference counter of the old signal
     _storage->nodes[old_node].data[0].h1--;
 
-    for ( auto const& fn : _events->on_modified )
-    {
-      ( *fn )( n, { old_child0, old_child1, old_child2 } );
-    }
+    _storage->fanouts.update_fanins( n, std::array{ old_child0, old_child1, old_child2 }, node.children );
+
+    _events->notify_modified( n, { old_child0, old_child1, old_child2 } );
   }
 
   void replace_in_outputs( node const& old_node, signal const& new_signal )
@@ -661,14 +714,12 @@ public:
     if ( n == 0 || is_ci( n ) || is_dead( n ) )
       return;
 
-    auto& nobj = _storage->nodes[n];
+    auto&& nobj = _storage->nodes[n];
     nobj.data[0].h1 = UINT32_C( 0x80000000 ); /* fanout size 0, but dead */
     _storage->hash.erase( nobj );
+    _storage->fanouts.remove_fanins( n, nobj.children );
 
-    for ( auto const& fn : _events->on_delete )
-    {
-      ( *fn )( n );
-    }
+    _events->notify_delete( n );
 
     for ( auto i = 0u; i < 3u; ++i )
     {
@@ -689,14 +740,12 @@ public:
       return;
 
     assert( n < _storage->nodes.size() );
-    auto& nobj = _storage->nodes[n];
+    auto&& nobj = _storage->nodes[n];
     nobj.data[0].h1 = UINT32_C( 0 ); /* fanout size 0, but not dead (like just created) */
     _storage->hash[nobj] = n;
+    _storage->fanouts.add_fanins( n, nobj.children );
 
-    for ( auto const& fn : _events->on_add )
-    {
-      ( *fn )( n );
-    }
+    _events->notify_add( n );
 
     /* revive its children if dead, and increment their fanout_size */
     for ( auto i = 0u; i < 3u; ++i )
@@ -742,16 +791,12 @@ public:
         revive_node( get_node( _new ) );
       }
 
-      for ( auto idx = 1u; idx < _storage->nodes.size(); ++idx )
-      {
-        if ( is_ci( idx ) || is_dead( idx ) )
-          continue; /* ignore CIs */
-
+      foreach_fanout_candidate( _old, [&]( auto const& idx ) {
         if ( const auto repl = replace_in_node( idx, _old, _new ); repl )
         {
           to_substitute.push( *repl );
         }
-      }
+      } );
 
       /* check outputs */
       replace_in_outputs( _old, _new );
@@ -772,13 +817,9 @@ public:
       revive_node( get_node( new_signal ) );
     }
 
-    for ( auto idx = 1u; idx < _storage->nodes.size(); ++idx )
-    {
-      if ( is_ci( idx ) || is_dead( idx ) )
-        continue; /* ignore CIs and dead nodes */
-
+    foreach_fanout_candidate( old_node, [&]( auto const& idx ) {
       replace_in_node_no_restrash( idx, old_node, new_signal );
-    }
+    } );
 
     /* check outputs */
     replace_in_outputs( old_node, new_signal );
@@ -791,6 +832,60 @@ public:
   }
 #pragma endregion
 
+#pragma region Fanout index
+  /*! \brief Builds the fanout index and keeps it up to date from now on.
+   *
+   * With the index enabled, `substitute_node` and its variants only visit
+   * the actual fanouts of the replaced node instead of scanning all nodes.
+   */
+  void build_fanout_index()
+  {
+    _storage->fanouts.reset( _storage->nodes.size(), 3u );
+    foreach_gate( [&]( auto const& n ) {
+      _storage->fanouts.add_fanins( n, _storage->nodes[n].children );
+    } );
+  }
+
+  /*! \brief Disables the fanout index and releases its memory. */
+  void clear_fanout_index()
+  {
+    _storage->fanouts.clear();
+  }
+
+  bool has_fanout_index() const
+  {
+    return _storage->fanouts.enabled;
+  }
+
+  /*! \brief Calls `fn` on the live gates that may have `n` as fanin.
+   *
+   * Without fanout index all live gates are visited; with the index only
+   * the fanouts of `n`.  In both cases gates are visited in index order.
+   */
+  template<typename Fn>
+  void foreach_fanout_candidate( node const& n, Fn&& fn ) const
+  {
+    if ( _storage->fanouts.enabled )
+    {
+      _storage->fanouts.foreach_fanout( n, [&]( auto const idx ) {
+        if ( !is_dead( idx ) )
+        {
+          fn( idx );
+        }
+      } );
+      return;
+    }
+
+    for ( auto idx = 1u; idx < _storage->nodes.size(); ++idx )
+    {
+      if ( is_ci( idx ) || is_dead( idx ) )
+        continue; /* ignore CIs and dead nodes */
+
+      fn( idx );
+    }
+  }
+#pragma endregion
+
 #pragma region Structural properties
   auto size() const
   {
@@ -1163,7 +1258,7 @@ public:
 #pragma region Custom node values
   void clear_values() const
   {
-    std::for_each( _storage->nodes.begin(), _storage->nodes.end(), []( auto& n ) { n.data[0].h2 = 0; } );
+    std::for_each( _storage->nodes.begin(), _storage->nodes.end(), []( auto&& n ) { n.data[0].h2 = 0; } );
   }
 
   auto value( node const& n ) const
@@ -1190,7 +1285,7 @@ public:
 #pragma region Visited flags
   void clear_visited() const
   {
-    std::for_each( _storage->nodes.begin(), _storage->nodes.end(), []( auto& n ) { n.data[1].h1 = 0; } );
+    std::for_each( _storage->nodes.begin(), _storage->nodes.end(), []( auto&& n ) { n.data[1].h1 = 0; } );
   }
 
   auto visited( node const& n ) const
@@ -1222,10 +1317,13 @@ public:
 #pragma endregion
 
 public:
-  std::shared_ptr<mig_storage> _storage;
+  std::shared_ptr<Storage> _storage;
   std::shared_ptr<network_events<base_type>> _events;
 };
 
+using mig_network = basic_mig_network<mig_storage>;
+using mig_soa_network = basic_mig_network<mig_soa_storage>;
+
 } // namespace mockturtle
 
 namespace std
@@ -39,13 +39,23 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <cassert>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <parallel_hashmap/phmap.h>
 
+#include "../utils/algorithm.hpp"
+
 namespace mockturtle
 {
 
@@ -159,6 +169,219 @@ struct block_fanin_node
   }
 };
 
+/*! \brief Node container with a structure-of-arrays layout.
+ *
+ * Replacement for `std::vector<regular_node<Fanin, Size, PointerFieldSize>>`
+ * that keeps the fanins of all nodes in one contiguous array and each data
+ * word in an array of its own.  Traversals that only follow fanins, or only
+ * read fanout counts or visited flags, therefore touch fewer cache lines.
+ *
+ * Element access returns a proxy with the members `children` (reference to
+ * the fanin array of the node) and `data` (indexable like the data array of
+ * `regular_node`), so proxies must be bound with `auto&&` instead of `auto&`.
+ */
+template<int Fanin, int Size = 0, int PointerFieldSize = 0>
+class soa_node_vector
+{
+public:
+  using value_type = regular_node<Fanin, Size, PointerFieldSize>;
+  using pointer_type = typename value_type::pointer_type;
+  using children_type = std::array<pointer_type, Fanin>;
+  using words_type = std::array<std::vector<cauint64_t>, Size>;
+
+  template<bool IsConst>
+  class basic_reference
+  {
+    using children_ref = std::conditional_t<IsConst, children_type const&, children_type&>;
+    using words_ref = std::conditional_t<IsConst, words_type const&, words_type&>;
+
+  public:
+    class data_reference
+    {
+    public:
+      data_reference( words_ref words, std::size_t index )
+          : _words( words ), _index( index )
+      {
+      }
+
+      auto& operator[]( std::size_t i ) const
+      {
+        return _words[i][_index];
+      }
+
+    private:
+      words_ref _words;
+      std::size_t _index;
+    };
+
+    basic_reference( children_ref children, words_ref words, std::size_t index )
+        : children( children ), data( words, index )
+    {
+    }
+
+    operator value_type() const
+    {
+      value_type node;
+      node.children = children;
+      for ( auto i = 0; i < Size; ++i )
+      {
+        node.data[i] = data[i];
+      }
+      return node;
+    }
+
+    bool operator==( value_type const& other ) const
+    {
+      return children == other.children;
+    }
+
+    children_ref children;
+    data_reference data;
+  };
+
+  using reference = basic_reference<false>;
+  using const_reference = basic_reference<true>;
+
+  template<bool IsConst>
+  class basic_iterator
+  {
+    using container_ref = std::conditional_t<IsConst, soa_node_vector const&, soa_node_vector&>;
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = soa_node_vector::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = basic_reference<IsConst>;
+    using pointer = void;
+
+    basic_iterator( container_ref nodes, std::size_t index )
+        : _nodes( &nodes ), _index( index )
+    {
+    }
+
+    reference operator*() const
+    {
+      return ( *_nodes )[_index];
+    }
+
+    basic_iterator& operator++()
+    {
+      ++_index;
+      return *this;
+    }
+
+    basic_iterator operator++( int )
+    {
+      auto const copy = *this;
+      ++_index;
+      return copy;
+    }
+
+    bool operator==( basic_iterator const& other ) const
+    {
+      return _index == other._index;
+    }
+
+    bool operator!=( basic_iterator const& other ) const
+    {
+      return _index != other._index;
+    }
+
+  private:
+    std::remove_reference_t<container_ref>* _nodes;
+    std::size_t _index;
+  };
+
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  reference operator[]( std::size_t n )
+  {
+    return { _children[n], _words, n };
+  }
+
+  const_reference operator[]( std::size_t n ) const
+  {
+    return { _children[n], _words, n };
+  }
+
+  reference back()
+  {
+    return ( *this )[_children.size() - 1u];
+  }
+
+  iterator begin()
+  {
+    return { *this, 0u };
+  }
+
+  iterator end()
+  {
+    return { *this, _children.size() };
+  }
+
+  const_iterator begin() const
+  {
+    return { *this, 0u };
+  }
+
+  const_iterator end() const
+  {
+    return { *this, _children.size() };
+  }
+
+  std::size_t size() const
+  {
+    return _children.size();
+  }
+
+  std::size_t capacity() const
+  {
+    return _children.capacity();
+  }
+
+  void reserve( std::size_t n )
+  {
+    _children.reserve( n );
+    for ( auto& w : _words )
+    {
+      w.reserve( n );
+    }
+  }
+
+  void clear()
+  {
+    _children.clear();
+    for ( auto& w : _words )
+    {
+      w.clear();
+    }
+  }
+
+  reference emplace_back()
+  {
+    _children.emplace_back();
+    for ( auto& w : _words )
+    {
+      w.emplace_back();
+    }
+    return back();
+  }
+
+  void push_back( value_type const& node )
+  {
+    _children.push_back( node.children );
+    for ( auto i = 0; i < Size; ++i )
+    {
+      _words[i].push_back( node.data[i] );
+    }
+  }
+
+private:
+  std::vector<children_type> _children;
+  words_type _words;
+};
+
 /*! \brief Hash function for 64-bit word */
 inline uint64_t hash_block( uint64_t word )
 {
@@ -209,7 +432,609 @@ struct empty_storage_data
 {
 };
 
-template<typename Node, typename T = empty_storage_data, typename NodeHasher = node_hash<Node>>
+/*! \brief Optional index of the fanouts of each node.
+ *
+ * Every fanin slot of a gate is an edge with id `gate * arity + slot`.  The
+ * edges pointing to node `n` form a doubly-linked list from `head[n]` to
+ * `tail[n]`, sorted by edge id and hence by fanout index.  All links are
+ * stored in flat arrays: updating a fanin does not allocate, and iterating
+ * the fanouts of a node neither copies nor sorts.  New gates have the
+ * largest index, so their edges are appended in constant time.
+ *
+ * The index is empty and not maintained until a network enables it (see
+ * `build_fanout_index`).
+ */
+struct fanout_index
+{
+  static constexpr uint64_t none = std::numeric_limits<uint64_t>::max();
+
+  bool enabled{ false };
+  uint32_t arity{ 0u };
+  std::vector<uint64_t> head; /* per node */
+  std::vector<uint64_t> tail;
+  std::vector<uint64_t> next; /* per edge */
+  std::vector<uint64_t> prev;
+
+  void reset( std::size_t num_nodes, uint32_t num_fanins )
+  {
+    enabled = true;
+    arity = num_fanins;
+    head.assign( num_nodes, none );
+    tail.assign( num_nodes, none );
+    next.assign( num_nodes * arity, none );
+    prev.assign( num_nodes * arity, none );
+  }
+
+  void clear()
+  {
+    enabled = false;
+    arity = 0u;
+    std::vector<uint64_t>().swap( head );
+    std::vector<uint64_t>().swap( tail );
+    std::vector<uint64_t>().swap( next );
+    std::vector<uint64_t>().swap( prev );
+  }
+
+  void add_node()
+  {
+    if ( enabled )
+    {
+      head.push_back( none );
+      tail.push_back( none );
+      next.resize( next.size() + arity, none );
+      prev.resize( prev.size() + arity, none );
+    }
+  }
+
+  /*! \brief Registers `n` as fanout of all its children. */
+  template<typename Children>
+  void add_fanins( uint64_t n, Children const& children )
+  {
+    if ( !enabled )
+      return;
+    auto edge = n * arity;
+    for ( auto const& c : children )
+    {
+      link( c.index, edge++ );
+    }
+  }
+
+  /*! \brief Unregisters `n` as fanout of all its children. */
+  template<typename Children>
+  void remove_fanins( uint64_t n, Children const& children )
+  {
+    if ( !enabled )
+      return;
+    auto edge = n * arity;
+    for ( auto const& c : children )
+    {
+      unlink( c.index, edge++ );
+    }
+  }
+
+  /*! \brief Updates the index after the children of `n` changed from `before` to `after`. */
+  template<typename Before, typename After>
+  void update_fanins( uint64_t n, Before const& before, After const& after )
+  {
+    if ( !enabled )
+      return;
+    auto edge = n * arity;
+    auto it = after.begin();
+    for ( auto const& c : before )
+    {
+      if ( c.index != it->index )
+      {
+        unlink( c.index, edge );
+        link( it->index, edge );
+      }
+      ++edge;
+      ++it;
+    }
+  }
+
+  /*! \brief Calls `fn` once on every fanout of `n`, in increasing index order.
+   *
+   * `fn` may change the fanins of the gate it is called on, but not those
+   * of other gates.
+   */
+  template<typename Fn>
+  void foreach_fanout( uint64_t n, Fn&& fn ) const
+  {
+    auto edge = head[n];
+    while ( edge != none )
+    {
+      auto const gate = edge / arity;
+      /* move past all slots of `gate` before `fn` relinks them */
+      do
+      {
+        edge = next[edge];
+      } while ( edge != none && edge / arity == gate );
+      fn( gate );
+    }
+  }
+
+private:
+  void link( uint64_t n, uint64_t edge )
+  {
+    auto pred = tail[n];
+    while ( pred != none && pred > edge )
+    {
+      pred = prev[pred];
+    }
+    auto const succ = pred == none ? head[n] : next[pred];
+    prev[edge] = pred;
+    next[edge] = succ;
+    ( pred == none ? head[n] : next[pred] ) = edge;
+    ( succ == none ? tail[n] : prev[succ] ) = edge;
+  }
+
+  void unlink( uint64_t n, uint64_t edge )
+  {
+    ( prev[edge] == none ? head[n] : next[prev[edge]] ) = next[edge];
+    ( next[edge] == none ? tail[n] : prev[next[edge]] ) = prev[edge];
+    prev[edge] = next[edge] = none;
+  }
+};
+
+namespace detail
+{
+
+template<class Archive, class = void>
+inline constexpr bool has_remaining_v = false;
+
+template<class Archive>
+inline constexpr bool has_remaining_v<Archive, std::void_t<decltype( std::declval<Archive const&>().remaining() )>> = true;
+
+} // namespace detail
+
+/*! \brief Structural hash table that stores node indices.
+ *
+ * An open-addressing (linear probing) table over the indices of the nodes
+ * in `nodes`.  Nodes are not copied into the table: hashing and comparison
+ * read them from the node vector the table is bound to.  Hence, a node must
+ * be erased from the table before its fanins are modified, and inserted
+ * again afterwards, which is what the networks do.
+ *
+ * The table offers the part of the map interface used by the networks
+ * (`find`, `end`, `erase`, `operator[]`, `size`, `reserve`, `clear`);
+ * iterators expose the node index as `second`.  `Nodes` is the node
+ * container, either `std::vector<Node>` or `soa_node_vector`.
+ */
+template<typename Node, typename NodeHasher = node_hash<Node>, typename Nodes = std::vector<Node>>
+class strash_table
+{
+public:
+  using index_type = uint32_t;
+  static constexpr index_type empty_slot = std::numeric_limits<index_type>::max();
+
+  /*! \brief Entry seen through an iterator, `second` is the node index. */
+  struct value_type
+  {
+    uint64_t second;
+  };
+
+  class const_iterator
+  {
+  public:
+    const_iterator() = default;
+    explicit const_iterator( index_type const* slot )
+        : _slot( slot ), _entry{ *slot }
+    {
+    }
+
+    value_type const* operator->() const
+    {
+      return &_entry;
+    }
+
+    value_type const& operator*() const
+    {
+      return _entry;
+    }
+
+    bool operator==( const_iterator const& other ) const
+    {
+      return _slot == other._slot;
+    }
+
+    bool operator!=( const_iterator const& other ) const
+    {
+      return _slot != other._slot;
+    }
+
+  private:
+    index_type const* _slot{ nullptr };
+    value_type _entry{ 0u };
+  };
+
+  /*! \brief Result of `operator[]`: assigning an index inserts it, reading looks it up. */
+  class reference
+  {
+  public:
+    reference( strash_table& table, Node const& key )
+        : _table( table ), _key( key )
+    {
+    }
+
+    reference& operator=( uint64_t index )
+    {
+      _table.insert_or_assign( _key, index );
+      return *this;
+    }
+
+    operator uint64_t() const
+    {
+      const auto it = _table.find( _key );
+      assert( it != _table.end() );
+      return it->second;
+    }
+
+  private:
+    strash_table& _table;
+    Node const& _key;
+  };
+
+  explicit strash_table( Nodes const& nodes )
+      : _nodes( &nodes )
+  {
+  }
+
+  /*! \brief Binds the table to the node vector of another storage (after copying). */
+  void bind( Nodes const& nodes )
+  {
+    _nodes = &nodes;
+  }
+
+  const_iterator find( Node const& key ) const
+  {
+    if ( _size == 0u || _suspended )
+    {
+      return end();
+    }
+    for ( auto pos = home( key );; pos = ( pos + 1u ) & _mask )
+    {
+      auto const idx = _slots[pos];
+      if ( idx == empty_slot )
+      {
+        return end();
+      }
+      if ( ( *_nodes )[idx] == key )
+      {
+        return const_iterator( &_slots[pos] );
+      }
+    }
+  }
+
+  const_iterator end() const
+  {
+    return {};
+  }
+
+  reference operator[]( Node const& key )
+  {
+    return { *this, key };
+  }
+
+  /*! \brief Inserts `index`, whose node must equal `key`, replacing an entry with the same key. */
+  void insert_or_assign( Node const& key, uint64_t index )
+  {
+    check_index( index );
+    if ( _suspended )
+    {
+      /* keeps `size` up to date for the number of gates */
+      ++_size;
+      return;
+    }
+    if ( 2u * ( _size + 1u ) > _slots.size() )
+    {
+      rehash( std::max<std::size_t>( 2u * _slots.size(), 16u ) );
+    }
+    for ( auto pos = home( key );; pos = ( pos + 1u ) & _mask )
+    {
+      auto& slot = _slots[pos];
+      if ( slot == empty_slot )
+      {
+        slot = static_cast<index_type>( index );
+        ++_size;
+        return;
+      }
+      if ( ( *_nodes )[slot] == key )
+      {
+        slot = static_cast<index_type>( index );
+        return;
+      }
+    }
+  }
+
+  std::size_t erase( Node const& key )
+  {
+    if ( _size == 0u || _suspended )
+    {
+      return 0u;
+    }
+
+    auto pos = home( key );
+    for ( ;; pos = ( pos + 1u ) & _mask )
+    {
+      if ( _slots[pos] == empty_slot )
+      {
+        return 0u;
+      }
+      if ( ( *_nodes )[_slots[pos]] == key )
+      {
+        break;
+      }
+    }
+
+    /* backward-shift deletion keeps probe sequences free of holes */
+    _slots[pos] = empty_slot;
+    --_size;
+    for ( auto next = ( pos + 1u ) & _mask; _slots[next] != empty_slot; next = ( next + 1u ) & _mask )
+    {
+      auto const h = home( ( *_nodes )[_slots[next]] );
+      if ( ( ( next - h ) & _mask ) >= ( ( next - pos ) & _mask ) )
+      {
+        _slots[pos] = _slots[next];
+        _slots[next] = empty_slot;
+        pos = next;
+      }
+    }
+    return 1u;
+  }
+
+  std::size_t size() const
+  {
+    return _size;
+  }
+
+  void reserve( std::size_t count )
+  {
+    if ( 2u * count > _slots.size() )
+    {
+      rehash( 2u * count );
+    }
+  }
+
+  void clear()
+  {
+    std::fill( _slots.begin(), _slots.end(), empty_slot );
+    _size = 0u;
+  }
+
+  /*! \brief Suspends the table while nodes are appended in bulk.
+   *
+   * Until `resume` is called, lookups find nothing and insertions and
+   * erasures are ignored, such that creating a node costs no hashing.
+   * Insertions are still counted by `size`.
+   */
+  void suspend()
+  {
+    assert( !_suspended );
+    _suspended = true;
+    _suspended_at = _nodes->size();
+    _size_at_suspend = _size;
+  }
+
+  bool suspended() const
+  {
+    return _suspended;
+  }
+
+  /*! \brief Inserts the nodes appended since `suspend` in one pass.
+   *
+   * Nodes for which `skip( index )` holds (e.g., inputs or dead nodes) are
+   * not inserted.  The hash values are computed on up to `num_threads`
+   * threads, the slots are then filled in index order.  A node equal to a
+   * node already in the table is not inserted; the function returns the
+   * number of such structural duplicates.
+   */
+  template<typename Fn>
+  uint64_t resume( Fn&& skip, uint32_t num_threads = 0u )
+  {
+    assert( _suspended );
+    _suspended = false;
+    _size = _size_at_suspend;
+
+    auto const first = _suspended_at;
+    auto const last = _nodes->size();
+    if ( first >= last )
+    {
+      return 0u;
+    }
+    check_index( last - 1u );
+    reserve( _size + ( last - first ) );
+
+    constexpr auto no_home = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> homes( last - first );
+    parallel_for( first, last, num_threads, [&]( uint64_t begin, uint64_t end, uint32_t ) {
+      for ( auto i = begin; i < end; ++i )
+      {
+        homes[i - first] = skip( i ) ? no_home : home( ( *_nodes )[i] );
+      }
+    } );
+
+    uint64_t duplicates = 0u;
+    for ( auto i = first; i < last; ++i )
+    {
+      if ( homes[i - first] == no_home )
+        continue;
+
+      for ( auto pos = homes[i - first];; pos = ( pos + 1u ) & _mask )
+      {
+        auto& slot = _slots[pos];
+        if ( slot == empty_slot )
+        {
+          slot = static_cast<index_type>( i );
+          ++_size;
+          break;
+        }
+        if ( ( *_nodes )[slot] == ( *_nodes )[i] )
+        {
+          ++duplicates;
+          break;
+        }
+      }
+    }
+    return duplicates;
+  }
+
+  /*! \brief Compares the (node, index) entries of two tables, like map equality. */
+  bool operator==( strash_table const& other ) const
+  {
+    if ( _size != other._size )
+    {
+      return false;
+    }
+    return std::all_of( _slots.begin(), _slots.end(), [&]( auto const idx ) {
+      if ( idx == empty_slot )
+        return true;
+      auto const it = other.find( ( *_nodes )[idx] );
+      return it != other.end() && it->second == idx;
+    } );
+  }
+
+  bool operator!=( strash_table const& other ) const
+  {
+    return !( *this == other );
+  }
+
+  template<typename OutputArchive>
+  bool dump( OutputArchive& ar ) const
+  {
+    uint64_t const num_slots = _slots.size(), size = _size;
+    return ar.dump( (char const*)&num_slots, sizeof( uint64_t ) ) &&
+           ar.dump( (char const*)&size, sizeof( uint64_t ) ) &&
+           ar.dump( (char const*)_slots.data(), sizeof( index_type ) * _slots.size() );
+  }
+
+  /*! \brief Loads the slots written by `dump`, returns false on invalid data.
+   *
+   * The table must be bound to the loaded nodes, slots referring to other
+   * nodes, slots referring to the same node twice, and tables above the
+   * maximum load factor of 1/2 (which keeps probe sequences finite) are
+   * rejected.  The number of occupied slots must equal the stored size.
+   * Archives with a `remaining` method (e.g., the snapshot reader) reject
+   * tables larger than the remaining data before allocating, other archives
+   * are read in chunks.
+   */
+  template<typename InputArchive>
+  bool load( InputArchive& ar )
+  {
+    uint64_t num_slots, size;
+    if ( !ar.load( (char*)&num_slots, sizeof( uint64_t ) ) || !ar.load( (char*)&size, sizeof( uint64_t ) ) ||
+         num_slots == 1u || ( num_slots & ( num_slots - 1u ) ) != 0u || 2u * size > num_slots )
+    {
+      return false;
+    }
+    if constexpr ( detail::has_remaining_v<InputArchive> )
+    {
+      if ( num_slots > ar.remaining() / sizeof( index_type ) )
+      {
+        return false;
+      }
+    }
+
+    std::vector<index_type> slots;
+    for ( uint64_t loaded = 0u; loaded < num_slots; )
+    {
+      auto const chunk = std::min<uint64_t>( num_slots - loaded, uint64_t( 1 ) << 20 );
+      slots.resize( loaded + chunk );
+      if ( !ar.load( (char*)( slots.data() + loaded ), sizeof( index_type ) * chunk ) )
+      {
+        return false;
+      }
+      loaded += chunk;
+    }
+
+    uint64_t occupied = 0u;
+    std::vector<bool> seen( _nodes->size(), false );
+    for ( auto const idx : slots )
+    {
+      if ( idx == empty_slot )
+        continue;
+
+      if ( idx >= _nodes->size() || seen[idx] )
+      {
+        return false;
+      }
+      seen[idx] = true;
+      ++occupied;
+    }
+    if ( occupied != size )
+    {
+      return false;
+    }
+
+    _slots = std::move( slots );
+    _mask = num_slots == 0u ? 0u : num_slots - 1u;
+    _shift = num_slots == 0u ? 63u : 64u - log2( num_slots );
+    _size = size;
+    return true;
+  }
+
+private:
+  static uint32_t log2( std::size_t n )
+  {
+    uint32_t k = 0u;
+    while ( ( std::size_t( 1 ) << k ) < n )
+    {
+      ++k;
+    }
+    return k;
+  }
+
+  /* slots store 32-bit node indexes; checked also in release builds */
+  static void check_index( uint64_t index )
+  {
+    if ( index >= empty_slot )
+    {
+      throw std::length_error( "strash_table: node index exceeds 32 bits" );
+    }
+  }
+
+  std::size_t home( Node const& key ) const
+  {
+    /* Fibonacci hashing spreads the node hash over the table */
+    return static_cast<std::size_t>( ( NodeHasher{}( key ) * UINT64_C( 0x9e3779b97f4a7c15 ) ) >> _shift ) & _mask;
+  }
+
+  void rehash( std::size_t num_slots )
+  {
+    num_slots = std::size_t( 1 ) << log2( num_slots );
+    auto const old_slots = std::exchange( _slots, std::vector<index_type>( num_slots, empty_slot ) );
+    _mask = num_slots - 1u;
+    _shift = 64u - log2( num_slots );
+
+    for ( auto const idx : old_slots )
+    {
+      if ( idx == empty_slot )
+        continue;
+
+      auto pos = home( ( *_nodes )[idx] );
+      while ( _slots[pos] != empty_slot )
+      {
+        pos = ( pos + 1u ) & _mask;
+      }
+      _slots[pos] = idx;
+    }
+  }
+
+  Nodes const* _nodes;
+  std::vector<index_type> _slots;
+  std::size_t _size{ 0u };
+  std::size_t _mask{ 0u };
+  uint32_t _shift{ 63u };
+  bool _suspended{ false };
+  std::size_t _suspended_at{ 0u };
+  std::size_t _size_at_suspend{ 0u };
+};
+
+/*! \brief Storage container of networks with structural hashing
+ *
+ * `Nodes` is the node container: `std::vector<Node>` (one array of nodes)
+ * or, for `regular_node`, a `soa_node_vector` (structure of arrays).
+ */
+template<typename Node, typename T = empty_storage_data, typename NodeHasher = node_hash<Node>, typename Nodes = std::vector<Node>>
 struct storage
 {
   storage()
@@ -221,15 +1046,67 @@ struct storage
     nodes.emplace_back();
   }
 
+  storage( storage const& other )
+      : trav_id( other.trav_id ),
+        nodes( other.nodes ),
+        inputs( other.inputs ),
+        outputs( other.outputs ),
+        hash( other.hash ),
+        fanouts( other.fanouts ),
+        data( other.data )
+  {
+    hash.bind( nodes );
+  }
+
+  storage& operator=( storage const& other )
+  {
+    trav_id = other.trav_id;
+    nodes = other.nodes;
+    inputs = other.inputs;
+    outputs = other.outputs;
+    hash = other.hash;
+    hash.bind( nodes );
+    fanouts = other.fanouts;
+    data = other.data;
+    return *this;
+  }
+
+  storage( storage&& other )
+      : trav_id( other.trav_id ),
+        nodes( std::move( other.nodes ) ),
+        inputs( std::move( other.inputs ) ),
+        outputs( std::move( other.outputs ) ),
+        hash( std::move( other.hash ) ),
+        fanouts( std::move( other.fanouts ) ),
+        data( std::move( other.data ) )
+  {
+    hash.bind( nodes );
+  }
+
+  storage& operator=( storage&& other )
+  {
+    trav_id = other.trav_id;
+    nodes = std::move( other.nodes );
+    inputs = std::move( other.inputs );
+    outputs = std::move( other.outputs );
+    hash = std::move( other.hash );
+    hash.bind( nodes );
+    fanouts = std::move( other.fanouts );
+    data = std::move( other.data );
+    return *this;
+  }
+
   using node_type = Node;
 
   uint32_t trav_id = 0u;
 
-  std::vector<node_type> nodes;
+  Nodes nodes;
   std::vector<uint64_t> inputs;
   std::vector<typename node_type::pointer_type> outputs;
 
-  phmap::flat_hash_map<node_type, uint64_t, NodeHasher> hash;
+  strash_table<node_type, NodeHasher, Nodes> hash{ nodes };
+
+  fanout_index fanouts;
 
   T data;
 };
@@ -174,6 +174,46 @@ public:
   {
     return { std::make_shared<xmg_storage>( *_storage ) };
   }
+
+  /*! \brief Reserves space for `num_nodes` nodes, including constant and PIs.
+   *
+   * Avoids repeated reallocation of the node vector and rehashing of the
+   * structural hash table when the final size is known in advance, e.g.,
+   * from the header of a file.
+   */
+  void reserve( uint64_t num_nodes )
+  {
+    /* nodes are reallocated at 90% of the capacity */
+    _storage->nodes.reserve( num_nodes + num_nodes / 8u + 1u );
+    _storage->hash.reserve( num_nodes );
+  }
+
+  /*! \brief Starts appending nodes without structural hashing.
+   *
+   * Reserves space for `num_nodes` nodes and suspends the structural hash
+   * table: `create_*` and `clone_node` still normalize their fanins and
+   * resolve trivial cases, but neither look up nor insert the node.  Use it
+   * only to create nodes (e.g., to copy a network in topological order)
+   * until `end_bulk` is called.
+   */
+  void begin_bulk( uint64_t num_nodes )
+  {
+    reserve( num_nodes );
+    _storage->hash.suspend();
+  }
+
+  /*! \brief Rebuilds the structural hash table after `begin_bulk`.
+   *
+   * Hashes all gates appended since `begin_bulk` on up to `num_threads`
+   * threads (all hardware threads for 0) and inserts them.  Returns the
+   * number of appended gates that are structurally equal to an earlier
+   * gate; these remain in the network, but are not in the hash table and
+   * hence not counted by `num_gates` (as after `substitute_node_no_restrash`).
+   */
+  uint64_t end_bulk( uint32_t num_threads = 0u )
+  {
+    return _storage->hash.resume( [this]( uint64_t n ) { return is_ci( static_cast<node>( n ) ) || is_dead( static_cast<node>( n ) ); }, num_threads );
+  }
 #pragma endregion
 
 #pragma region Primary I / O and constants
@@ -189,6 +229,7 @@ public:
     node.children[0].data = node.children[1].data = node.children[2].data = _storage->inputs.size();
     node.data[1].h2 = 1; // mark as PI
     _storage->inputs.emplace_back( index );
+    _storage->fanouts.add_node();
     return { index, 0 };
   }
 
@@ -296,22 +337,20 @@ public:
     if ( index >= .9 * _storage->nodes.capacity() )
     {
       _storage->nodes.reserve( static_cast<size_t>( 3.1415 * index ) );
-      _storage->hash.reserve( static_cast<size_t>( 3.1415 * index ) );
     }
 
     _storage->nodes.push_back( node );
 
     _storage->hash[node] = index;
+    _storage->fanouts.add_node();
+    _storage->fanouts.add_fanins( index, node.children );
 
     /* increase ref-count to children */
     _storage->nodes[a.index].data[0].h1++;
     _storage->nodes[b.index].data[0].h1++;
     _storage->nodes[c.index].data[0].h1++;
 
-    for ( auto const& fn : _events->on_add )
-    {
-      ( *fn )( index );
-    }
+    _events->notify_add( index );
 
     return { index, node_complement };
   }
@@ -363,22 +402,20 @@ public:
     if ( index >= .9 * _storage->nodes.capacity() )
     {
       _storage->nodes.reserve( static_cast<size_t>( 3.1415 * index ) );
-      _storage->hash.reserve( static_cast<size_t>( 3.1415 * index ) );
     }
 
     _storage->nodes.push_back( node );
 
     _storage->hash[node] = index;
+    _storage->fanouts.add_node();
+    _storage->fanouts.add_fanins( index, node.children );
 
     /* increase ref-count to children */
     _storage->nodes[a.index].data[0].h1++;
     _storage->nodes[b.index].data[0].h1++;
     _storage->nodes[c.index].data[0].h1++;
 
-    for ( auto const& fn : _events->on_add )
-    {
-      ( *fn )( index );
-    }
+    _events->notify_add( index );
 
     return { index, fcompl };
   }
@@ -716,10 +753,9 @@ public:
     // update the reference counter of the new signal
     _storage->nodes[new_signal.index].data[0].h1++;
 
-    for ( auto const& fn : _events->on_modified )
-    {
-      ( *fn )( n, { old_child0, old_child1, old_child2 } );
-    }
+    _storage->fanouts.update_fanins( n, std::array{ old_child0, old_child1, old_child2 }, node.children );
+
+    _events->notify_modified( n, { old_child0, old_child1, old_child2 } );
 
     return std::nullopt;
   }
@@ -850,10 +886,9 @@ public:
     // update the reference counter of the new signal
     _storage->nodes[new_signal.index].data[0].h1++;
 
-    for ( auto const& fn : _events->on_modified )
-    {
-      ( *fn )( n, { old_child0, old_child1, old_child2 } );
-    }
+    _storage->fanouts.update_fanins( n, std::array{ old_child0, old_child1, old_child2 }, node.children );
+
+    _events->notify_modified( n, { old_child0, old_child1, old_child2 } );
   }
 
   void replace_in_outputs( node const& old_node, signal const& new_signal )
@@ -886,11 +921,9 @@ public:
     auto& nobj = _storage->nodes[n];
     nobj.data[0].h1 = UINT32_C( 0x80000000 ); /* fanout size 0, but dead */
     _storage->hash.erase( nobj );
+    _storage->fanouts.remove_fanins( n, nobj.children );
 
-    for ( auto const& fn : _events->on_delete )
-    {
-      ( *fn )( n );
-    }
+    _events->notify_delete( n );
 
     for ( auto i = 0u; i < 3u; ++i )
     {
@@ -914,11 +947,9 @@ public:
     auto& nobj = _storage->nodes[n];
     nobj.data[0].h1 = UINT32_C( 0 ); /* fanout size 0, but not dead (like just created) */
     _storage->hash[nobj] = n;
+    _storage->fanouts.add_fanins( n, nobj.children );
 
-    for ( auto const& fn : _events->on_add )
-    {
-      ( *fn )( n );
-    }
+    _events->notify_add( n );
 
     /* revive its children if dead, and increment their fanout_size */
     for ( auto i = 0u; i < 3u; ++i )
@@ -964,16 +995,12 @@ public:
         revive_node( get_node( _new ) );
       }
 
-      for ( auto idx = 1u; idx < _storage->nodes.size(); ++idx )
-      {
-        if ( is_ci( idx ) || is_dead( idx ) )
-          continue; /* ignore CIs */
-
+      foreach_fanout_candidate( _old, [&]( auto const& idx ) {
         if ( const auto repl = replace_in_node( idx, _old, _new ); repl )
         {
           to_substitute.push( *repl );
         }
-      }
+      } );
 
       /* check outputs */
       replace_in_outputs( _old, _new );
@@ -994,13 +1021,9 @@ public:
       revive_node( get_node( new_signal ) );
     }
 
-    for ( auto idx = 1u; idx < _storage->nodes.size(); ++idx )
-    {
-      if ( is_ci( idx ) || is_dead( idx ) )
-        continue; /* ignore CIs and dead nodes */
-
+    foreach_fanout_candidate( old_node, [&]( auto const& idx ) {
       replace_in_node_no_restrash( idx, old_node, new_signal );
-    }
+    } );
 
     /* check outputs */
     replace_in_outputs( old_node, new_signal );
@@ -1013,6 +1036,60 @@ public:
   }
 #pragma endregion
 
+#pragma region Fanout index
+  /*! \brief Builds the fanout index and keeps it up to date from now on.
+   *
+   * With the index enabled, `substitute_node` and its variants only visit
+   * the actual fanouts of the replaced node instead of scanning all nodes.
+   */
+  void build_fanout_index()
+  {
+    _storage->fanouts.reset( _storage->nodes.size(), 3u );
+    foreach_gate( [&]( auto const& n ) {
+      _storage->fanouts.add_fanins( n, _storage->nodes[n].children );
+    } );
+  }
+
+  /*! \brief Disables the fanout index and releases its memory. */
+  void clear_fanout_index()
+  {
+    _storage->fanouts.clear();
+  }
+
+  bool has_fanout_index() const
+  {
+    return _storage->fanouts.enabled;
+  }
+
+  /*! \brief Calls `fn` on the live gates that may have `n` as fanin.
+   *
+   * Without fanout index all live gates are visited; with the index only
+   * the fanouts of `n`.  In both cases gates are visited in index order.
+   */
+  template<typename Fn>
+  void foreach_fanout_candidate( node const& n, Fn&& fn ) const
+  {
+    if ( _storage->fanouts.enabled )
+    {
+      _storage->fanouts.foreach_fanout( n, [&]( auto const idx ) {
+        if ( !is_dead( idx ) )
+        {
+          fn( idx );
+        }
+      } );
+      return;
+    }
+
+    for ( auto idx = 1u; idx < _storage->nodes.size(); ++idx )
+    {
+      if ( is_ci( idx ) || is_dead( idx ) )
+        continue; /* ignore CIs and dead nodes */
+
+      fn( idx );
+    }
+  }
+#pragma endregion
+
 #pragma region Structural properties
   uint32_t size() const
   {
@@ -138,6 +138,36 @@ template<class Ntk>
 inline constexpr bool has_clone_v = has_clone<Ntk>::value;
 #pragma endregion
 
+#pragma region has_reserve
+template<class Ntk, class = void>
+struct has_reserve : std::false_type
+{
+};
+
+template<class Ntk>
+struct has_reserve<Ntk, std::void_t<decltype( std::declval<Ntk>().reserve( uint64_t() ) )>> : std::true_type
+{
+};
+
+template<class Ntk>
+inline constexpr bool has_reserve_v = has_reserve<Ntk>::value;
+#pragma endregion
+
+#pragma region has_begin_bulk
+template<class Ntk, class = void>
+struct has_begin_bulk : std::false_type
+{
+};
+
+template<class Ntk>
+struct has_begin_bulk<Ntk, std::void_t<decltype( std::declval<Ntk>().begin_bulk( uint64_t() ) ), decltype( std::declval<Ntk>().end_bulk( uint32_t() ) )>> : std::true_type
+{
+};
+
+template<class Ntk>
+inline constexpr bool has_begin_bulk_v = has_begin_bulk<Ntk>::value;
+#pragma endregion
+
 #pragma region is_topologically_sorted
 template<class Ntk, class = void>
 struct is_topologically_sorted : std::false_type
@@ -798,6 +828,21 @@ template<class Ntk>
 inline constexpr bool has_substitute_nodes_v = has_substitute_nodes<Ntk>::value;
 #pragma endregion
 
+#pragma region has_build_fanout_index
+template<class Ntk, class = void>
+struct has_build_fanout_index : std::false_type
+{
+};
+
+template<class Ntk>
+struct has_build_fanout_index<Ntk, std::void_t<decltype( std::declval<Ntk>().build_fanout_index() )>> : std::true_type
+{
+};
+
+template<class Ntk>
+inline constexpr bool has_build_fanout_index_v = has_build_fanout_index<Ntk>::value;
+#pragma endregion
+
 #pragma region has_replace_in_node
 template<class Ntk, class = void>
 struct has_replace_in_node : std::false_type
@@ -1368,6 +1413,21 @@ template<class Ntk>
 inline constexpr bool has_is_maj_v = has_is_maj<Ntk>::value;
 #pragma endregion
 
+#pragma region has_is_maj5
+template<class Ntk, class = void>
+struct has_is_maj5 : std::false_type
+{
+};
+
+template<class Ntk>
+struct has_is_maj5<Ntk, std::void_t<decltype( std::declval<Ntk>().is_maj5( std::declval<node<Ntk>>() ) )>> : std::true_type
+{
+};
+
+template<class Ntk>
+inline constexpr bool has_is_maj5_v = has_is_maj5<Ntk>::value;
+#pragma endregion
+
 #pragma region has_is_ite
 template<class Ntk, class = void>
 struct has_is_ite : std::false_type
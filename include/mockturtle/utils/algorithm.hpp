@@ -35,7 +35,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <iterator>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 namespace mockturtle
 {
@@ -143,6 +148,46 @@ constexpr auto range( T end )
   return range<T>( {}, end );
 }
 
+/*! \brief Calls `fn( first, last, thread_id )` on chunks of `[begin, end)` in parallel.
+ *
+ * The range is split into at most `num_threads` contiguous chunks of at
+ * least `min_chunk` elements, one per thread; the calling thread processes
+ * the first chunk.  If `num_threads` is 0, the number of hardware threads is
+ * used.  Ranges that are too small for two chunks are processed on the
+ * calling thread only.
+ */
+template<class Fn>
+void parallel_for( uint64_t begin, uint64_t end, uint32_t num_threads, Fn&& fn, uint64_t min_chunk = 4096u )
+{
+  if ( num_threads == 0u )
+  {
+    num_threads = std::max( 1u, std::thread::hardware_concurrency() );
+  }
+
+  auto const size = end > begin ? end - begin : 0u;
+  auto const num_chunks = std::max<uint64_t>( 1u, std::min<uint64_t>( num_threads, size / std::max<uint64_t>( min_chunk, 1u ) ) );
+  if ( num_chunks == 1u )
+  {
+    fn( begin, end, 0u );
+    return;
+  }
+
+  auto const chunk = ( size + num_chunks - 1u ) / num_chunks;
+  std::vector<std::thread> threads;
+  threads.reserve( num_chunks - 1u );
+  for ( auto i = 1u; i < num_chunks; ++i )
+  {
+    auto const first = begin + i * chunk;
+    auto const last = std::min( end, first + chunk );
+    threads.emplace_back( [&fn, first, last, i]() { fn( first, last, static_cast<uint32_t>( i ) ); } );
+  }
+  fn( begin, std::min( end, begin + chunk ), 0u );
+  for ( auto& t : threads )
+  {
+    t.join();
+  }
+}
+
 /*! \brief Performs the set union of two sorted sets.
  *
  * Compared to std::set_union, limits the copy to `limit`.
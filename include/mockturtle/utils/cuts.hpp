@@ -42,6 +42,7 @@
 #include <kitty/detail/mscfix.hpp>
 
 #include "algorithm.hpp"
+#include "simd.hpp"
 
 namespace mockturtle
 {
@@ -98,7 +99,7 @@ public:
    */
   cut( cut const& other )
   {
-    _cend = _end = std::copy( other.begin(), other.end(), _leaves.begin() );
+    std::copy( other.begin(), other.end(), _leaves.begin() );
     _length = other._length;
     _signature = other._signature;
     _data = other._data;
@@ -146,13 +147,13 @@ public:
   auto begin() const { return _leaves.begin(); }
 
   /*! \brief End iterator (constant). */
-  auto end() const { return _cend; }
+  auto end() const { return _leaves.begin() + _length; }
 
   /*! \brief Begin iterator (mutable). */
   auto begin() { return _leaves.begin(); }
 
   /*! \brief End iterator (mutable). */
-  auto end() { return _end; }
+  auto end() { return _leaves.begin() + _length; }
 
   /*! \brief Access to data (mutable). */
   T* operator->() { return &_data; }
@@ -192,11 +193,11 @@ public:
   bool merge( cut const& that, cut& res, uint32_t cut_size ) const;
 
 private:
-  std::array<uint32_t, MaxLeaves> _leaves;
-  uint32_t _length;
-  uint64_t _signature;
-  typename std::array<uint32_t, MaxLeaves>::const_iterator _cend;
-  typename std::array<uint32_t, MaxLeaves>::iterator _end;
+  /* signature and length come first, such that the quick checks in `merge`
+   * and `dominates` read the same cache line as the first leaves */
+  uint64_t _signature{ 0u };
+  uint32_t _length{ 0u };
+  std::array<uint32_t, MaxLeaves> _leaves{};
 
   T _data;
 };
@@ -231,7 +232,7 @@ cut<MaxLeaves, T>& cut<MaxLeaves, T>::operator=( cut<MaxLeaves, T> const& other
 {
   if ( &other != this )
   {
-    _cend = _end = std::copy( other.begin(), other.end(), _leaves.begin() );
+    std::copy( other.begin(), other.end(), _leaves.begin() );
     _length = other._length;
     _signature = other._signature;
     _data = other._data;
@@ -243,7 +244,7 @@ template<int MaxLeaves, typename T>
 template<typename Iterator>
 void cut<MaxLeaves, T>::set_leaves( Iterator begin, Iterator end )
 {
-  _cend = _end = std::copy( begin, end, _leaves.begin() );
+  std::copy( begin, end, _leaves.begin() );
   _length = static_cast<uint32_t>( std::distance( begin, end ) );
   _signature = 0;
 
@@ -264,8 +265,7 @@ template<int MaxLeaves, typename T>
 template<typename Iterator>
 void cut<MaxLeaves, T>::add_leaves( Iterator begin, Iterator end )
 {
-  _cend = _end = std::copy( begin, end, _end );
-  _length = static_cast<uint32_t>( std::distance( _leaves.begin(), _end ) );
+  _length = static_cast<uint32_t>( std::distance( _leaves.begin(), std::copy( begin, end, this->end() ) ) );
 
   while ( begin != end )
   {
@@ -292,23 +292,38 @@ bool cut<MaxLeaves, T>::dominates( cut const& that ) const
     return true;
   }
 
-  // this is basically
-  //     return std::includes( that.begin(), that.end(), begin(), end() )
-  // but it turns out that this code is faster compared to the standard
-  // implementation.
-  for ( auto it2 = that.begin(), it1 = begin(); it2 != that.end(); ++it2 )
+  if constexpr ( detail::leaf_lanes > 1u )
   {
-    if ( *it2 > *it1 )
+    /* look up each leaf among all leaves of `that` at once */
+    for ( auto leaf : *this )
     {
-      return false;
+      if ( !detail::contains_leaf<MaxLeaves>( that._leaves.data(), that._length, leaf ) )
+      {
+        return false;
+      }
     }
-    if ( ( *it2 == *it1 ) && ( ++it1 == end() ) )
+    return true;
+  }
+  else
+  {
+    // this is basically
+    //     return std::includes( that.begin(), that.end(), begin(), end() )
+    // but it turns out that this code is faster compared to the standard
+    // implementation.
+    for ( auto it2 = that.begin(), it1 = begin(); it2 != that.end(); ++it2 )
     {
-      return true;
+      if ( *it2 > *it1 )
+      {
+        return false;
+      }
+      if ( ( *it2 == *it1 ) && ( ++it1 == end() ) )
+      {
+        return true;
+      }
     }
-  }
 
-  return false;
+    return false;
+  }
 }
 
 template<int MaxLeaves, typename T>
@@ -316,7 +331,8 @@ bool cut<MaxLeaves, T>::merge( cut const& that, cut& res, uint32_t cut_size ) co
 {
   if ( _length + that._length > cut_size )
   {
-    const auto sign = _signature + that._signature;
+    /* the union has at least as many leaves as bits in the joint signature */
+    const auto sign = _signature | that._signature;
     if ( uint32_t( __builtin_popcount( static_cast<uint32_t>( sign & 0xffffffff ) ) ) + uint32_t( __builtin_popcount( static_cast<uint32_t>( sign >> 32 ) ) ) > cut_size )
     {
       return false;
@@ -326,7 +342,6 @@ bool cut<MaxLeaves, T>::merge( cut const& that, cut& res, uint32_t cut_size ) co
   int32_t length = set_union_safe( begin(), end(), that.begin(), that.end(), res.begin(), cut_size );
   if ( length >= 0 )
   {
-    res._cend = res._end = res.begin() + length;
     res._length = static_cast<uint32_t>( length );
     res._signature = _signature | that._signature;
     return true;
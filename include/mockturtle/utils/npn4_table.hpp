@@ -0,0 +1,192 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2022  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file npn4_table.hpp
+  \brief Precomputed NPN classification of all 4-input functions
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <kitty/npn.hpp>
+#include <kitty/static_truth_table.hpp>
+
+namespace mockturtle
+{
+
+/*! \brief NPN configuration of a 4-input function.
+ *
+ * Follows the conventions of `kitty::exact_npn_canonization`: the function
+ * is obtained from `representative` with `kitty::create_from_npn_config`
+ * using `phase` (bits 0-3 input negations, bit 4 output negation) and
+ * `perm`.
+ */
+struct npn4_entry
+{
+  uint16_t representative;
+  uint8_t phase;
+  uint8_t class_index;
+  std::array<uint8_t, 4u> perm;
+};
+
+/*! \brief Precomputed NPN classification of all 4-input functions.
+ *
+ * The table maps each of the 65,536 functions over 4 variables to its NPN
+ * representative (the one `kitty::exact_npn_canonization` computes), the
+ * index of its class among the 222 classes, and a transformation.  It is
+ * built on first use, in one pass over the orbits of the classes, and shared
+ * by all users in the process, such that the canonization of a 4-input cut
+ * is one array load.
+ *
+   \verbatim embed:rst
+
+   Example
+
+   .. code-block:: c++
+
+      kitty::static_truth_table<4> tt = ...;
+      auto const& config = npn4_table::get()[tt];
+      // config.representative, config.phase, config.perm
+   \endverbatim
+ */
+class npn4_table
+{
+public:
+  static constexpr uint32_t num_vars = 4u;
+  static constexpr uint32_t num_functions = 1u << 16u;
+
+  /*! \brief Returns the table, building it on first use (thread-safe). */
+  static npn4_table const& get()
+  {
+    static const npn4_table table;
+    return table;
+  }
+
+  npn4_entry const& operator[]( uint16_t function ) const
+  {
+    return _entries[function];
+  }
+
+  npn4_entry const& operator[]( kitty::static_truth_table<num_vars> const& tt ) const
+  {
+    return _entries[static_cast<uint16_t>( *tt.cbegin() )];
+  }
+
+  /*! \brief Number of NPN classes (222). */
+  uint32_t num_classes() const
+  {
+    return static_cast<uint32_t>( _representatives.size() );
+  }
+
+  /*! \brief Representative of the class with the given index.
+   *
+   * Classes are numbered in increasing order of their smallest member.
+   */
+  uint16_t representative( uint32_t class_index ) const
+  {
+    assert( class_index < _representatives.size() );
+    return _representatives[class_index];
+  }
+
+private:
+  npn4_table()
+      : _entries( num_functions )
+  {
+    std::vector<bool> visited( num_functions, false );
+
+    kitty::static_truth_table<num_vars> tt;
+    for ( auto f = 0u; f < num_functions; ++f )
+    {
+      if ( visited[f] )
+      {
+        continue;
+      }
+
+      /* canonize one member of the class, then enumerate the class in the
+         order in which `kitty::exact_npn_canonization` visits the swaps and
+         flips: each member gets the transformation of the first state that
+         maps it to the representative, i.e., the one kitty returns */
+      tt._bits = f;
+      const auto repr = std::get<0>( kitty::exact_npn_canonization( tt ) );
+      const auto class_index = static_cast<uint8_t>( _representatives.size() );
+      _representatives.push_back( static_cast<uint16_t>( repr._bits ) );
+
+      const auto& swaps = kitty::detail::swaps[num_vars - 2u];
+      const auto& flips = kitty::detail::flips[num_vars - 2u];
+
+      const auto add_state = [&]( int32_t last_swap, int32_t last_flip ) {
+        std::vector<uint8_t> perm( num_vars );
+        std::iota( perm.begin(), perm.end(), 0u );
+        for ( auto i = 0; i <= last_swap; ++i )
+        {
+          std::swap( perm[swaps[i]], perm[swaps[i] + 1] );
+        }
+        uint32_t phase{ 0 };
+        for ( auto i = 0; i <= last_flip; ++i )
+        {
+          phase ^= 1u << flips[i];
+        }
+
+        for ( auto output_phase = 0u; output_phase < 2u; ++output_phase )
+        {
+          const auto config_phase = phase | ( output_phase << num_vars );
+          const auto g = static_cast<uint16_t>( kitty::create_from_npn_config( std::make_tuple( repr, config_phase, perm ) )._bits );
+          if ( visited[g] )
+          {
+            continue;
+          }
+          visited[g] = true;
+
+          auto& entry = _entries[g];
+          entry.representative = static_cast<uint16_t>( repr._bits );
+          entry.phase = static_cast<uint8_t>( config_phase );
+          entry.class_index = class_index;
+          std::copy( perm.begin(), perm.end(), entry.perm.begin() );
+        }
+      };
+
+      for ( auto j = -1; j < static_cast<int32_t>( flips.size() ); ++j )
+      {
+        for ( auto i = -1; i < static_cast<int32_t>( swaps.size() ); ++i )
+        {
+          add_state( i, j );
+        }
+      }
+    }
+  }
+
+private:
+  std::vector<npn4_entry> _entries;
+  std::vector<uint16_t> _representatives;
+};
+
+} // namespace mockturtle
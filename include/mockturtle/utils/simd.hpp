@@ -0,0 +1,255 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2022  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file simd.hpp
+  \brief Word-parallel kernels for simulation and cut computation
+
+  The simulation kernels combine arrays of 64-bit words, e.g., the blocks of
+  `kitty::partial_truth_table` or `kitty::dynamic_truth_table`.  Inputs are
+  complemented by XOR with a mask that is either all zeros or all ones.
+  When compiled with AVX-512 or AVX2 enabled (e.g., `-march=native`), the
+  kernels process 8 or 4 words per instruction, otherwise one.
+
+  The cut kernel compares a leaf with all leaves of a cut, 8 leaves per
+  instruction with AVX2 and 4 leaves with SSE2.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined( __AVX2__ ) || defined( __AVX512F__ )
+#include <immintrin.h>
+#elif defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
+namespace mockturtle
+{
+
+namespace detail
+{
+
+/*! \brief Mask to complement a word-parallel value, `~0` if `complemented`. */
+inline uint64_t complement_mask( bool complemented )
+{
+  return complemented ? ~UINT64_C( 0 ) : UINT64_C( 0 );
+}
+
+/*! \brief Computes `out[i] = ( a[i] ^ ma ) & ( b[i] ^ mb )`. */
+inline void and_words( uint64_t* out, uint64_t const* a, uint64_t const* b, uint64_t ma, uint64_t mb, std::size_t num_words )
+{
+  std::size_t i = 0u;
+#if defined( __AVX512F__ )
+  {
+    auto const vma = _mm512_set1_epi64( static_cast<long long>( ma ) );
+    auto const vmb = _mm512_set1_epi64( static_cast<long long>( mb ) );
+    for ( ; i + 8u <= num_words; i += 8u )
+    {
+      auto const va = _mm512_xor_si512( _mm512_loadu_si512( a + i ), vma );
+      auto const vb = _mm512_xor_si512( _mm512_loadu_si512( b + i ), vmb );
+      _mm512_storeu_si512( out + i, _mm512_and_si512( va, vb ) );
+    }
+  }
+#elif defined( __AVX2__ )
+  {
+    auto const vma = _mm256_set1_epi64x( static_cast<long long>( ma ) );
+    auto const vmb = _mm256_set1_epi64x( static_cast<long long>( mb ) );
+    for ( ; i + 4u <= num_words; i += 4u )
+    {
+      auto const va = _mm256_xor_si256( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( a + i ) ), vma );
+      auto const vb = _mm256_xor_si256( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( b + i ) ), vmb );
+      _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + i ), _mm256_and_si256( va, vb ) );
+    }
+  }
+#endif
+  for ( ; i < num_words; ++i )
+  {
+    out[i] = ( a[i] ^ ma ) & ( b[i] ^ mb );
+  }
+}
+
+/*! \brief Computes `out[i] = a[i] ^ b[i] ^ m`. */
+inline void xor_words( uint64_t* out, uint64_t const* a, uint64_t const* b, uint64_t m, std::size_t num_words )
+{
+  std::size_t i = 0u;
+#if defined( __AVX512F__ )
+  {
+    auto const vm = _mm512_set1_epi64( static_cast<long long>( m ) );
+    for ( ; i + 8u <= num_words; i += 8u )
+    {
+      auto const v = _mm512_xor_si512( _mm512_loadu_si512( a + i ), _mm512_loadu_si512( b + i ) );
+      _mm512_storeu_si512( out + i, _mm512_xor_si512( v, vm ) );
+    }
+  }
+#elif defined( __AVX2__ )
+  {
+    auto const vm = _mm256_set1_epi64x( static_cast<long long>( m ) );
+    for ( ; i + 4u <= num_words; i += 4u )
+    {
+      auto const v = _mm256_xor_si256( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( a + i ) ), _mm256_loadu_si256( reinterpret_cast<__m256i const*>( b + i ) ) );
+      _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + i ), _mm256_xor_si256( v, vm ) );
+    }
+  }
+#endif
+  for ( ; i < num_words; ++i )
+  {
+    out[i] = a[i] ^ b[i] ^ m;
+  }
+}
+
+/*! \brief Computes `out[i] = a[i] ^ b[i] ^ c[i] ^ m`. */
+inline void xor3_words( uint64_t* out, uint64_t const* a, uint64_t const* b, uint64_t const* c, uint64_t m, std::size_t num_words )
+{
+  std::size_t i = 0u;
+#if defined( __AVX512F__ )
+  {
+    auto const vm = _mm512_set1_epi64( static_cast<long long>( m ) );
+    for ( ; i + 8u <= num_words; i += 8u )
+    {
+      /* 0x96 is the truth table of a ^ b ^ c */
+      auto const v = _mm512_ternarylogic_epi64( _mm512_loadu_si512( a + i ), _mm512_loadu_si512( b + i ), _mm512_loadu_si512( c + i ), 0x96 );
+      _mm512_storeu_si512( out + i, _mm512_xor_si512( v, vm ) );
+    }
+  }
+#elif defined( __AVX2__ )
+  {
+    auto const vm = _mm256_set1_epi64x( static_cast<long long>( m ) );
+    for ( ; i + 4u <= num_words; i += 4u )
+    {
+      auto const v = _mm256_xor_si256( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( a + i ) ), _mm256_loadu_si256( reinterpret_cast<__m256i const*>( b + i ) ) );
+      auto const w = _mm256_xor_si256( v, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( c + i ) ) );
+      _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + i ), _mm256_xor_si256( w, vm ) );
+    }
+  }
+#endif
+  for ( ; i < num_words; ++i )
+  {
+    out[i] = a[i] ^ b[i] ^ c[i] ^ m;
+  }
+}
+
+/*! \brief Computes `out[i] = maj( a[i] ^ ma, b[i] ^ mb, c[i] ^ mc )`. */
+inline void maj_words( uint64_t* out, uint64_t const* a, uint64_t const* b, uint64_t const* c, uint64_t ma, uint64_t mb, uint64_t mc, std::size_t num_words )
+{
+  std::size_t i = 0u;
+#if defined( __AVX512F__ )
+  {
+    auto const vma = _mm512_set1_epi64( static_cast<long long>( ma ) );
+    auto const vmb = _mm512_set1_epi64( static_cast<long long>( mb ) );
+    auto const vmc = _mm512_set1_epi64( static_cast<long long>( mc ) );
+    for ( ; i + 8u <= num_words; i += 8u )
+    {
+      auto const va = _mm512_xor_si512( _mm512_loadu_si512( a + i ), vma );
+      auto const vb = _mm512_xor_si512( _mm512_loadu_si512( b + i ), vmb );
+      auto const vc = _mm512_xor_si512( _mm512_loadu_si512( c + i ), vmc );
+      /* 0xe8 is the truth table of maj( a, b, c ) */
+      _mm512_storeu_si512( out + i, _mm512_ternarylogic_epi64( va, vb, vc, 0xe8 ) );
+    }
+  }
+#elif defined( __AVX2__ )
+  {
+    auto const vma = _mm256_set1_epi64x( static_cast<long long>( ma ) );
+    auto const vmb = _mm256_set1_epi64x( static_cast<long long>( mb ) );
+    auto const vmc = _mm256_set1_epi64x( static_cast<long long>( mc ) );
+    for ( ; i + 4u <= num_words; i += 4u )
+    {
+      auto const va = _mm256_xor_si256( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( a + i ) ), vma );
+      auto const vb = _mm256_xor_si256( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( b + i ) ), vmb );
+      auto const vc = _mm256_xor_si256( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( c + i ) ), vmc );
+      auto const ab = _mm256_and_si256( va, vb );
+      auto const c_ab = _mm256_and_si256( vc, _mm256_or_si256( va, vb ) );
+      _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + i ), _mm256_or_si256( ab, c_ab ) );
+    }
+  }
+#endif
+  for ( ; i < num_words; ++i )
+  {
+    auto const va = a[i] ^ ma, vb = b[i] ^ mb, vc = c[i] ^ mc;
+    out[i] = ( va & vb ) | ( vc & ( va | vb ) );
+  }
+}
+
+/*! \brief Number of leaves compared per instruction by `contains_leaf`. */
+#if defined( __AVX2__ )
+inline constexpr uint32_t leaf_lanes = 8u;
+#elif defined( __SSE2__ )
+inline constexpr uint32_t leaf_lanes = 4u;
+#else
+inline constexpr uint32_t leaf_lanes = 1u;
+#endif
+
+/*! \brief Checks whether `leaf` is among the first `size` elements of `leaves`.
+ *
+ * The array must hold `Capacity` elements, which are read in chunks of
+ * `leaf_lanes` elements as long as the chunk is inside the array.  Elements
+ * beyond `size` are read but ignored.
+ */
+template<uint32_t Capacity>
+inline bool contains_leaf( uint32_t const* leaves, uint32_t size, uint32_t leaf )
+{
+  uint32_t i{ 0u };
+#if defined( __AVX2__ )
+  {
+    auto const v = _mm256_set1_epi32( static_cast<int32_t>( leaf ) );
+    for ( ; i < size && i + 8u <= Capacity; i += 8u )
+    {
+      auto const valid = size - i >= 8u ? 0xffu : ( 1u << ( size - i ) ) - 1u;
+      auto const equal = _mm256_cmpeq_epi32( v, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( leaves + i ) ) );
+      if ( static_cast<uint32_t>( _mm256_movemask_ps( _mm256_castsi256_ps( equal ) ) ) & valid )
+      {
+        return true;
+      }
+    }
+  }
+#elif defined( __SSE2__ )
+  {
+    auto const v = _mm_set1_epi32( static_cast<int32_t>( leaf ) );
+    for ( ; i < size && i + 4u <= Capacity; i += 4u )
+    {
+      auto const valid = size - i >= 4u ? 0xfu : ( 1u << ( size - i ) ) - 1u;
+      auto const equal = _mm_cmpeq_epi32( v, _mm_loadu_si128( reinterpret_cast<__m128i const*>( leaves + i ) ) );
+      if ( static_cast<uint32_t>( _mm_movemask_ps( _mm_castsi128_ps( equal ) ) ) & valid )
+      {
+        return true;
+      }
+    }
+  }
+#endif
+  for ( ; i < size; ++i )
+  {
+    if ( leaves[i] == leaf )
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace detail
+
+} // namespace mockturtle
@@ -34,8 +34,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
 #include <vector>
 
+#include <kitty/dynamic_truth_table.hpp>
 #include <kitty/hash.hpp>
 #include <kitty/operations.hpp>
 #include <kitty/operators.hpp>
@@ -117,6 +121,9 @@ public:
    */
   void resize( uint32_t capacity );
 
+  /*! \brief Removes all truth tables from the cache. */
+  void clear();
+
 private:
   phmap::flat_hash_map<TT, uint32_t, kitty::hash<TT>> _indexes;
   std::vector<TT> _data;
@@ -169,4 +176,224 @@ void truth_table_cache<TT>::resize( uint32_t capacity )
   _data.reserve( capacity );
 }
 
+template<typename TT>
+void truth_table_cache<TT>::clear()
+{
+  _indexes.clear();
+  _data.clear();
+}
+
+/*! \brief Truth table cache for dynamic truth tables.
+ *
+ * Same interface and literals as `truth_table_cache`, but the words of all
+ * truth tables are stored one after another in a single array, and entries
+ * are found with an open-addressing table of entry indices.  Inserting a
+ * truth table therefore does not allocate memory for each entry.
+ *
+ * Truth tables with at most 6 variables can also be inserted and read as a
+ * single 64-bit word (`insert_word` and `word`), without constructing a
+ * `kitty::dynamic_truth_table`.
+ */
+template<>
+class truth_table_cache<kitty::dynamic_truth_table>
+{
+public:
+  /*! \brief Creates a truth table cache and reserves memory. */
+  truth_table_cache( uint32_t capacity = 1000u )
+  {
+    resize( capacity );
+  }
+
+  /*! \brief Inserts a truth table and returns a literal. */
+  uint32_t insert( kitty::dynamic_truth_table const& tt )
+  {
+    if ( tt.num_vars() <= 6u )
+    {
+      return insert_word( tt._bits[0], tt.num_vars() );
+    }
+
+    auto const is_compl = static_cast<uint32_t>( tt._bits[0] & 1u );
+    return 2u * find_or_insert( tt._bits.data(), static_cast<uint32_t>( tt.num_blocks() ), tt.num_vars(), is_compl ? ~UINT64_C( 0 ) : UINT64_C( 0 ) ) + is_compl;
+  }
+
+  /*! \brief Inserts a truth table with at most 6 variables and returns a literal.
+   *
+   * \param word Truth table, bits beyond the first \f$2^n\f$ are ignored
+   * \param num_vars Number of variables \f$n\f$
+   */
+  uint32_t insert_word( uint64_t word, uint32_t num_vars )
+  {
+    assert( num_vars <= 6u );
+    auto const mask = word_mask( num_vars );
+    word &= mask;
+
+    auto const is_compl = static_cast<uint32_t>( word & 1u );
+    return 2u * find_or_insert( &word, 1u, num_vars, is_compl ? mask : UINT64_C( 0 ) ) + is_compl;
+  }
+
+  /*! \brief Returns truth table for a given literal. */
+  kitty::dynamic_truth_table operator[]( uint32_t lit ) const
+  {
+    auto const index = lit >> 1;
+    kitty::dynamic_truth_table tt( _num_vars[index] );
+    std::copy( _bits.begin() + _offset[index], _bits.begin() + _offset[index + 1u], tt._bits.begin() );
+    return ( lit & 1 ) ? ~tt : tt;
+  }
+
+  /*! \brief Returns truth table with at most 6 variables for a given literal as word. */
+  uint64_t word( uint32_t lit ) const
+  {
+    auto const index = lit >> 1;
+    assert( _num_vars[index] <= 6u );
+    return ( lit & 1 ) ? _bits[_offset[index]] ^ word_mask( _num_vars[index] ) : _bits[_offset[index]];
+  }
+
+  /*! \brief Returns the number of variables of the truth table for a given literal. */
+  uint32_t num_vars( uint32_t lit ) const
+  {
+    return _num_vars[lit >> 1];
+  }
+
+  /*! \brief Returns number of normalized truth tables in the cache. */
+  auto size() const { return _num_vars.size(); }
+
+  /*! \brief Resizes the cache.
+   *
+   * Reserve additional space for cache and data.
+   */
+  void resize( uint32_t capacity )
+  {
+    _bits.reserve( capacity );
+    _offset.reserve( capacity + 1u );
+    _num_vars.reserve( capacity );
+    if ( 2u * static_cast<uint64_t>( capacity ) > _table.size() )
+    {
+      rehash( 2u * static_cast<uint64_t>( capacity ) );
+    }
+  }
+
+  /*! \brief Removes all truth tables from the cache.
+   *
+   * Keeps the capacity of the hash table.  If the cache is sparse, only the
+   * slots of the inserted truth tables are reset.
+   */
+  void clear()
+  {
+    if ( 8u * _num_vars.size() < _table.size() )
+    {
+      for ( auto i = 0u; i < _num_vars.size(); ++i )
+      {
+        _table[find_slot( i )] = 0u;
+      }
+    }
+    else
+    {
+      std::fill( _table.begin(), _table.end(), 0u );
+    }
+    _bits.clear();
+    _offset.assign( 1u, 0u );
+    _num_vars.clear();
+  }
+
+private:
+  static uint64_t word_mask( uint32_t num_vars )
+  {
+    return num_vars >= 6u ? ~UINT64_C( 0 ) : ( UINT64_C( 1 ) << ( 1u << num_vars ) ) - 1u;
+  }
+
+  static uint64_t hash( uint64_t const* bits, uint32_t num_blocks, uint32_t num_vars, uint64_t compl_mask )
+  {
+    uint64_t h = num_vars;
+    for ( auto i = 0u; i < num_blocks; ++i )
+    {
+      h = ( h ^ ( bits[i] ^ compl_mask ) ) * UINT64_C( 0x9e3779b97f4a7c15 );
+      h ^= h >> 32;
+    }
+    return h;
+  }
+
+  /* finds or inserts the normal truth table `bits ^ compl_mask` */
+  uint32_t find_or_insert( uint64_t const* bits, uint32_t num_blocks, uint32_t num_vars, uint64_t compl_mask )
+  {
+    auto const mask = _table.size() - 1u;
+    for ( auto pos = hash( bits, num_blocks, num_vars, compl_mask ) & mask;; pos = ( pos + 1u ) & mask )
+    {
+      auto const entry = _table[pos];
+      if ( entry == 0u )
+      {
+        break;
+      }
+
+      auto const index = entry - 1u;
+      if ( _num_vars[index] == num_vars &&
+           std::equal( _bits.begin() + _offset[index], _bits.begin() + _offset[index + 1u], bits, [compl_mask]( auto a, auto b ) { return a == ( b ^ compl_mask ); } ) )
+      {
+        return index;
+      }
+    }
+
+    /* add truth table to end of cache */
+    auto const index = static_cast<uint32_t>( _num_vars.size() );
+    for ( auto i = 0u; i < num_blocks; ++i )
+    {
+      _bits.push_back( bits[i] ^ compl_mask );
+    }
+    _offset.push_back( static_cast<uint32_t>( _bits.size() ) );
+    _num_vars.push_back( static_cast<uint8_t>( num_vars ) );
+
+    if ( 2u * _num_vars.size() > _table.size() )
+    {
+      rehash( 2u * _table.size() );
+    }
+    else
+    {
+      place( index );
+    }
+    return index;
+  }
+
+  void place( uint32_t index )
+  {
+    auto const mask = _table.size() - 1u;
+    auto pos = hash( _bits.data() + _offset[index], _offset[index + 1u] - _offset[index], _num_vars[index], 0u ) & mask;
+    while ( _table[pos] != 0u )
+    {
+      pos = ( pos + 1u ) & mask;
+    }
+    _table[pos] = index + 1u;
+  }
+
+  /* returns the slot of entry `index`; slots of other entries may have been reset */
+  uint64_t find_slot( uint32_t index ) const
+  {
+    auto const mask = _table.size() - 1u;
+    auto pos = hash( _bits.data() + _offset[index], _offset[index + 1u] - _offset[index], _num_vars[index], 0u ) & mask;
+    while ( _table[pos] != index + 1u )
+    {
+      pos = ( pos + 1u ) & mask;
+    }
+    return pos;
+  }
+
+  void rehash( uint64_t capacity )
+  {
+    uint64_t size = 16u;
+    while ( size < capacity )
+    {
+      size <<= 1;
+    }
+    _table.assign( size, 0u );
+    for ( auto i = 0u; i < _num_vars.size(); ++i )
+    {
+      place( i );
+    }
+  }
+
+private:
+  std::vector<uint64_t> _bits;         /* words of all truth tables */
+  std::vector<uint32_t> _offset{ 0u }; /* entry i has words [_offset[i], _offset[i + 1]) */
+  std::vector<uint8_t> _num_vars;      /* number of variables of each entry */
+  std::vector<uint32_t> _table;        /* open addressing, entry index + 1 (0 is empty) */
+};
+
 } /* namespace mockturtle */
@@ -32,6 +32,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+
 #include <kitty/kitty.hpp>
 
 namespace mockturtle
@@ -60,4 +65,104 @@ bool can_replace_majority_fanin( TT const& fanin0, TT const& fanin1, TT const& f
   return kitty::is_const0( ( ( fanin0 ^ replacement ) & ( fanin1 ^ fanin2 ) ) );
 }
 
+/*! \brief Mask of the bits of a truth table word with `num_vars` variables. */
+inline uint64_t truth_table_word_mask( uint32_t num_vars )
+{
+  return num_vars >= 6u ? ~UINT64_C( 0 ) : ( UINT64_C( 1 ) << ( 1u << num_vars ) ) - 1u;
+}
+
+/*! \brief Extends a truth table word with `num_vars` variables to 6 variables. */
+inline uint64_t extend_truth_table_word( uint64_t tt, uint32_t num_vars )
+{
+  tt &= truth_table_word_mask( num_vars );
+  for ( auto v = num_vars; v < 6u; ++v )
+  {
+    tt |= tt << ( 1u << v );
+  }
+  return tt;
+}
+
+/*! \brief Swaps two variables in a truth table word. */
+inline uint64_t swap_truth_table_word( uint64_t tt, uint32_t var_index1, uint32_t var_index2 )
+{
+  if ( var_index1 == var_index2 )
+  {
+    return tt;
+  }
+  if ( var_index1 > var_index2 )
+  {
+    std::swap( var_index1, var_index2 );
+  }
+
+  auto const& pmask = kitty::detail::ppermutation_masks[var_index1][var_index2];
+  auto const shift = ( 1u << var_index2 ) - ( 1u << var_index1 );
+  return ( tt & pmask[0] ) | ( ( tt & pmask[1] ) << shift ) | ( ( tt & pmask[2] ) >> shift );
+}
+
+/*! \brief Checks whether a truth table word depends on a variable. */
+inline bool truth_table_word_has_var( uint64_t tt, uint32_t var_index )
+{
+  return ( ( tt >> ( 1u << var_index ) ) & kitty::detail::projections_neg[var_index] ) != ( tt & kitty::detail::projections_neg[var_index] );
+}
+
+/*! \brief Expands the function of a cut to the leaves of a super cut.
+ *
+ * The truth table word `tt` is a function over the sorted leaves in
+ * `[sub_begin, sub_end)`, which are a subset of the sorted leaves in
+ * `[sup_begin, sup_end)` (at most 6).  Returns the same function over the
+ * leaves of the super cut, extended to 6 variables.  This is the word
+ * version of `kitty::extend_to` followed by `kitty::expand_inplace`.
+ *
+ * \param tt Truth table word
+ * \param num_vars Number of variables of `tt`
+ */
+template<class SubIterator, class SupIterator>
+uint64_t expand_truth_table_word( uint64_t tt, uint32_t num_vars, SubIterator sub_begin, SubIterator sub_end, SupIterator sup_begin, SupIterator sup_end )
+{
+  tt = extend_truth_table_word( tt, num_vars );
+
+  std::array<uint8_t, 6u> support;
+  uint32_t j = 0u;
+  auto itp = sup_begin;
+  for ( auto it = sub_begin; it != sub_end; ++it )
+  {
+    itp = std::find( itp, sup_end, *it );
+    support[j++] = static_cast<uint8_t>( std::distance( sup_begin, itp ) );
+  }
+
+  for ( int32_t i = j - 1; i >= 0; --i )
+  {
+    tt = swap_truth_table_word( tt, i, support[i] );
+  }
+  return tt;
+}
+
+/*! \brief Moves the support of a truth table word to the lowest variables.
+ *
+ * The word version of `kitty::min_base_inplace`: `support[i]` receives the
+ * original index of the i-th support variable.
+ *
+ * \param tt Truth table word
+ * \param num_vars Number of variables of `tt`
+ * \param support Original indexes of the support variables
+ * \return Number of support variables
+ */
+inline uint32_t min_base_truth_table_word( uint64_t& tt, uint32_t num_vars, std::array<uint8_t, 6u>& support )
+{
+  uint32_t k = 0u;
+  for ( auto i = 0u; i < num_vars; ++i )
+  {
+    if ( !truth_table_word_has_var( tt, i ) )
+    {
+      continue;
+    }
+    if ( k < i )
+    {
+      tt = swap_truth_table_word( tt, k, i );
+    }
+    support[k++] = static_cast<uint8_t>( i );
+  }
+  return k;
+}
+
 } // namespace mockturtle
\ No newline at end of file
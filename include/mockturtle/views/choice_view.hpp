@@ -474,7 +474,7 @@ public:
     if ( n == 0 || Ntk::is_ci( n ) )
       return;
 
-    auto& nobj = Ntk::_storage->nodes[n];
+    auto&& nobj = Ntk::_storage->nodes[n];
     set_choice_flag( n );
     Ntk::_storage->hash.erase( nobj );
 
@@ -498,7 +498,7 @@ public:
     if ( n == 0 || Ntk::is_ci( n ) )
       return;
 
-    auto& nobj = Ntk::_storage->nodes[n];
+    auto&& nobj = Ntk::_storage->nodes[n];
     reset_choice_flag( n );
     Ntk::_storage->hash[nobj] = n;
 
@@ -40,7 +40,9 @@ namespace mockturtle
  *
  * Traversal IDs, called colors, are unsigned integers that can be
  * assigned to nodes.  The corresponding values are stored in-place in
- * the flags of the underlying of the network.
+ * the flags of the underlying of the network, through its `trav_id`,
+ * `incr_trav_id`, `visited`, and `set_visited` methods.  Wrap the network
+ * in a `traversal_view` to keep the colors out of the network instead.
  */
 template<typename Ntk>
 class color_view : public Ntk
@@ -60,53 +62,54 @@ public:
   /*! \brief Returns a new color and increases the current color */
   uint32_t new_color() const
   {
-    return ++this->_storage->trav_id;
-    // return ++value;
+    this->incr_trav_id();
+    return this->trav_id();
   }
 
   /*! \brief Returns the current color */
   uint32_t current_color() const
   {
-    return this->_storage->trav_id;
-    // return value;
+    return this->trav_id();
   }
 
   /*! \brief Assigns all nodes to `color` */
   void clear_colors( uint32_t color = 0 ) const
   {
-    std::for_each( this->_storage->nodes.begin(), this->_storage->nodes.end(),
-                   [color]( auto& n ) { n.data[1].h1 = color; } );
+    for ( auto i = 0u; i < this->size(); ++i )
+    {
+      this->set_visited( this->index_to_node( i ), color );
+    }
   }
 
   /*! \brief Returns the color of a node */
   auto color( node const& n ) const
   {
-    return this->_storage->nodes[n].data[1].h1;
+    return this->visited( n );
   }
 
   /*! \brief Returns the color of a node */
   template<typename _Ntk = Ntk, typename = std::enable_if_t<!std::is_same_v<typename _Ntk::signal, typename _Ntk::node>>>
   auto color( signal const& n ) const
   {
-    return this->_storage->nodes[this->get_node( n )].data[1].h1;
+    return this->visited( this->get_node( n ) );
   }
 
   /*! \brief Assigns the current color to a node */
   void paint( node const& n ) const
   {
-    this->_storage->nodes[n].data[1].h1 = current_color();
+    this->set_visited( n, current_color() );
   }
 
   /*! \brief Assigns `color` to a node */
   void paint( node const& n, uint32_t color ) const
   {
-    this->_storage->nodes[n].data[1].h1 = color;
+    this->set_visited( n, color );
   }
 
   /*! \brief Copies the color from `other` to `n` */
   void paint( node const& n, node const& other ) const
   {
-    this->_storage->nodes[n].data[1].h1 = color( other );
+    this->set_visited( n, color( other ) );
   }
 
   /*! \brief Evaluates a predicate on the color of a node */
@@ -139,8 +142,6 @@ public:
     return result;
   }
 
-protected:
-  // mutable uint32_t value{0};
 }; /* color_view */
 
 /*!\brief Manager view for traversal IDs (out-of-place storage).
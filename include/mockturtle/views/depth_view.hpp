@@ -41,7 +41,9 @@
 #include "../utils/node_map.hpp"
 #include "immutable_view.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 namespace mockturtle
@@ -54,6 +56,16 @@ struct depth_view_params
 
   /*! \brief Whether PIs have costs. */
   bool pi_cost{ false };
+
+  /*! \brief Keep levels, depth, and critical paths up to date on network events.
+   *
+   * When a node is modified, only the levels in its transitive fanout are
+   * recomputed, and propagation stops at nodes whose level does not change.
+   * Depth and critical paths are refreshed lazily on the next query.  Only
+   * levels (arrival times) are propagated; required times and slacks are not
+   * kept.
+   */
+  bool incremental{ false };
 };
 
 /*! \brief Implements `depth` and `level` methods for networks.
@@ -64,10 +76,22 @@ struct depth_view_params
  * and can be recomputed by calling the `update_levels` method.
  *
  * It also automatically updates levels, and depth when creating nodes or
- * creating a PO on a depth_view, however, it does not update the information,
- * when modifying or deleting nodes, neither will the critical paths be
- * recalculated (due to efficiency reasons).  In order to recalculate levels,
- * depth, and critical paths, one can call `update_levels` instead.
+ * creating a PO on a depth_view, however, by default it does not update the
+ * information, when modifying or deleting nodes, neither will the critical
+ * paths be recalculated (due to efficiency reasons).  In order to recalculate
+ * levels, depth, and critical paths, one can call `update_levels` instead.
+ *
+ * With `depth_view_params::incremental`, the view listens to modify and
+ * delete events as well and propagates level changes through the affected
+ * fanout cones only.  Fanouts are taken from the network if it implements
+ * `foreach_fanout` (e.g., `depth_view<fanout_view<Ntk>>`), otherwise the
+ * view keeps its own fanout lists.  In this mode, `update_levels` only
+ * recomputes depth and critical paths, unless levels were overwritten with
+ * `set_level`.  Changes that bypass network events (e.g., calling
+ * `replace_in_outputs` directly) are not tracked until `update_levels` is
+ * called.  The incremental mode maintains levels only: the view has no
+ * required times or slacks, and critical paths are marked again from the
+ * outputs of maximum level on the next query after a change.
  *
  * **Required network functions:**
  * - `size`
@@ -128,7 +152,7 @@ public:
     static_assert( has_foreach_po_v<Ntk>, "Ntk does not implement the foreach_po method" );
     static_assert( has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin method" );
 
-    add_event = Ntk::events().register_add_event( [this]( auto const& n ) { on_add( n ); } );
+    register_events();
   }
 
   /*! \brief Standard constructor.
@@ -147,22 +171,26 @@ public:
     static_assert( has_foreach_po_v<Ntk>, "Ntk does not implement the foreach_po method" );
     static_assert( has_foreach_fanin_v<Ntk>, "Ntk does not implement the foreach_fanin method" );
 
-    update_levels();
+    if ( _ps.incremental )
+    {
+      build_fanouts();
+    }
+    compute_all_levels();
 
-    add_event = Ntk::events().register_add_event( [this]( auto const& n ) { on_add( n ); } );
+    register_events();
   }
 
   /*! \brief Copy constructor. */
   explicit depth_view( depth_view<Ntk, NodeCostFn, false> const& other )
-      : Ntk( other ), _ps( other._ps ), _levels( other._levels ), _crit_path( other._crit_path ), _depth( other._depth ), _cost_fn( other._cost_fn )
+      : Ntk( other ), _ps( other._ps ), _levels( other._levels ), _crit_path( other._crit_path ), _crit_nodes( other._crit_nodes ), _depth( other._depth ), _crit_dirty( other._crit_dirty ), _levels_dirty( other._levels_dirty ), _fanouts( other._fanouts ), _cost_fn( other._cost_fn )
   {
-    add_event = Ntk::events().register_add_event( [this]( auto const& n ) { on_add( n ); } );
+    register_events();
   }
 
   depth_view<Ntk, NodeCostFn, false>& operator=( depth_view<Ntk, NodeCostFn, false> const& other )
   {
     /* delete the event of this network */
-    Ntk::events().release_add_event( add_event );
+    release_events();
 
     /* update the base class */
     this->_storage = other._storage;
@@ -172,22 +200,33 @@ public:
     _ps = other._ps;
     _levels = other._levels;
     _crit_path = other._crit_path;
+    _crit_nodes = other._crit_nodes;
     _depth = other._depth;
+    _crit_dirty = other._crit_dirty;
+    _levels_dirty = other._levels_dirty;
+    _fanouts = other._fanouts;
     _cost_fn = other._cost_fn;
 
     /* register new event in the other network */
-    add_event = Ntk::events().register_add_event( [this]( auto const& n ) { on_add( n ); } );
+    register_events();
 
     return *this;
   }
 
   ~depth_view()
   {
-    Ntk::events().release_add_event( add_event );
+    release_events();
   }
 
+  /*! \brief Returns the depth of the network.
+   *
+   * In incremental mode, depth and critical paths are refreshed on demand,
+   * so this method modifies internal (mutable) state and must not be called
+   * concurrently with other methods of the view.
+   */
   uint32_t depth() const
   {
+    update_critical_paths();
     return _depth;
   }
 
@@ -196,14 +235,21 @@ public:
     return _levels[n];
   }
 
+  /*! \brief Returns whether `n` is on a critical path.
+   *
+   * Like `depth`, this method may refresh the critical paths and is not
+   * thread-safe.
+   */
   bool is_on_critical_path( node const& n ) const
   {
+    update_critical_paths();
     return _crit_path[n];
   }
 
   void set_level( node const& n, uint32_t level )
   {
     _levels[n] = level;
+    _levels_dirty = _ps.incremental;
   }
 
   void set_depth( uint32_t level )
@@ -213,11 +259,15 @@ public:
 
   void update_levels()
   {
-    _levels.reset( 0 );
-    _crit_path.reset( false );
+    if ( _ps.incremental && !_levels_dirty )
+    {
+      /* levels are exact, only depth and critical paths may be outdated */
+      _crit_dirty = true;
+      update_critical_paths();
+      return;
+    }
 
-    this->incr_trav_id();
-    compute_levels();
+    compute_all_levels();
   }
 
   void resize_levels()
@@ -229,30 +279,37 @@ public:
   {
     Ntk::create_po( f );
     _depth = std::max( _depth, _levels[f] );
+    _crit_dirty = _ps.incremental;
   }
 
 private:
-  uint32_t compute_levels( node const& n )
+  void compute_all_levels()
   {
-    if ( this->visited( n ) == this->trav_id() )
-    {
-      return _levels[n];
-    }
-    this->set_visited( n, this->trav_id() );
+    _levels.reset( 0 );
+    _crit_path.reset( false );
+    _crit_nodes.clear();
+    _levels_dirty = false;
+    _crit_dirty = false;
 
+    this->incr_trav_id();
+    compute_levels();
+  }
+
+  uint32_t compute_level_from_fanins( node const& n ) const
+  {
     if ( this->is_constant( n ) )
     {
-      return _levels[n] = 0;
+      return 0;
     }
     if ( this->is_ci( n ) )
     {
       assert( !_ps.pi_cost || _cost_fn( *this, n ) >= 1 );
-      return _levels[n] = _ps.pi_cost ? _cost_fn( *this, n ) - 1 : 0;
+      return _ps.pi_cost ? _cost_fn( *this, n ) - 1 : 0;
     }
 
     uint32_t level{ 0 };
     this->foreach_fanin( n, [&]( auto const& f ) {
-      auto clevel = compute_levels( this->get_node( f ) );
+      auto clevel = _levels[f];
       if ( _ps.count_complements && this->is_complemented( f ) )
       {
         clevel++;
@@ -260,14 +317,78 @@ private:
       level = std::max( level, clevel );
     } );
 
-    return _levels[n] = level + _cost_fn( *this, n );
+    return level + _cost_fn( *this, n );
+  }
+
+  /* post-order traversal with an explicit stack to support deep networks */
+  uint32_t compute_levels( node const& root )
+  {
+    if ( this->visited( root ) == this->trav_id() )
+    {
+      return _levels[root];
+    }
+
+    std::vector<std::pair<node, bool>> stack;
+    stack.emplace_back( root, false );
+    while ( !stack.empty() )
+    {
+      auto const [n, expanded] = stack.back();
+      stack.pop_back();
+
+      if ( this->visited( n ) == this->trav_id() )
+      {
+        continue;
+      }
+
+      if ( !expanded && !this->is_constant( n ) && !this->is_ci( n ) )
+      {
+        stack.emplace_back( n, true );
+        this->foreach_fanin( n, [&]( auto const& f ) {
+          if ( this->visited( this->get_node( f ) ) != this->trav_id() )
+          {
+            stack.emplace_back( this->get_node( f ), false );
+          }
+        } );
+        continue;
+      }
+
+      this->set_visited( n, this->trav_id() );
+      _levels[n] = compute_level_from_fanins( n );
+    }
+
+    return _levels[root];
   }
 
   void compute_levels()
+  {
+    this->foreach_po( [&]( auto const& f ) {
+      compute_levels( this->get_node( f ) );
+    } );
+
+    /* dangling nodes may be connected later by incremental updates */
+    if ( _ps.incremental )
+    {
+      this->foreach_gate( [&]( auto const& n ) {
+        compute_levels( n );
+      } );
+    }
+
+    if constexpr ( has_foreach_ri_v<Ntk> )
+    {
+      this->foreach_ri( [&]( auto const& f ) {
+        compute_levels( this->get_node( f ) );
+      } );
+    }
+
+    compute_depth();
+    mark_critical_paths();
+  }
+
+  void compute_depth() const
   {
     _depth = 0;
     this->foreach_po( [&]( auto const& f ) {
-      auto clevel = compute_levels( this->get_node( f ) );
+      auto clevel = _levels[f];
       if ( _ps.count_complements && this->is_complemented( f ) )
       {
         clevel++;
@@ -278,7 +399,7 @@ private:
     if constexpr ( has_foreach_ri_v<Ntk> )
     {
       this->foreach_ri( [&]( auto const& f ) {
-        auto clevel = compute_levels( this->get_node( f ) );
+        auto clevel = _levels[f];
         if ( _ps.count_complements && this->is_complemented( f ) )
         {
           clevel++;
@@ -286,10 +407,13 @@ private:
         _depth = std::max( _depth, clevel );
       } );
     }
+  }
 
+  void mark_critical_paths() const
+  {
     this->foreach_po( [&]( auto const& f ) {
       const auto n = this->get_node( f );
-      if ( _levels[n] == _depth )
+      if ( _levels[n] == _depth && !_crit_path[n] )
       {
         set_critical_path( n );
       }
@@ -299,7 +423,7 @@ private:
     {
       this->foreach_ri( [&]( auto const& f ) {
         const auto n = this->get_node( f );
-        if ( _levels[n] == _depth )
+        if ( _levels[n] == _depth && !_crit_path[n] )
         {
           set_critical_path( n );
         }
@@ -307,11 +431,22 @@ private:
     }
   }
 
-  void set_critical_path( node const& n )
+  void set_critical_path( node const& root ) const
   {
-    _crit_path[n] = true;
-    if ( !this->is_constant( n ) && !( _ps.pi_cost && this->is_pi( n ) ) )
+    std::vector<node> stack{ root };
+    _crit_path[root] = true;
+    _crit_nodes.push_back( root );
+
+    while ( !stack.empty() )
     {
+      auto const n = stack.back();
+      stack.pop_back();
+
+      if ( this->is_constant( n ) || ( _ps.pi_cost && this->is_pi( n ) ) )
+      {
+        continue;
+      }
+
       const auto lvl = _levels[n];
       this->foreach_fanin( n, [&]( auto const& f ) {
         const auto cn = this->get_node( f );
@@ -322,12 +457,150 @@ private:
         }
         if ( _levels[cn] + offset == lvl && !_crit_path[cn] )
         {
-          set_critical_path( cn );
+          _crit_path[cn] = true;
+          _crit_nodes.push_back( cn );
+          stack.push_back( cn );
         }
       } );
     }
   }
 
+  /* recomputes depth and critical paths after incremental level updates,
+   * only the previously critical nodes are reset */
+  void update_critical_paths() const
+  {
+    if ( !_crit_dirty )
+    {
+      return;
+    }
+    _crit_dirty = false;
+
+    _crit_path.resize( false );
+    for ( auto const& n : _crit_nodes )
+    {
+      _crit_path[n] = false;
+    }
+    _crit_nodes.clear();
+
+    compute_depth();
+    mark_critical_paths();
+  }
+
+  template<typename Fn>
+  void foreach_level_fanout( node const& n, Fn&& fn ) const
+  {
+    if constexpr ( has_foreach_fanout_v<Ntk> )
+    {
+      this->foreach_fanout( n, fn );
+    }
+    else
+    {
+      for ( auto const& fo : _fanouts[this->node_to_index( n )] )
+      {
+        fn( fo );
+      }
+    }
+  }
+
+  /* recomputes the level of `n` and propagates changes to its transitive
+   * fanout; nodes are processed in order of the level of the fanin that
+   * triggered them, so that most nodes are evaluated only once */
+  void propagate_levels( node const& n )
+  {
+    using entry = std::pair<uint32_t, node>;
+    auto const cmp = []( entry const& a, entry const& b ) { return a.first > b.first; };
+
+    std::vector<entry> heap{ { _levels[n], n } };
+    while ( !heap.empty() )
+    {
+      std::pop_heap( heap.begin(), heap.end(), cmp );
+      auto const m = heap.back().second;
+      heap.pop_back();
+
+      if constexpr ( has_is_dead_v<Ntk> )
+      {
+        if ( this->is_dead( m ) )
+        {
+          continue;
+        }
+      }
+
+      auto const level = compute_level_from_fanins( m );
+      if ( level == _levels[m] )
+      {
+        continue;
+      }
+      _levels[m] = level;
+      _crit_dirty = true;
+
+      foreach_level_fanout( m, [&]( auto const& fo ) {
+        heap.emplace_back( level, fo );
+        std::push_heap( heap.begin(), heap.end(), cmp );
+      } );
+    }
+  }
+
+  void build_fanouts()
+  {
+    if constexpr ( !has_foreach_fanout_v<Ntk> )
+    {
+      _fanouts.clear();
+      _fanouts.resize( this->size() );
+      this->foreach_gate( [&]( auto const& n ) {
+        add_fanouts( n );
+      } );
+    }
+  }
+
+  void add_fanouts( node const& n )
+  {
+    if constexpr ( !has_foreach_fanout_v<Ntk> )
+    {
+      if ( _fanouts.size() < this->size() )
+      {
+        _fanouts.resize( this->size() );
+      }
+      this->foreach_fanin( n, [&]( auto const& f ) {
+        _fanouts[this->node_to_index( this->get_node( f ) )].push_back( n );
+      } );
+    }
+  }
+
+  void remove_fanout( node const& fanin, node const& n )
+  {
+    auto& fanouts = _fanouts[this->node_to_index( fanin )];
+    if ( auto it = std::find( fanouts.begin(), fanouts.end(), n ); it != fanouts.end() )
+    {
+      *it = fanouts.back();
+      fanouts.pop_back();
+    }
+  }
+
+  void register_events()
+  {
+    add_event = Ntk::events().register_add_event( [this]( auto const& n ) { on_add( n ); } );
+
+    if ( _ps.incremental )
+    {
+      modified_event = Ntk::events().register_modified_event( [this]( auto const& n, auto const& previous_children ) { on_modified( n, previous_children ); } );
+      delete_event = Ntk::events().register_delete_event( [this]( auto const& n ) { on_delete( n ); } );
+    }
+  }
+
+  void release_events()
+  {
+    Ntk::events().release_add_event( add_event );
+
+    if ( modified_event )
+    {
+      Ntk::events().release_modified_event( modified_event );
+    }
+    if ( delete_event )
+    {
+      Ntk::events().release_delete_event( delete_event );
+    }
+  }
+
   void on_add( node const& n )
   {
     _levels.resize();
@@ -343,15 +616,64 @@ private:
     } );
 
     _levels[n] = level + _cost_fn( *this, n );
+
+    if ( _ps.incremental )
+    {
+      _crit_path.resize( false );
+      add_fanouts( n );
+    }
+  }
+
+  void on_modified( node const& n, std::vector<signal> const& previous_children )
+  {
+    if constexpr ( !has_foreach_fanout_v<Ntk> )
+    {
+      for ( auto const& f : previous_children )
+      {
+        remove_fanout( this->get_node( f ), n );
+      }
+      add_fanouts( n );
+    }
+    else
+    {
+      (void)previous_children;
+    }
+
+    /* new fanins may make a critical node's fanin edges tight */
+    if ( _crit_path[n] )
+    {
+      _crit_dirty = true;
+    }
+    propagate_levels( n );
+  }
+
+  void on_delete( node const& n )
+  {
+    if constexpr ( !has_foreach_fanout_v<Ntk> )
+    {
+      this->foreach_fanin( n, [&]( auto const& f ) {
+        remove_fanout( this->get_node( f ), n );
+      } );
+      _fanouts[this->node_to_index( n )].clear();
+    }
+
+    /* the outputs of `n` may have been redirected without an event */
+    _crit_dirty = true;
   }
 
   depth_view_params _ps;
   node_map<uint32_t, Ntk> _levels;
-  node_map<uint32_t, Ntk> _crit_path;
-  uint32_t _depth{};
+  mutable node_map<uint32_t, Ntk> _crit_path;
+  mutable std::vector<node> _crit_nodes;
+  mutable uint32_t _depth{};
+  mutable bool _crit_dirty{ false };
+  bool _levels_dirty{ false };
+  std::vector<std::vector<node>> _fanouts;
   NodeCostFn _cost_fn;
 
   std::shared_ptr<typename network_events<Ntk>::add_event_type> add_event;
+  std::shared_ptr<typename network_events<Ntk>::modified_event_type> modified_event;
+  std::shared_ptr<typename network_events<Ntk>::delete_event_type> delete_event;
 };
 
 template<class T>
@@ -265,21 +265,19 @@ protected:
     if ( index >= .9 * Ntk::_storage->nodes.capacity() )
     {
       Ntk::_storage->nodes.reserve( static_cast<uint64_t>( 3.1415f * index ) );
-      Ntk::_storage->hash.reserve( static_cast<uint64_t>( 3.1415f * index ) );
     }
 
     Ntk::_storage->nodes.push_back( node );
     Ntk::_storage->hash[node] = index;
+    Ntk::_storage->fanouts.add_node();
+    Ntk::_storage->fanouts.add_fanins( index, node.children );
 
     /* increase ref-count to children */
     Ntk::_storage->nodes[a.index].data[0].h1++;
     Ntk::_storage->nodes[b.index].data[0].h1++;
     Ntk::_storage->nodes[c.index].data[0].h1++;
 
-    for ( auto const& fn : Ntk::_events->on_add )
-    {
-      ( *fn )( index );
-    }
+    Ntk::_events->notify_add( index );
 
     return { index, node_complement };
   }
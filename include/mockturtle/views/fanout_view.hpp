@@ -38,9 +38,9 @@
 #include "../networks/detail/foreach.hpp"
 #include "../networks/events.hpp"
 #include "../traits.hpp"
-#include "../utils/node_map.hpp"
 #include "immutable_view.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <stack>
 #include <vector>
@@ -62,6 +62,13 @@ struct fanout_view_params
  * fanout are computed at construction and can be recomputed by
  * calling the `update_fanout` method.
  *
+ * The fanout lists are stored in one flat array, in which each node owns
+ * a contiguous segment.  At construction, segments are sized by
+ * `fanout_size` (if available), such that the fanouts are collected in a
+ * single pass over the gates.  When a segment is full, it is moved to the
+ * end of the array with twice its capacity; the array is compacted when
+ * more than half of it is unused.
+ *
  * **Required network functions:**
  * - `foreach_node`
  * - `foreach_fanin`
@@ -91,7 +98,7 @@ public:
   using signal = typename Ntk::signal;
 
   explicit fanout_view( fanout_view_params const& ps = {} )
-      : Ntk(), _fanout( *this ), _ps( ps )
+      : Ntk(), _ps( ps )
   {
     static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
     static_assert( has_foreach_node_v<Ntk>, "Ntk does not implement the foreach_node method" );
@@ -103,7 +110,7 @@ public:
   }
 
   explicit fanout_view( Ntk const& ntk, fanout_view_params const& ps = {} )
-      : Ntk( ntk ), _fanout( ntk ), _ps( ps )
+      : Ntk( ntk ), _ps( ps )
   {
     static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
     static_assert( has_foreach_node_v<Ntk>, "Ntk does not implement the foreach_node method" );
@@ -116,7 +123,7 @@ public:
 
   /*! \brief Copy constructor. */
   fanout_view( fanout_view<Ntk, false> const& other )
-      : Ntk( other ), _fanout( other._fanout ), _ps( other._ps )
+      : Ntk( other ), _segments( other._segments ), _fanouts( other._fanouts ), _garbage( other._garbage ), _ps( other._ps )
   {
     register_events();
   }
@@ -131,7 +138,9 @@ public:
 
     /* copy */
     _ps = other._ps;
-    _fanout = other._fanout;
+    _segments = other._segments;
+    _fanouts = other._fanouts;
+    _garbage = other._garbage;
 
     register_events();
 
@@ -147,7 +156,46 @@ public:
   void foreach_fanout( node const& n, Fn&& fn ) const
   {
     assert( n < this->size() );
-    detail::foreach_element( _fanout[n].begin(), _fanout[n].end(), fn );
+    /* entries are accessed by position, as `fn` may grow the array; moved
+       segments keep their old entries until the array is compacted */
+    auto const seg = _segments[this->node_to_index( n )];
+
+    ++_active_iterations;
+    if constexpr ( detail::is_callable_without_index_v<Fn, node, bool> )
+    {
+      for ( auto i = 0u; i < seg.size; ++i )
+      {
+        if ( !fn( _fanouts[seg.begin + i] ) )
+        {
+          break;
+        }
+      }
+    }
+    else if constexpr ( detail::is_callable_with_index_v<Fn, node, bool> )
+    {
+      for ( auto i = 0u; i < seg.size; ++i )
+      {
+        if ( !fn( _fanouts[seg.begin + i], i ) )
+        {
+          break;
+        }
+      }
+    }
+    else if constexpr ( detail::is_callable_without_index_v<Fn, node, void> )
+    {
+      for ( auto i = 0u; i < seg.size; ++i )
+      {
+        fn( _fanouts[seg.begin + i] );
+      }
+    }
+    else if constexpr ( detail::is_callable_with_index_v<Fn, node, void> )
+    {
+      for ( auto i = 0u; i < seg.size; ++i )
+      {
+        fn( _fanouts[seg.begin + i], i );
+      }
+    }
+    --_active_iterations;
   }
 
   void update_fanout()
@@ -157,7 +205,8 @@ public:
 
   std::vector<node> fanout( node const& n ) const /* deprecated */
   {
-    return _fanout[n];
+    auto const& seg = _segments[this->node_to_index( n )];
+    return std::vector<node>( _fanouts.begin() + seg.begin, _fanouts.begin() + seg.begin + seg.size );
   }
 
   void substitute_node( node const& old_node, signal const& new_signal )
@@ -165,6 +214,14 @@ public:
     if ( Ntk::get_node( new_signal ) == old_node && !Ntk::is_complemented( new_signal ) )
       return;
 
+    /* inside a batch of events the fanout lists are only updated at commit,
+     * the network then finds the fanouts on its own */
+    if ( Ntk::events().in_batch() )
+    {
+      Ntk::substitute_node( old_node, new_signal );
+      return;
+    }
+
     if ( Ntk::is_dead( Ntk::get_node( new_signal ) ) )
     {
       Ntk::revive_node( Ntk::get_node( new_signal ) );
@@ -199,7 +256,7 @@ public:
       if ( Ntk::get_node( _new ) == _old && !Ntk::is_complemented( _new ) )
         continue;
 
-      const auto parents = _fanout[_old];
+      const auto parents = fanout( _old );
       for ( auto n : parents )
       {
         if ( const auto repl = Ntk::replace_in_node( n, _old, _new ); repl )
@@ -230,7 +287,7 @@ public:
       Ntk::revive_node( Ntk::get_node( new_signal ) );
     }
 
-    const auto parents = _fanout[old_node];
+    const auto parents = fanout( old_node );
     for ( auto n : parents )
     {
       Ntk::replace_in_node_no_restrash( n, old_node, new_signal );
@@ -252,9 +309,9 @@ private:
     if ( _ps.update_on_add )
     {
       add_event = Ntk::events().register_add_event( [this]( auto const& n ) {
-        _fanout.resize();
+        resize_segments();
         Ntk::foreach_fanin( n, [&, this]( auto const& f ) {
-          _fanout[f].push_back( n );
+          append_fanout( this->get_node( f ), n );
         } );
       } );
     }
@@ -262,13 +319,12 @@ private:
     if ( _ps.update_on_modified )
     {
       modified_event = Ntk::events().register_modified_event( [this]( auto const& n, auto const& previous ) {
-        (void)previous;
         for ( auto const& f : previous )
         {
-          _fanout[f].erase( std::remove( _fanout[f].begin(), _fanout[f].end(), n ), _fanout[f].end() );
+          remove_fanout( this->get_node( f ), n );
         }
         Ntk::foreach_fanin( n, [&, this]( auto const& f ) {
-          _fanout[f].push_back( n );
+          append_fanout( this->get_node( f ), n );
         } );
       } );
     }
@@ -276,9 +332,9 @@ private:
     if ( _ps.update_on_delete )
     {
       delete_event = Ntk::events().register_delete_event( [this]( auto const& n ) {
-        _fanout[n].clear();
+        clear_fanout( n );
         Ntk::foreach_fanin( n, [&, this]( auto const& f ) {
-          _fanout[f].erase( std::remove( _fanout[f].begin(), _fanout[f].end(), n ), _fanout[f].end() );
+          remove_fanout( this->get_node( f ), n );
         } );
       } );
     }
@@ -304,7 +360,33 @@ private:
 
   void compute_fanout()
   {
-    _fanout.reset();
+    _segments.assign( this->size(), segment{} );
+    _garbage = 0u;
+
+    /* size the segments by the fanout counts, such that the fanouts are
+       collected in a single pass without moving segments */
+    uint64_t offset{ 0 };
+    if constexpr ( has_fanout_size_v<Ntk> )
+    {
+      this->foreach_node( [&]( auto const& n ) {
+        auto& seg = _segments[this->node_to_index( n )];
+        seg.begin = offset;
+        seg.capacity = this->fanout_size( n );
+        offset += seg.capacity;
+      } );
+    }
+    _fanouts.clear();
+    _fanouts.resize( offset );
+
+    /* a gate is appended to all of its fanins before the next gate, hence
+       comparing with the last entry removes duplicates */
+    auto const add_unique = [&]( auto const& c, auto const& n ) {
+      auto const& seg = _segments[this->node_to_index( c )];
+      if ( seg.size == 0u || _fanouts[seg.begin + seg.size - 1u] != n )
+      {
+        append_fanout( c, n );
+      }
+    };
 
     /* Compute fanout also for buffers in buffered networks */
     if constexpr ( is_buffered_network_type_v<Ntk> )
@@ -313,11 +395,7 @@ private:
         if ( this->is_pi( n ) || this->is_constant( n ) )
           return true;
         this->foreach_fanin( n, [&]( auto const& c ) {
-          auto& fanout = _fanout[c];
-          if ( std::find( fanout.begin(), fanout.end(), n ) == fanout.end() )
-          {
-            fanout.push_back( n );
-          }
+          add_unique( this->get_node( c ), n );
         } );
         return true;
       } );
@@ -326,17 +404,86 @@ private:
     {
       this->foreach_gate( [&]( auto const& n ) {
         this->foreach_fanin( n, [&]( auto const& c ) {
-          auto& fanout = _fanout[c];
-          if ( std::find( fanout.begin(), fanout.end(), n ) == fanout.end() )
-          {
-            fanout.push_back( n );
-          }
+          add_unique( this->get_node( c ), n );
         } );
       } );
     }
   }
 
-  node_map<std::vector<node>, Ntk> _fanout;
+  void resize_segments()
+  {
+    if ( _segments.size() < this->size() )
+    {
+      _segments.resize( this->size() );
+    }
+  }
+
+  void append_fanout( node const& n, node const& fanout )
+  {
+    auto& seg = _segments[this->node_to_index( n )];
+    if ( seg.size == seg.capacity )
+    {
+      move_segment( seg, std::max<uint32_t>( 4u, 2u * seg.capacity ) );
+    }
+    _fanouts[seg.begin + seg.size++] = fanout;
+  }
+
+  /* removes all occurrences of `fanout`, keeping the order of the others */
+  void remove_fanout( node const& n, node const& fanout )
+  {
+    auto& seg = _segments[this->node_to_index( n )];
+    auto const first = _fanouts.begin() + seg.begin;
+    auto const last = std::remove( first, first + seg.size, fanout );
+    seg.size = static_cast<uint32_t>( std::distance( first, last ) );
+  }
+
+  void clear_fanout( node const& n )
+  {
+    _segments[this->node_to_index( n )].size = 0u;
+  }
+
+  struct segment
+  {
+    uint64_t begin{ 0 };
+    uint32_t size{ 0 };
+    uint32_t capacity{ 0 };
+  };
+
+  void move_segment( segment& seg, uint32_t capacity )
+  {
+    if ( _garbage > 1024u && 2u * _garbage > _fanouts.size() && _active_iterations == 0u )
+    {
+      compact();
+    }
+
+    auto const begin = _fanouts.size();
+    _fanouts.resize( begin + capacity );
+    std::copy( _fanouts.begin() + seg.begin, _fanouts.begin() + seg.begin + seg.size, _fanouts.begin() + begin );
+    _garbage += seg.capacity;
+    seg.begin = begin;
+    seg.capacity = capacity;
+  }
+
+  /* moves all segments to a new array without unused entries */
+  void compact()
+  {
+    std::vector<node> fanouts;
+    fanouts.reserve( _fanouts.size() - _garbage );
+    for ( auto& seg : _segments )
+    {
+      auto const begin = fanouts.size();
+      fanouts.insert( fanouts.end(), _fanouts.begin() + seg.begin, _fanouts.begin() + seg.begin + seg.size );
+      seg.begin = begin;
+      seg.capacity = seg.size;
+    }
+    _fanouts = std::move( fanouts );
+    _garbage = 0u;
+  }
+
+  std::vector<segment> _segments;
+  std::vector<node> _fanouts;
+  uint64_t _garbage{ 0 };
+  mutable uint32_t _active_iterations{ 0 };
   fanout_view_params _ps;
 
   std::shared_ptr<typename network_events<Ntk>::add_event_type> add_event;
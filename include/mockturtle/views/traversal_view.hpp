@@ -0,0 +1,212 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018-2022  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*!
+  \file traversal_view.hpp
+  \brief Keeps traversal IDs, visited flags, and node values out of place
+*/
+
+#pragma once
+
+#include "../traits.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace mockturtle
+{
+
+/*! \brief Keeps the traversal state of a network in the view.
+ *
+ * Traversal IDs, visited flags, and node values are normally stored in the
+ * network itself, such that two algorithms that only read a network still
+ * cannot analyze it at the same time.  This view reimplements the methods
+ * `trav_id`, `incr_trav_id`, `visited`, `set_visited`, `clear_visited`,
+ * `value`, `set_value`, `incr_value`, `decr_value`, and `clear_values` on
+ * side arrays owned by the view, which are shared neither with the network
+ * nor with other views.  Algorithms that only use these methods to mark
+ * nodes (e.g., `topo_view`, `color_view`, reconvergence-driven cuts, the
+ * functions in `window_utils.hpp`, or MFFC computation with
+ * `detail::mffc_size`) can then run concurrently on the same network, one
+ * view per thread.
+ *
+ * Each entry is tagged with a generation, so clearing visited flags or
+ * values takes constant time.  The arrays grow when nodes are added to the
+ * network.
+ *
+ * The view copies `Ntk`.  If copying `Ntk` registers network events (e.g.,
+ * `fanout_view` or `depth_view`), create the views before starting the
+ * threads.
+ *
+ * **Required network functions:**
+ * - `size`
+ * - `node_to_index`
+ *
+ * Example
+ *
+   \verbatim embed:rst
+
+   .. code-block:: c++
+
+      aig_network aig = ...;
+
+      std::vector<std::thread> threads;
+      for ( auto i = 0u; i < 4u; ++i )
+      {
+        threads.emplace_back( [&aig]() {
+          traversal_view view{ aig };
+          topo_view topo{ view };
+          // ...
+        } );
+      }
+      for ( auto& t : threads )
+      {
+        t.join();
+      }
+   \endverbatim
+ */
+template<class Ntk>
+class traversal_view : public Ntk
+{
+public:
+  using storage = typename Ntk::storage;
+  using node = typename Ntk::node;
+  using signal = typename Ntk::signal;
+
+public:
+  explicit traversal_view( Ntk const& ntk )
+      : Ntk( ntk ), _visited( ntk.size() ), _values( ntk.size() )
+  {
+    static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+    static_assert( has_size_v<Ntk>, "Ntk does not implement the size method" );
+    static_assert( has_node_to_index_v<Ntk>, "Ntk does not implement the node_to_index method" );
+  }
+
+#pragma region Visited flags
+  void clear_visited() const
+  {
+    next_generation( _visited, _visited_generation );
+  }
+
+  uint32_t visited( node const& n ) const
+  {
+    return get( _visited, _visited_generation, n );
+  }
+
+  void set_visited( node const& n, uint32_t v ) const
+  {
+    set( _visited, _visited_generation, n, v );
+  }
+
+  uint32_t trav_id() const
+  {
+    return _trav_id;
+  }
+
+  void incr_trav_id() const
+  {
+    ++_trav_id;
+  }
+#pragma endregion
+
+#pragma region Custom node values
+  void clear_values() const
+  {
+    next_generation( _values, _values_generation );
+  }
+
+  uint32_t value( node const& n ) const
+  {
+    return get( _values, _values_generation, n );
+  }
+
+  void set_value( node const& n, uint32_t v ) const
+  {
+    set( _values, _values_generation, n, v );
+  }
+
+  uint32_t incr_value( node const& n ) const
+  {
+    auto const v = value( n );
+    set_value( n, v + 1 );
+    return v;
+  }
+
+  uint32_t decr_value( node const& n ) const
+  {
+    auto const v = value( n ) - 1;
+    set_value( n, v );
+    return v;
+  }
+#pragma endregion
+
+private:
+  struct entry
+  {
+    uint32_t generation{ 0 };
+    uint32_t data{ 0 };
+  };
+
+  static void next_generation( std::vector<entry>& entries, uint32_t& generation )
+  {
+    /* entries of old generations become valid again after a wrap-around */
+    if ( ++generation == 0u )
+    {
+      std::fill( entries.begin(), entries.end(), entry{} );
+    }
+  }
+
+  uint32_t get( std::vector<entry> const& entries, uint32_t generation, node const& n ) const
+  {
+    auto const index = this->node_to_index( n );
+    if ( index >= entries.size() || entries[index].generation != generation )
+    {
+      return 0u;
+    }
+    return entries[index].data;
+  }
+
+  void set( std::vector<entry>& entries, uint32_t generation, node const& n, uint32_t v ) const
+  {
+    auto const index = this->node_to_index( n );
+    if ( index >= entries.size() )
+    {
+      entries.resize( std::max<std::size_t>( this->size(), index + 1u ) );
+    }
+    entries[index] = { generation, v };
+  }
+
+private:
+  mutable std::vector<entry> _visited;
+  mutable std::vector<entry> _values;
+  mutable uint32_t _visited_generation{ 0 };
+  mutable uint32_t _values_generation{ 0 };
+  mutable uint32_t _trav_id{ 0 };
+}; /* traversal_view */
+
+template<class T>
+traversal_view( T const& ) -> traversal_view<T>;
+
+} // namespace mockturtle
@@ -37,9 +37,18 @@
 #include "common.hpp"
 #include "diagnostics.hpp"
 #include "detail/utils.hpp"
+#include <array>
 #include <fstream>
 #include <iostream>
-#include <regex>
+#include <iterator>
+#include <string_view>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace lorina
 {
@@ -425,18 +434,229 @@ public:
   std::ostream& _os; /*!< Output stream */
 }; /* ascii_aiger_pretty_printer */
 
-namespace aig_regex
+namespace detail
+{
+
+/* reads lines and encoded numbers from a memory buffer; lines end as in `detail::getline` */
+class aiger_buffer
+{
+public:
+  aiger_buffer( char const* data, std::size_t size )
+      : _pos( data ), _end( data + size )
+  {
+  }
+
+  bool getline( std::string_view& line )
+  {
+    if ( _pos == _end )
+    {
+      line = {};
+      return false;
+    }
+
+    auto const begin = _pos;
+    while ( _pos != _end && *_pos != '\n' && *_pos != '\r' )
+    {
+      ++_pos;
+    }
+    line = std::string_view( begin, _pos - begin );
+
+    if ( _pos != _end && *_pos++ == '\r' && _pos != _end && *_pos == '\n' )
+    {
+      ++_pos;
+    }
+    return true;
+  }
+
+  /* decodes one delta of the binary AND section (7 bits per byte, LSB first) */
+  bool decode( uint32_t& value )
+  {
+    uint64_t result = 0u;
+    for ( auto shift = 0u; _pos != _end && shift < 35u; shift += 7u )
+    {
+      auto const c = static_cast<unsigned char>( *_pos++ );
+      result |= static_cast<uint64_t>( c & 0x7f ) << shift;
+      if ( ( c & 0x80 ) == 0 )
+      {
+        value = static_cast<uint32_t>( result );
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  char const* _pos;
+  char const* _end;
+};
+
+/* parses a non-empty sequence of digits at the beginning of `s` */
+inline bool parse_aiger_number( std::string_view& s, uint64_t& value )
+{
+  auto i = 0u;
+  value = 0u;
+  for ( ; i < s.size() && s[i] >= '0' && s[i] <= '9'; ++i )
+  {
+    value = 10u * value + static_cast<uint64_t>( s[i] - '0' );
+  }
+  s.remove_prefix( i );
+  return i > 0u;
+}
+
+/* value of a line that contains a literal (like `std::atol`) */
+inline uint64_t aiger_literal( std::string_view s )
 {
-static std::regex header( R"(^aig (\d+) (\d+) (\d+) (\d+) (\d+)( \d+)?( \d+)?( \d+)?( \d+)?$)" );
-static std::regex ascii_header( R"(^aag (\d+) (\d+) (\d+) (\d+) (\d+)( \d+)?( \d+)?( \d+)?( \d+)?$)" );
-static std::regex input( R"(^i(\d+) (.*)$)" );
-static std::regex latch( R"(^l(\d+) (.*)$)" );
-static std::regex output( R"(^o(\d+) (.*)$)" );
-static std::regex bad_state( R"(^b(\d+) (.*)$)" );
-static std::regex constraint( R"(^c(\d+) (.*)$)" );
-static std::regex justice( R"(^j(\d+) (.*)$)" );
-static std::regex fairness( R"(^f(\d+) (.*)$)" );
-} // namespace aig_regex
+  while ( !s.empty() && s.front() == ' ' )
+  {
+    s.remove_prefix( 1u );
+  }
+  uint64_t value;
+  parse_aiger_number( s, value );
+  return value;
+}
+
+/* parses `<keyword> M I L O A [B C J F]` into `values` (missing values are 0) */
+inline bool parse_aiger_header( std::string_view line, std::string_view keyword, std::array<uint64_t, 9u>& values )
+{
+  if ( line.substr( 0u, keyword.size() ) != keyword )
+  {
+    return false;
+  }
+  line.remove_prefix( keyword.size() );
+
+  values.fill( 0u );
+  auto count = 0u;
+  while ( !line.empty() )
+  {
+    if ( count == values.size() || line.front() != ' ' )
+    {
+      return false;
+    }
+    line.remove_prefix( 1u );
+    if ( !parse_aiger_number( line, values[count++] ) )
+    {
+      return false;
+    }
+  }
+  return count >= 5u;
+}
+
+/* parses a symbol table entry `<kind><pos> <name>`, returns false for other lines */
+inline bool parse_aiger_symbol( std::string_view line, const aiger_reader& reader )
+{
+  if ( line.empty() )
+  {
+    return false;
+  }
+
+  auto const kind = line.front();
+  auto rest = line.substr( 1u );
+  uint64_t pos;
+  if ( !parse_aiger_number( rest, pos ) || rest.empty() || rest.front() != ' ' )
+  {
+    return false;
+  }
+  std::string const name( rest.substr( 1u ) );
+
+  switch ( kind )
+  {
+  case 'i':
+    reader.on_input_name( pos, name );
+    return true;
+  case 'l':
+    reader.on_latch_name( pos, name );
+    return true;
+  case 'o':
+    reader.on_output_name( pos, name );
+    return true;
+  case 'b':
+    reader.on_bad_state_name( pos, name );
+    return true;
+  case 'c':
+    reader.on_constraint_name( pos, name );
+    return true;
+  case 'j':
+    reader.on_justice_name( pos, name );
+    return true;
+  case 'f':
+    reader.on_fairness_name( pos, name );
+    return true;
+  default:
+    return false;
+  }
+}
+
+/* read-only contents of a file, memory-mapped if possible */
+class aiger_file
+{
+public:
+  explicit aiger_file( const std::string& filename )
+  {
+#if defined( __unix__ ) || defined( __APPLE__ )
+    auto const fd = ::open( filename.c_str(), O_RDONLY );
+    if ( fd < 0 )
+    {
+      return;
+    }
+    _is_open = true;
+    struct stat st;
+    if ( ::fstat( fd, &st ) == 0 && st.st_size > 0 )
+    {
+      auto const addr = ::mmap( nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+      if ( addr != MAP_FAILED )
+      {
+        _mapped = static_cast<char const*>( addr );
+        _size = st.st_size;
+      }
+    }
+    ::close( fd );
+    if ( _mapped != nullptr )
+    {
+      return;
+    }
+#endif
+    std::ifstream in( filename, std::ifstream::binary );
+    _is_open = in.is_open();
+    _buffer.assign( std::istreambuf_iterator<char>( in ), std::istreambuf_iterator<char>() );
+    _size = _buffer.size();
+  }
+
+  ~aiger_file()
+  {
+#if defined( __unix__ ) || defined( __APPLE__ )
+    if ( _mapped != nullptr )
+    {
+      ::munmap( const_cast<char*>( _mapped ), _size );
+    }
+#endif
+  }
+
+  aiger_file( aiger_file const& ) = delete;
+  aiger_file& operator=( aiger_file const& ) = delete;
+
+  bool is_open() const
+  {
+    return _is_open;
+  }
+
+  char const* data() const
+  {
+    return _mapped != nullptr ? _mapped : _buffer.data();
+  }
+
+  std::size_t size() const
+  {
+    return _size;
+  }
+
+private:
+  bool _is_open{ false };
+  char const* _mapped{ nullptr };
+  std::string _buffer;
+  std::size_t _size{ 0 };
+};
+
+} // namespace detail
 
 /*! \brief Reader function for ASCII AIGER format.
  *
@@ -452,35 +672,24 @@ static std::regex fairness( R"(^f(\d+) (.*)$)" );
 {
   return_code result = return_code::success;
 
-  std::smatch m;
   std::string header_line;
   detail::getline( in, header_line );
 
   uint64_t _m, _i, _l, _o, _a, _b, _c, _j, _f;
 
   /* header */
-  if ( std::regex_search( header_line, m, aig_regex::ascii_header ) )
-  {
-    std::vector<uint64_t> header;
-    for ( const auto& i : m )
-    {
-      if ( i == "" )
-        continue;
-      header.push_back( std::atol( std::string( i ).c_str() ) );
-    }
-
-    assert( header.size() >= 6u );
-    assert( header.size() <= 10u );
-
-    _m = header[1u];
-    _i = header[2u];
-    _l = header[3u];
-    _o = header[4u];
-    _a = header[5u];
-    _b = header.size() > 6 ? header[6u] : 0ul;
-    _c = header.size() > 7 ? header[7u] : 0ul;
-    _j = header.size() > 8 ? header[8u] : 0ul;
-    _f = header.size() > 9 ? header[9u] : 0ul;
+  std::array<uint64_t, 9u> header;
+  if ( detail::parse_aiger_header( header_line, "aag", header ) )
+  {
+    _m = header[0u];
+    _i = header[1u];
+    _l = header[2u];
+    _o = header[3u];
+    _a = header[4u];
+    _b = header[5u];
+    _c = header[6u];
+    _j = header[7u];
+    _f = header[8u];
     reader.on_header( _m, _i, _l, _o, _a, _b, _c, _j, _f );
   }
   else
@@ -614,33 +823,9 @@ static std::regex fairness( R"(^f(\d+) (.*)$)" );
   /* parse names and comments */
   while ( detail::getline( in, line ) )
   {
-    if ( std::regex_search( line, m, aig_regex::input ) )
-    {
-      reader.on_input_name( std::atol( std::string( m[1u] ).c_str() ), m[2u] );
-    }
-    else if ( std::regex_search( line, m, aig_regex::latch ) )
-    {
-      reader.on_latch_name( std::atol( std::string( m[1u] ).c_str() ), m[2u] );
-    }
-    else if ( std::regex_search( line, m, aig_regex::output ) )
-    {
-      reader.on_output_name( std::atol( std::string( m[1u] ).c_str() ), m[2u] );
-    }
-    else if ( std::regex_search( line, m, aig_regex::bad_state ) )
-    {
-      reader.on_bad_state_name( std::atol( std::string( m[1u] ).c_str() ), m[2u] );
-    }
-    else if ( std::regex_search( line, m, aig_regex::constraint ) )
-    {
-      reader.on_constraint_name( std::atol( std::string( m[1u] ).c_str() ), m[2u] );
-    }
-    else if ( std::regex_search( line, m, aig_regex::justice ) )
-    {
-      reader.on_justice_name( std::atol( std::string( m[1u] ).c_str() ), m[2u] );
-    }
-    else if ( std::regex_search( line, m, aig_regex::fairness ) )
+    if ( detail::parse_aiger_symbol( line, reader ) )
     {
-      reader.on_fairness_name( std::atol( std::string( m[1u] ).c_str() ), m[2u] );
+      continue;
     }
     else if ( line == "c" )
     {
@@ -688,60 +873,49 @@ static std::regex fairness( R"(^f(\d+) (.*)$)" );
 
 /*! \brief Reader function for binary AIGER format.
  *
- * Reads binary AIGER format from a stream and invokes a callback
+ * Reads binary AIGER format from a memory buffer and invokes a callback
  * method for each parsed primitive and each detected parse error.
  *
- * \param in Input stream
+ * \param data Pointer to the contents of an AIGER file
+ * \param size Size of the contents in bytes
  * \param reader An AIGER reader with callback methods invoked for parsed primitives
  * \param diag An optional diagnostic engine with callback methods for parse errors
  * \return Success if parsing has been successful, or parse error if parsing has failed
  */
-[[nodiscard]] inline return_code read_aiger( std::istream& in, const aiger_reader& reader, diagnostic_engine* diag = nullptr )
+[[nodiscard]] inline return_code read_aiger_buffer( char const* data, std::size_t size, const aiger_reader& reader, diagnostic_engine* diag = nullptr )
 {
   return_code result = return_code::success;
 
-  std::smatch m;
-  std::string header_line;
-  detail::getline( in, header_line );
+  detail::aiger_buffer in( data, size );
+  std::string_view line;
+  in.getline( line );
 
   uint32_t _m, _i, _l, _o, _a, _b, _c, _j, _f;
 
   /* parse header */
-  if ( std::regex_search( header_line, m, aig_regex::header ) )
-  {
-    std::vector<uint32_t> header;
-    for ( const auto& i : m )
-    {
-      if ( i == "" )
-        continue;
-      header.push_back( std::atol( std::string( i ).c_str() ) );
-    }
-
-    assert( header.size() >= 6u );
-    assert( header.size() <= 10u );
-
-    _m = header[1u];
-    _i = header[2u];
-    _l = header[3u];
-    _o = header[4u];
-    _a = header[5u];
-    _b = header.size() > 6 ? header[6u] : 0u;
-    _c = header.size() > 7 ? header[7u] : 0u;
-    _j = header.size() > 8 ? header[8u] : 0u;
-    _f = header.size() > 9 ? header[9u] : 0u;
+  std::array<uint64_t, 9u> header;
+  if ( detail::parse_aiger_header( line, "aig", header ) )
+  {
+    _m = static_cast<uint32_t>( header[0u] );
+    _i = static_cast<uint32_t>( header[1u] );
+    _l = static_cast<uint32_t>( header[2u] );
+    _o = static_cast<uint32_t>( header[3u] );
+    _a = static_cast<uint32_t>( header[4u] );
+    _b = static_cast<uint32_t>( header[5u] );
+    _c = static_cast<uint32_t>( header[6u] );
+    _j = static_cast<uint32_t>( header[7u] );
+    _f = static_cast<uint32_t>( header[8u] );
     reader.on_header( _m, _i, _l, _o, _a, _b, _c, _j, _f );
   }
   else
   {
     if ( diag )
     {
-      diag->report( diag_id::ERR_AIGER_HEADER ).add_argument( header_line );
+      diag->report( diag_id::ERR_AIGER_HEADER ).add_argument( std::string( line ) );
     }
     return return_code::parse_error;
   }
 
-  std::string line;
-
   /* inputs */
   for ( auto i = 0u; i < _i; ++i )
   {
@@ -751,51 +925,49 @@ static std::regex fairness( R"(^f(\d+) (.*)$)" );
   /* latches */
   for ( auto i = 0u; i < _l; ++i )
   {
-    detail::getline( in, line );
-    const auto tokens = detail::split( line, " " );
-    const auto next = std::atoi( tokens[0u].c_str() );
+    in.getline( line );
+    uint64_t next;
+    auto rest = line;
+    detail::parse_aiger_number( rest, next );
     aiger_reader::latch_init_value init_value = aiger_reader::latch_init_value::NONDETERMINISTIC;
-    if ( tokens.size() == 2u )
+    if ( rest == " 0" )
     {
-      if ( tokens[1u] == "0" )
-      {
-        init_value = aiger_reader::latch_init_value::ZERO;
-      }
-      else if ( tokens[1u] == "1" )
-      {
-        init_value = aiger_reader::latch_init_value::ONE;
-      }
+      init_value = aiger_reader::latch_init_value::ZERO;
+    }
+    else if ( rest == " 1" )
+    {
+      init_value = aiger_reader::latch_init_value::ONE;
     }
 
-    reader.on_latch( _i + i + 1u, next, init_value );
+    reader.on_latch( _i + i + 1u, static_cast<uint32_t>( next ), init_value );
   }
 
   for ( auto i = 0u; i < _o; ++i )
   {
-    detail::getline( in, line );
-    reader.on_output( i, std::atol( line.c_str() ) );
+    in.getline( line );
+    reader.on_output( i, static_cast<uint32_t>( detail::aiger_literal( line ) ) );
   }
 
   /* bad state properties */
   for ( auto i = 0u; i < _b; ++i )
   {
-    detail::getline( in, line );
-    reader.on_bad_state( i, std::atol( line.c_str() ) );
+    in.getline( line );
+    reader.on_bad_state( i, static_cast<uint32_t>( detail::aiger_literal( line ) ) );
   }
 
   /* constraints */
   for ( auto i = 0u; i < _c; ++i )
   {
-    detail::getline( in, line );
-    reader.on_constraint( i, std::atol( line.c_str() ) );
+    in.getline( line );
+    reader.on_constraint( i, static_cast<uint32_t>( detail::aiger_literal( line ) ) );
   }
 
   /* justice properties */
   std::vector<uint64_t> justice_sizes;
   for ( auto i = 0u; i < _j; ++i )
   {
-    detail::getline( in, line );
-    const auto justice_size = std::atol( line.c_str() );
+    in.getline( line );
+    const auto justice_size = detail::aiger_literal( line );
     justice_sizes.emplace_back( justice_size );
     reader.on_justice_header( i, justice_size );
   }
@@ -805,9 +977,8 @@ static std::regex fairness( R"(^f(\d+) (.*)$)" );
     std::vector<uint32_t> lits;
     for ( auto j = 0u; j < justice_sizes[i]; ++j )
     {
-      detail::getline( in, line );
-      const auto lit = std::atol( line.c_str() );
-      lits.emplace_back( lit );
+      in.getline( line );
+      lits.emplace_back( static_cast<uint32_t>( detail::aiger_literal( line ) ) );
     }
     reader.on_justice( i, lits );
   }
@@ -815,70 +986,37 @@ static std::regex fairness( R"(^f(\d+) (.*)$)" );
   /* fairness */
   for ( auto i = 0u; i < _f; ++i )
   {
-    detail::getline( in, line );
-    reader.on_fairness( i, std::atol( line.c_str() ) );
+    in.getline( line );
+    reader.on_fairness( i, static_cast<uint32_t>( detail::aiger_literal( line ) ) );
   }
 
-  const auto decode = [&]() {
-    auto i = 0;
-    auto res = 0;
-    while ( true )
-    {
-      auto c = in.get();
-
-      res |= ( ( c & 0x7f ) << ( 7 * i ) );
-      if ( ( c & 0x80 ) == 0 )
-        break;
-
-      ++i;
-    }
-    return res;
-  };
-
   /* and gates */
   for ( auto i = _i + _l + 1; i < _i + _l + _a + 1; ++i )
   {
-    const auto d1 = decode();
-    const auto d2 = decode();
+    uint32_t d1, d2;
+    if ( !in.decode( d1 ) || !in.decode( d2 ) )
+    {
+      if ( diag )
+      {
+        diag->report( diag_id::ERR_AIGER_AND_DECLARATION ).add_argument( std::to_string( i ) );
+      }
+      return return_code::parse_error;
+    }
     const auto g = i << 1;
     reader.on_and( i, ( g - d1 ), ( g - d1 - d2 ) );
   }
 
   /* parse names and comments */
-  while ( detail::getline( in, line ) )
+  while ( in.getline( line ) )
   {
-    if ( std::regex_search( line, m, aig_regex::input ) )
-    {
-      reader.on_input_name( std::atol( std::string( m[1u] ).c_str() ), m[2u] );
-    }
-    else if ( std::regex_search( line, m, aig_regex::latch ) )
-    {
-      reader.on_latch_name( std::atol( std::string( m[1u] ).c_str() ), m[2u] );
-    }
-    else if ( std::regex_search( line, m, aig_regex::output ) )
+    if ( detail::parse_aiger_symbol( line, reader ) )
     {
-      reader.on_output_name( std::atol( std::string( m[1u] ).c_str() ), m[2u] );
-    }
-    else if ( std::regex_search( line, m, aig_regex::bad_state ) )
-    {
-      reader.on_bad_state_name( std::atol( std::string( m[1u] ).c_str() ), m[2u] );
-    }
-    else if ( std::regex_search( line, m, aig_regex::constraint ) )
-    {
-      reader.on_constraint_name( std::atol( std::string( m[1u] ).c_str() ), m[2u] );
-    }
-    else if ( std::regex_search( line, m, aig_regex::justice ) )
-    {
-      reader.on_justice_name( std::atol( std::string( m[1u] ).c_str() ), m[2u] );
-    }
-    else if ( std::regex_search( line, m, aig_regex::fairness ) )
-    {
-      reader.on_fairness_name( std::atol( std::string( m[1u] ).c_str() ), m[2u] );
+      continue;
     }
     else if ( line == "c" )
     {
       std::string comment = "";
-      while ( detail::getline( in, line ) )
+      while ( in.getline( line ) )
       {
         comment += line;
       }
@@ -890,6 +1028,22 @@ static std::regex fairness( R"(^f(\d+) (.*)$)" );
   return result;
 }
 
+/*! \brief Reader function for binary AIGER format.
+ *
+ * Reads binary AIGER format from a stream and invokes a callback
+ * method for each parsed primitive and each detected parse error.
+ *
+ * \param in Input stream
+ * \param reader An AIGER reader with callback methods invoked for parsed primitives
+ * \param diag An optional diagnostic engine with callback methods for parse errors
+ * \return Success if parsing has been successful, or parse error if parsing has failed
+ */
+[[nodiscard]] inline return_code read_aiger( std::istream& in, const aiger_reader& reader, diagnostic_engine* diag = nullptr )
+{
+  std::string const data( std::istreambuf_iterator<char>( in ), std::istreambuf_iterator<char>{} );
+  return read_aiger_buffer( data.data(), data.size(), reader, diag );
+}
+
 /*! \brief Reader function for binary AIGER format.
  *
  * Reads binary AIGER format from a file and invokes a callback
@@ -902,8 +1056,8 @@ static std::regex fairness( R"(^f(\d+) (.*)$)" );
  */
 [[nodiscard]] inline return_code read_aiger( const std::string& filename, const aiger_reader& reader, diagnostic_engine* diag = nullptr )
 {
-  std::ifstream in( detail::word_exp_filename( filename ), std::ifstream::binary );
-  if ( !in.is_open() )
+  detail::aiger_file file( detail::word_exp_filename( filename ) );
+  if ( !file.is_open() )
   {
     if ( diag )
     {
@@ -913,9 +1067,7 @@ static std::regex fairness( R"(^f(\d+) (.*)$)" );
   }
   else
   {
-    auto const ret = read_aiger( in, reader, diag );
-    in.close();
-    return ret;
+    return read_aiger_buffer( file.data(), file.size(), reader, diag );
   }
 }
 
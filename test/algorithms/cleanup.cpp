@@ -350,3 +350,59 @@ TEST_CASE( "cleanup crossed network", "[cleanup]" )
   CHECK( crossed_simulation[1] == cleaned_crossed_simulation[1] );
   CHECK( crossed_simulation[2] == cleaned_crossed_simulation[2] );
 }
+
+TEMPLATE_TEST_CASE( "cleanup merges structurally equal gates after substitution without restrashing", "[cleanup]", aig_network, xag_network, mig_network, xmg_network )
+{
+  TestType ntk;
+  auto const a = ntk.create_pi();
+  auto const b = ntk.create_pi();
+  auto const c = ntk.create_pi();
+  auto const g = ntk.create_and( b, c );
+  auto const f1 = ntk.create_and( a, b );
+  auto const f2 = ntk.create_and( a, g );
+  auto const f3 = ntk.create_and( f2, c );
+  auto const f4 = ntk.create_or( f1, f3 );
+  ntk.create_po( f4 );
+  ntk.create_po( f1 );
+
+  /* f2 becomes a duplicate of f1 */
+  ntk.substitute_node_no_restrash( ntk.get_node( g ), b );
+
+  auto const copy = cleanup_dangling( ntk );
+  CHECK( copy.num_gates() == 3u );
+  CHECK( simulate<kitty::static_truth_table<3u>>( copy ) == simulate<kitty::static_truth_table<3u>>( ntk ) );
+
+  /* the structural hash table of the copy is complete */
+  auto ext = copy;
+  auto const num_gates = ext.num_gates();
+  ext.foreach_gate( [&]( auto const& n ) {
+    std::vector<typename TestType::signal> children;
+    ext.foreach_fanin( n, [&]( auto const& f ) { children.push_back( f ); } );
+    CHECK( ext.get_node( ext.clone_node( ext, n, children ) ) == n );
+  } );
+  CHECK( ext.num_gates() == num_gates );
+}
+
+TEMPLATE_TEST_CASE( "cleanup merges gates that become equal when trivial gates are simplified", "[cleanup]", aig_network, xag_network, mig_network, xmg_network )
+{
+  TestType ntk;
+  auto const a = ntk.create_pi();
+  auto const b = ntk.create_pi();
+  auto const c = ntk.create_pi();
+  auto const d = ntk.create_and( b, c );
+  auto const h = ntk.create_and( b, d );
+  auto const f1 = ntk.create_and( a, b );
+  auto const f2 = ntk.create_and( a, h );
+  ntk.create_po( ntk.create_or( f1, f2 ) );
+
+  /* h becomes AND( b, b ), all gates stay in the hash table */
+  ntk.substitute_node_no_restrash( ntk.get_node( d ), b );
+  uint32_t num_gates{ 0u };
+  ntk.foreach_gate( [&]( auto const& ) { ++num_gates; } );
+  CHECK( num_gates == ntk.num_gates() );
+
+  /* the copies of f1 and f2 are equal */
+  auto const copy = cleanup_dangling( ntk );
+  CHECK( copy.num_gates() == 1u );
+  CHECK( simulate<kitty::static_truth_table<3u>>( copy ) == simulate<kitty::static_truth_table<3u>>( ntk ) );
+}
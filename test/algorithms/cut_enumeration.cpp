@@ -4,10 +4,14 @@
 
 #include <kitty/constructors.hpp>
 #include <kitty/dynamic_truth_table.hpp>
+#include <kitty/operations.hpp>
 #include <mockturtle/algorithms/cut_enumeration.hpp>
+#include <mockturtle/algorithms/cut_enumeration/spectr_cut.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
 #include <mockturtle/networks/aig.hpp>
 #include <mockturtle/networks/klut.hpp>
 #include <mockturtle/networks/sequential.hpp>
+#include <mockturtle/networks/xag.hpp>
 
 using namespace mockturtle;
 
@@ -139,6 +143,138 @@ TEST_CASE( "compute truth tables of AIG cuts", "[cut_enumeration]" )
   CHECK( cuts.truth_table( cuts.cuts( i4 )[3] )._bits[0] == 0x0d );
 }
 
+TEMPLATE_TEST_CASE( "compute truth tables of cuts with up to 6 leaves on words", "[cut_enumeration]", aig_network, xag_network, klut_network )
+{
+  TestType ntk;
+  std::vector<typename TestType::signal> fs;
+  for ( auto i = 0u; i < 8u; ++i )
+  {
+    fs.push_back( ntk.create_pi() );
+  }
+  for ( auto i = 0u; i < 120u; ++i )
+  {
+    auto const a = fs[fs.size() - 1u - ( i % 3u )];
+    auto const b = fs[( 11u * i + 3u ) % fs.size()];
+    auto const c = fs[( 5u * i ) % 8u];
+    fs.push_back( i % 5u == 0u ? ntk.create_maj( a, ntk.create_not( b ), c ) : ( i % 3u == 0u ? ntk.create_xor( a, b ) : ntk.create_and( a, ntk.create_not( b ) ) ) );
+  }
+  ntk.create_po( fs.back() );
+  auto const tts = simulate_nodes<kitty::dynamic_truth_table>( ntk, default_simulator<kitty::dynamic_truth_table>( 8u ) );
+
+  for ( auto cut_size : { 4u, 6u, 8u } )
+  {
+    for ( auto minimize : { false, true } )
+    {
+      cut_enumeration_params ps;
+      ps.cut_size = cut_size;
+      ps.minimize_truth_table = minimize;
+      auto const cuts = cut_enumeration<TestType, true>( ntk, ps );
+
+      /* the cut function composed with the functions of the leaves is the function of the node */
+      ntk.foreach_gate( [&]( auto const& n ) {
+        for ( auto const& cut : cuts.cuts( ntk.node_to_index( n ) ) )
+        {
+          std::vector<kitty::dynamic_truth_table> leaves;
+          for ( auto leaf : *cut )
+          {
+            leaves.push_back( tts[ntk.index_to_node( leaf )] );
+          }
+          auto const tt = cuts.truth_table( *cut );
+          REQUIRE( tt.num_vars() == leaves.size() );
+          if ( leaves.empty() )
+          {
+            CHECK( ( kitty::is_const0( tt ) ? kitty::is_const0( tts[n] ) : kitty::is_const0( ~tts[n] ) ) );
+            continue;
+          }
+          CHECK( kitty::compose_truth_table( tt, leaves ) == tts[n] );
+        }
+      } );
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE( "enumerate cuts in parallel over levels", "[cut_enumeration]", aig_network, klut_network )
+{
+  /* wide levels, such that gates of a level are distributed to several threads */
+  TestType ntk;
+  std::vector<typename TestType::signal> prev, next;
+  for ( auto i = 0u; i < 16u; ++i )
+  {
+    prev.push_back( ntk.create_pi() );
+  }
+  for ( auto l = 0u; l < 6u; ++l )
+  {
+    next.clear();
+    for ( auto i = 0u; i < 1200u; ++i )
+    {
+      auto const a = prev[( 7u * i + l ) % prev.size()];
+      auto const b = prev[( 13u * i + 5u ) % prev.size()];
+      auto const c = prev[( 3u * i + 1u ) % prev.size()];
+      next.push_back( i % 7u == 0u ? ntk.create_maj( a, ntk.create_not( b ), c ) : ( i % 3u == 0u ? ntk.create_xor( a, b ) : ntk.create_and( a, ntk.create_not( b ) ) ) );
+    }
+    prev = next;
+  }
+  for ( auto const& f : prev )
+  {
+    ntk.create_po( f );
+  }
+
+  auto const to_vector = []( auto const& cut ) {
+    return std::vector<uint32_t>( cut.begin(), cut.end() );
+  };
+
+  for ( auto cut_size : { 4u, 8u } )
+  {
+    cut_enumeration_params ps;
+    ps.cut_size = cut_size;
+    ps.cut_limit = 8u;
+    auto const cuts = cut_enumeration<TestType, true>( ntk, ps );
+
+    ps.num_threads = 1u;
+    auto const cuts1 = parallel_cut_enumeration<TestType, true>( ntk, ps );
+    ps.num_threads = 4u;
+    auto const cuts4 = parallel_cut_enumeration<TestType, true>( ntk, ps );
+
+    CHECK( cuts1.total_tuples() == cuts.total_tuples() );
+    CHECK( cuts1.total_cuts() == cuts.total_cuts() );
+    CHECK( cuts4.total_cuts() == cuts.total_cuts() );
+
+    /* same cuts and functions as sequential enumeration, same literals for any number of threads */
+    ntk.foreach_node( [&]( auto const& n ) {
+      auto const index = ntk.node_to_index( n );
+      REQUIRE( cuts1.cuts( index ).size() == cuts.cuts( index ).size() );
+      REQUIRE( cuts4.cuts( index ).size() == cuts.cuts( index ).size() );
+      for ( auto i = 0u; i < cuts.cuts( index ).size(); ++i )
+      {
+        auto const& cut = cuts.cuts( index )[i];
+        auto const& cut1 = cuts1.cuts( index )[i];
+        auto const& cut4 = cuts4.cuts( index )[i];
+        CHECK( to_vector( cut1 ) == to_vector( cut ) );
+        CHECK( to_vector( cut4 ) == to_vector( cut ) );
+        CHECK( cuts1.truth_table( cut1 ) == cuts.truth_table( cut ) );
+        CHECK( cut4->func_id == cut1->func_id );
+      }
+    } );
+  }
+
+  /* cut data that depends on truth tables of cuts */
+  cut_enumeration_params ps;
+  ps.cut_size = 4u;
+  ps.cut_limit = 8u;
+  ps.num_threads = 3u;
+  auto const cuts = cut_enumeration<TestType, true, cut_enumeration_spectr_cut>( ntk, ps );
+  auto const pcuts = parallel_cut_enumeration<TestType, true, cut_enumeration_spectr_cut>( ntk, ps );
+  ntk.foreach_gate( [&]( auto const& n ) {
+    auto const index = ntk.node_to_index( n );
+    REQUIRE( pcuts.cuts( index ).size() == cuts.cuts( index ).size() );
+    for ( auto i = 0u; i < cuts.cuts( index ).size(); ++i )
+    {
+      CHECK( to_vector( pcuts.cuts( index )[i] ) == to_vector( cuts.cuts( index )[i] ) );
+      CHECK( pcuts.cuts( index )[i]->data.cost == cuts.cuts( index )[i]->data.cost );
+    }
+  } );
+}
+
 TEST_CASE( "compute XOR network cuts in 2-LUT network", "[cut_enumeration]" )
 {
   klut_network klut;
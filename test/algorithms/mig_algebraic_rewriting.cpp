@@ -1,5 +1,7 @@
 #include <catch.hpp>
 
+#include <vector>
+
 #include <mockturtle/algorithms/mig_algebraic_rewriting.hpp>
 #include <mockturtle/networks/mig.hpp>
 #include <mockturtle/traits.hpp>
@@ -139,3 +141,90 @@ TEST_CASE( "MIG aggressive depth optimization", "[mig_algebraic_rewriting]" )
 
   CHECK( depth_mig.depth() == 2 );
 }
+
+TEST_CASE( "MIG depth optimization with incremental level updates", "[mig_algebraic_rewriting]" )
+{
+  auto const build = []( mig_network& mig ) {
+    std::vector<mig_network::signal> fs;
+    for ( auto i = 0u; i < 10u; ++i )
+    {
+      fs.push_back( mig.create_pi() );
+    }
+    for ( auto i = 0u; i < 120u; ++i )
+    {
+      auto const x = fs[i % 10u];
+      auto const y = fs[( 7u * i + 3u ) % fs.size()] ^ ( i % 4u == 0u );
+      fs.push_back( mig.create_maj( x, y, fs.back() ) );
+    }
+    mig.create_po( fs.back() );
+    mig.create_po( fs[fs.size() / 2u] );
+  };
+
+  for ( auto strategy : { mig_algebraic_depth_rewriting_params::dfs, mig_algebraic_depth_rewriting_params::selective, mig_algebraic_depth_rewriting_params::aggressive } )
+  {
+    mig_algebraic_depth_rewriting_params ps;
+    ps.strategy = strategy;
+
+    mig_network mig1, mig2;
+    build( mig1 );
+    build( mig2 );
+
+    depth_view depth_mig1{ mig1 };
+    mig_algebraic_depth_rewriting( depth_mig1, ps );
+
+    depth_view_params dps;
+    dps.incremental = true;
+    depth_view depth_mig2{ mig2, {}, dps };
+    mig_algebraic_depth_rewriting( depth_mig2, ps );
+
+    CHECK( depth_mig2.depth() == depth_mig1.depth() );
+    CHECK( mig2.num_gates() == mig1.num_gates() );
+    CHECK( depth_mig2.depth() == depth_view{ mig2 }.depth() );
+  }
+}
+
+TEST_CASE( "MIG depth rewriting with fanout index", "[mig_algebraic_rewriting]" )
+{
+  auto const build = []( mig_network& mig ) {
+    std::vector<mig_network::signal> fs;
+    for ( auto i = 0u; i < 10u; ++i )
+    {
+      fs.push_back( mig.create_pi() );
+    }
+    for ( auto i = 0u; i < 120u; ++i )
+    {
+      auto const x = fs[i % 10u];
+      auto const y = fs[( 7u * i + 3u ) % fs.size()] ^ ( i % 4u == 0u );
+      fs.push_back( mig.create_maj( x, y, fs.back() ) );
+    }
+    mig.create_po( fs.back() );
+    mig.create_po( fs[fs.size() / 2u] );
+  };
+
+  for ( auto strategy : { mig_algebraic_depth_rewriting_params::dfs, mig_algebraic_depth_rewriting_params::selective, mig_algebraic_depth_rewriting_params::aggressive } )
+  {
+    mig_network scan, indexed;
+    build( scan );
+    build( indexed );
+
+    mig_algebraic_depth_rewriting_params ps;
+    ps.strategy = strategy;
+    ps.use_fanout_index = false;
+    depth_view depth_scan{ scan };
+    mig_algebraic_depth_rewriting( depth_scan, ps );
+
+    ps.use_fanout_index = true;
+    depth_view depth_indexed{ indexed };
+    mig_algebraic_depth_rewriting( depth_indexed, ps );
+    CHECK( !indexed.has_fanout_index() );
+
+    /* the index visits fanouts in the same order as the scan */
+    REQUIRE( scan.size() == indexed.size() );
+    for ( auto n = 0u; n < scan.size(); ++n )
+    {
+      CHECK( scan.is_dead( n ) == indexed.is_dead( n ) );
+      CHECK( scan._storage->nodes[n].children == indexed._storage->nodes[n].children );
+    }
+    CHECK( depth_scan.depth() == depth_indexed.depth() );
+  }
+}
@@ -54,6 +54,49 @@ TEST_CASE( "Resubstitution of AIGs", "[resubstitution]" )
   }
 }
 
+TEST_CASE( "Resubstitution of AIGs with batched events", "[resubstitution]" )
+{
+  using value_type = std::vector<uint32_t>;
+  std::vector<std::pair<value_type, uint32_t>> const test_cases{
+#include "aig_resubstitution.tc"
+  };
+
+  for ( const auto& tc : test_cases )
+  {
+    aig_network aig;
+    decode( aig, xag_index_list{ tc.first } );
+
+    uint64_t const size_before{ aig.size() };
+
+    default_simulator<kitty::dynamic_truth_table> sim( aig.num_pis() );
+    auto const tt = simulate<kitty::dynamic_truth_table>( aig, sim )[0];
+    using view_t = depth_view<fanout_view<aig_network>>;
+    fanout_view<aig_network> fanout_view{ aig };
+    view_t resub_view{ fanout_view };
+
+    resubstitution_params ps;
+    ps.use_fanout_index = true;
+    aig_resubstitution( resub_view, ps );
+    CHECK( !aig.has_fanout_index() );
+    CHECK( !aig.events().in_batch() );
+
+    /* the views were updated by the batched events */
+    aig.foreach_gate( [&]( auto const& n ) {
+      aig.foreach_fanin( n, [&]( auto const& f ) {
+        auto found = false;
+        resub_view.foreach_fanout( aig.get_node( f ), [&]( auto const& fo ) { found = found || fo == n; } );
+        CHECK( found );
+      } );
+    } );
+    aig = cleanup_dangling( aig );
+
+    auto const tt_prime = simulate<kitty::dynamic_truth_table>( aig, sim )[0];
+
+    CHECK( size_before - aig.size() == tc.second );
+    CHECK( tt == tt_prime );
+  }
+}
+
 TEST_CASE( "Replace with constant in AIG", "[resubstitution]" )
 {
   /* x1 * ( !x0 * !x1 ) ==> 0 */
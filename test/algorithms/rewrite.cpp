@@ -1,6 +1,14 @@
 #include <catch.hpp>
 
+#include <algorithm>
+#include <vector>
+
+#include <kitty/static_truth_table.hpp>
+#include <mockturtle/algorithms/cleanup.hpp>
+
 #include <mockturtle/algorithms/rewrite.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/generators/arithmetic.hpp>
 #include <mockturtle/algorithms/node_resynthesis/mig_npn.hpp>
 #include <mockturtle/algorithms/node_resynthesis/xag_npn.hpp>
 #include <mockturtle/algorithms/node_resynthesis/xmg3_npn.hpp>
@@ -11,6 +19,7 @@
 #include <mockturtle/traits.hpp>
 #include <mockturtle/utils/cost_functions.hpp>
 #include <mockturtle/utils/tech_library.hpp>
+#include <mockturtle/views/depth_view.hpp>
 #include <mockturtle/views/fanout_view.hpp>
 
 using namespace mockturtle;
@@ -216,3 +225,63 @@ TEST_CASE( "Rewrite depth-preserving", "[rewrite]" )
   CHECK( aig.num_pos() == 2 );
   CHECK( aig.num_gates() == 8 );
 }
+
+TEST_CASE( "Rewrite depth-preserving on an adder", "[rewrite]" )
+{
+  aig_network aig;
+  std::vector<aig_network::signal> a( 8u ), b( 8u );
+  std::generate( a.begin(), a.end(), [&]() { return aig.create_pi(); } );
+  std::generate( b.begin(), b.end(), [&]() { return aig.create_pi(); } );
+  auto carry = aig.get_constant( false );
+  carry_ripple_adder_inplace( aig, a, b, carry );
+  std::for_each( a.begin(), a.end(), [&]( auto const& f ) { aig.create_po( f ); } );
+  aig.create_po( carry );
+
+  auto const tts = simulate<kitty::static_truth_table<16u>>( aig );
+  auto const depth = depth_view{ aig }.depth();
+
+  xag_npn_resynthesis<aig_network> resyn;
+  exact_library_params eps;
+  eps.np_classification = false;
+  exact_library<aig_network> exact_lib( resyn, eps );
+
+  rewrite_params ps;
+  ps.preserve_depth = true;
+  rewrite( aig, exact_lib, ps );
+  aig = cleanup_dangling( aig );
+
+  CHECK( depth_view{ aig }.depth() <= depth );
+  CHECK( simulate<kitty::static_truth_table<16u>>( aig ) == tts );
+}
+
+TEST_CASE( "Rewrite depth-preserving on a non-incremental depth view", "[rewrite]" )
+{
+  aig_network aig;
+  std::vector<aig_network::signal> a( 8u ), b( 8u );
+  std::generate( a.begin(), a.end(), [&]() { return aig.create_pi(); } );
+  std::generate( b.begin(), b.end(), [&]() { return aig.create_pi(); } );
+  auto carry = aig.get_constant( false );
+  carry_ripple_adder_inplace( aig, a, b, carry );
+  std::for_each( a.begin(), a.end(), [&]( auto const& f ) { aig.create_po( f ); } );
+  aig.create_po( carry );
+
+  auto const tts = simulate<kitty::static_truth_table<16u>>( aig );
+
+  /* the levels of this view are not updated on substitutions */
+  depth_view depth_aig{ aig };
+  fanout_view fanout_aig{ depth_aig };
+  auto const depth = depth_aig.depth();
+
+  xag_npn_resynthesis<aig_network> resyn;
+  exact_library_params eps;
+  eps.np_classification = false;
+  exact_library<aig_network> exact_lib( resyn, eps );
+
+  rewrite_params ps;
+  ps.preserve_depth = true;
+  rewrite( fanout_aig, exact_lib, ps );
+  aig = cleanup_dangling( aig );
+
+  CHECK( depth_view{ aig }.depth() <= depth );
+  CHECK( simulate<kitty::static_truth_table<16u>>( aig ) == tts );
+}
@@ -2,7 +2,10 @@
 
 #include <mockturtle/algorithms/simulation.hpp>
 #include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/klut.hpp>
+#include <mockturtle/networks/mig.hpp>
 #include <mockturtle/networks/xag.hpp>
+#include <mockturtle/networks/xmg.hpp>
 
 #include <kitty/static_truth_table.hpp>
 
@@ -307,3 +310,161 @@ TEST_CASE( "Bit packing", "[simulation]" )
   CHECK( ( sim.compute_pi( 3 )._bits[0] & 0x0f ) == 0x0d ); /* x3 = xx1x101 -> x1101 */
   CHECK( ( sim.compute_pi( 4 )._bits[0] & 0x1f ) == 0x1d ); /* x4 = x1x1101 -> 11101 */
 }
+
+TEMPLATE_TEST_CASE( "Simulate level by level on several threads", "[simulation]", aig_network, xag_network, mig_network, xmg_network, klut_network )
+{
+  TestType ntk;
+  std::vector<typename TestType::signal> fs;
+  for ( auto i = 0u; i < 8u; ++i )
+  {
+    fs.push_back( ntk.create_pi() );
+  }
+  for ( auto i = 0u; i < 3000u; ++i )
+  {
+    auto const a = fs[( 7919u * i + 1u ) % fs.size()];
+    auto const b = ntk.create_not( fs[fs.size() - 1u - ( i % 13u )] );
+    auto const c = fs[( 31u * i ) % fs.size()];
+    switch ( i % 4u )
+    {
+    case 0u:
+      fs.push_back( ntk.create_xor( a, b ) );
+      break;
+    case 1u:
+      fs.push_back( ntk.create_maj( a, b, ntk.create_not( c ) ) );
+      break;
+    case 2u:
+      fs.push_back( ntk.create_xor3( a, c, b ) );
+      break;
+    default:
+      fs.push_back( ntk.create_and( ntk.create_not( a ), b ) );
+      break;
+    }
+  }
+  for ( auto i = 0u; i < 8u; ++i )
+  {
+    ntk.create_po( fs[fs.size() - 1u - 7u * i] );
+  }
+
+  parallel_simulation_params ps;
+  ps.num_threads = 4u;
+  ps.min_words_per_thread = 64u;
+
+  auto const check = [&]( auto const& sim ) {
+    using tt_t = std::decay_t<decltype( sim.compute_pi( 0u ) )>;
+    auto const expected = simulate_nodes<tt_t>( ntk, sim );
+    auto const actual = simulate_nodes_parallel<tt_t>( ntk, sim, ps );
+    ntk.foreach_node( [&]( auto const& n ) {
+      CHECK( actual[n] == expected[n] );
+    } );
+  };
+  check( default_simulator<kitty::static_truth_table<8u>>() );
+  check( default_simulator<kitty::dynamic_truth_table>( 8u ) );
+  check( partial_simulator( 8u, 1000u ) );
+
+  /* whole simulation of partial truth tables uses the same engine */
+  if constexpr ( has_compute_inplace_v<TestType, kitty::partial_truth_table> )
+  {
+    partial_simulator sim( 8u, 777u );
+    unordered_node_map<kitty::partial_truth_table, TestType> node_to_value( ntk );
+    simulate_nodes( ntk, node_to_value, sim, true );
+    auto const expected = simulate_nodes<kitty::partial_truth_table>( ntk, sim );
+    ntk.foreach_gate( [&]( auto const& n ) {
+      CHECK( node_to_value[n] == expected[n] );
+    } );
+
+    /* on several threads if requested */
+    unordered_node_map<kitty::partial_truth_table, TestType> node_to_value_parallel( ntk );
+    simulate_nodes( ntk, node_to_value_parallel, sim, true, ps );
+    ntk.foreach_gate( [&]( auto const& n ) {
+      CHECK( node_to_value_parallel[n] == expected[n] );
+    } );
+  }
+}
+
+TEMPLATE_TEST_CASE( "Simulate pattern blocks with bounded memory", "[simulation]", aig_network, xmg_network, klut_network )
+{
+  TestType ntk;
+  std::vector<typename TestType::signal> fs;
+  for ( auto i = 0u; i < 10u; ++i )
+  {
+    fs.push_back( ntk.create_pi() );
+  }
+  for ( auto i = 0u; i < 2000u; ++i )
+  {
+    auto const a = fs[fs.size() - 1u - ( i % 7u )];
+    auto const b = ntk.create_not( fs[fs.size() - 2u - ( i % 5u )] );
+    auto const c = fs[( 31u * i ) % 10u];
+    fs.push_back( i % 3u == 0u ? ntk.create_maj( a, b, c ) : ( i % 3u == 1u ? ntk.create_xor( a, b ) : ntk.create_and( a, c ) ) );
+  }
+  for ( auto i = 0u; i < 6u; ++i )
+  {
+    ntk.create_po( i % 2u == 0u ? fs[fs.size() - 1u - 11u * i] : ntk.create_not( fs[fs.size() - 1u - 11u * i] ) );
+  }
+  ntk.create_po( ntk.get_constant( true ) );
+  ntk.create_po( fs[3] );
+
+  partial_simulator sim( 10u, 1000u );
+  auto const expected_pos = simulate<kitty::partial_truth_table>( ntk, sim );
+  auto const expected_nodes = simulate_nodes<kitty::partial_truth_table>( ntk, sim );
+  std::vector<typename TestType::node> nodes{ ntk.get_node( fs[500] ), ntk.get_node( fs[1200] ), ntk.get_node( fs[1] ) };
+
+  block_simulation_params ps;
+  ps.block_size = 200u;
+  block_simulation_stats st;
+  uint32_t next = 0u;
+  simulate_blocks(
+      ntk, sim, [&]( uint32_t first, auto const& po_values, auto const& node_values ) {
+        CHECK( first == next );
+        REQUIRE( po_values.size() == ntk.num_pos() );
+        REQUIRE( node_values.size() == nodes.size() );
+        auto const size = po_values[0].num_bits();
+        CHECK( size == std::min( 256u, 1000u - first ) );
+        for ( auto b = 0u; b < size; ++b )
+        {
+          for ( auto i = 0u; i < po_values.size(); ++i )
+          {
+            CHECK( kitty::get_bit( po_values[i], b ) == kitty::get_bit( expected_pos[i], first + b ) );
+          }
+          for ( auto i = 0u; i < nodes.size(); ++i )
+          {
+            CHECK( kitty::get_bit( node_values[i], b ) == kitty::get_bit( expected_nodes[nodes[i]], first + b ) );
+          }
+        }
+        next = first + size;
+      },
+      nodes, ps, &st );
+
+  CHECK( next == 1000u );
+  CHECK( st.num_blocks == 4u );
+  CHECK( st.max_live_values < 40u );
+}
+
+TEMPLATE_TEST_CASE( "Simulate pattern blocks after substitutions", "[simulation]", aig_network, xag_network, mig_network, xmg_network )
+{
+  TestType ntk;
+  auto const a = ntk.create_pi();
+  auto const b = ntk.create_pi();
+  auto const c = ntk.create_pi();
+  auto const f1 = ntk.create_and( a, b );
+  auto const f2 = ntk.create_and( f1, c );
+  ntk.create_po( f2 );
+
+  /* the fanin of f2 gets a larger index than f2 */
+  auto const f3 = ntk.create_and( a, !b );
+  ntk.substitute_node( ntk.get_node( f1 ), f3 );
+  CHECK( ntk.node_to_index( ntk.get_node( f3 ) ) > ntk.node_to_index( ntk.get_node( f2 ) ) );
+
+  partial_simulator sim( 3u, 300u );
+  uint32_t num_blocks = 0u;
+  simulate_blocks( ntk, sim, [&]( uint32_t first, auto const& po_values, auto const& ) {
+    for ( auto i = 0u; i < po_values[0].num_bits(); ++i )
+    {
+      auto const va = kitty::get_bit( sim.get_patterns()[0], first + i );
+      auto const vb = kitty::get_bit( sim.get_patterns()[1], first + i );
+      auto const vc = kitty::get_bit( sim.get_patterns()[2], first + i );
+      CHECK( kitty::get_bit( po_values[0], i ) == ( va && !vb && vc ) );
+    }
+    ++num_blocks;
+  } );
+  CHECK( num_blocks == 1u );
+}
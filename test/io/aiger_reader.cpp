@@ -1,6 +1,9 @@
 #include <catch.hpp>
 
+#include <kitty/static_truth_table.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
 #include <mockturtle/io/aiger_reader.hpp>
+#include <mockturtle/io/write_aiger.hpp>
 #include <mockturtle/networks/aig.hpp>
 #include <mockturtle/networks/sequential.hpp>
 #include <mockturtle/views/names_view.hpp>
@@ -9,6 +12,7 @@
 
 #include <sstream>
 #include <string>
+#include <vector>
 
 using namespace mockturtle;
 
@@ -116,3 +120,82 @@ TEST_CASE( "read a sequential ASCII Aiger file into an AIG network", "[aiger_rea
   CHECK( named_aig.get_output_name( 0 ) == "foobar" );
   CHECK( named_aig.get_output_name( 1 ) == "barbar" );
 }
+
+TEST_CASE( "read a binary Aiger file into an AIG network and store input-output names", "[aiger_reader]" )
+{
+  aig_network aig;
+  names_view<aig_network> named_aig{ aig };
+
+  /* 6 = 4 & 2, 8 = 7 & 3, 10 = 9 & 6 with single-byte deltas */
+  std::string file{ "aig 5 2 0 1 3\n"
+                    "10\n" };
+  file += std::string{ 2, 2, 1, 4, 1, 3 };
+  file += "i0 foo\n"
+          "i1 bar\n"
+          "o0 foobar\n"
+          "c\n"
+          "comment\n";
+
+  std::string comment;
+  struct comment_reader : public aiger_reader<names_view<aig_network>>
+  {
+    comment_reader( names_view<aig_network>& ntk, std::string& comment )
+        : aiger_reader<names_view<aig_network>>( ntk ), _comment( comment )
+    {
+    }
+
+    void on_comment( std::string const& comment ) const override
+    {
+      _comment = comment;
+    }
+
+    std::string& _comment;
+  };
+
+  std::istringstream in( file );
+  auto const result = lorina::read_aiger( in, comment_reader( named_aig, comment ) );
+  CHECK( result == lorina::return_code::success );
+  CHECK( named_aig.num_pis() == 2 );
+  CHECK( named_aig.num_pos() == 1 );
+  CHECK( named_aig.num_gates() == 3 );
+  CHECK( comment == "comment" );
+
+  CHECK( named_aig.get_name( aig.make_signal( aig.pi_at( 0 ) ) ) == "foo" );
+  CHECK( named_aig.get_name( aig.make_signal( aig.pi_at( 1 ) ) ) == "bar" );
+  CHECK( named_aig.get_output_name( 0 ) == "foobar" );
+
+  /* a truncated AND section is a parse error */
+  aig_network truncated;
+  std::istringstream in_truncated( file.substr( 0u, 21u ) );
+  CHECK( lorina::read_aiger( in_truncated, aiger_reader( truncated ) ) == lorina::return_code::parse_error );
+}
+
+TEST_CASE( "read a binary Aiger file written by write_aiger", "[aiger_reader]" )
+{
+  aig_network aig;
+  std::vector<aig_network::signal> fs;
+  for ( auto i = 0u; i < 8u; ++i )
+  {
+    fs.push_back( aig.create_pi() );
+  }
+  for ( auto i = 0u; i < 300u; ++i )
+  {
+    auto const a = fs[( 37u * i + 3u ) % fs.size()] ^ ( i % 3u == 0u );
+    auto const b = fs[fs.size() - 1u - ( i % 7u )] ^ ( i % 2u == 0u );
+    fs.push_back( aig.create_and( a, b ) );
+  }
+  for ( auto i = 0u; i < 5u; ++i )
+  {
+    aig.create_po( fs[fs.size() - 1u - 2u * i] ^ ( i == 2u ) );
+  }
+
+  std::stringstream ss;
+  write_aiger( aig, ss );
+
+  aig_network read;
+  CHECK( lorina::read_aiger( ss, aiger_reader( read ) ) == lorina::return_code::success );
+  CHECK( read.num_pis() == aig.num_pis() );
+  CHECK( read.num_pos() == aig.num_pos() );
+  CHECK( read.num_gates() == aig.num_gates() );
+  CHECK( simulate<kitty::static_truth_table<8u>>( read ) == simulate<kitty::static_truth_table<8u>>( aig ) );
+}
@@ -0,0 +1,297 @@
+#include <catch.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/static_truth_table.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/io/snapshot.hpp>
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/block.hpp>
+#include <mockturtle/networks/klut.hpp>
+#include <mockturtle/networks/mig.hpp>
+#include <mockturtle/networks/xag.hpp>
+#include <mockturtle/networks/xmg.hpp>
+
+using namespace mockturtle;
+
+static constexpr char snapshot_file_name[] = "network.snap";
+
+template<class Ntk>
+static std::string snapshot_string( Ntk const& ntk )
+{
+  std::ostringstream os( std::ostringstream::binary );
+  CHECK( write_snapshot( ntk, os ) );
+  return os.str();
+}
+
+TEMPLATE_TEST_CASE( "write and read snapshots of networks with structural hashing", "[snapshot]", aig_network, xag_network, mig_network, xmg_network )
+{
+  TestType ntk;
+  std::vector<typename TestType::signal> fs;
+  for ( auto i = 0u; i < 6u; ++i )
+  {
+    fs.push_back( ntk.create_pi() );
+  }
+  for ( auto i = 0u; i < 100u; ++i )
+  {
+    auto const a = fs[( 7u * i + 1u ) % fs.size()] ^ ( i % 3u == 0u );
+    auto const b = fs[( 3u * i + 2u ) % fs.size()];
+    fs.push_back( i % 4u == 0u ? ntk.create_xor( a, b ) : ( i % 4u == 1u ? ntk.create_or( a, b ) : ntk.create_and( a, b ) ) );
+  }
+  for ( auto i = fs.size() - 6u; i < fs.size(); ++i )
+  {
+    ntk.create_po( fs[i] );
+  }
+
+  /* dead nodes are kept */
+  for ( auto n = 20u; n < ntk.size(); n += 9u )
+  {
+    if ( !ntk.is_dead( n ) )
+    {
+      ntk.substitute_node( n, fs[n / 3u] );
+    }
+  }
+  ntk.incr_trav_id();
+
+  CHECK( write_snapshot( ntk, snapshot_file_name ) );
+  auto const restored = read_snapshot<TestType>( snapshot_file_name );
+  REQUIRE( restored.has_value() );
+
+  auto const& ntk2 = *restored;
+  CHECK( ntk._storage->nodes == ntk2._storage->nodes );
+  CHECK( ntk._storage->inputs == ntk2._storage->inputs );
+  CHECK( ntk._storage->outputs == ntk2._storage->outputs );
+  CHECK( ntk._storage->hash == ntk2._storage->hash );
+  CHECK( ntk.trav_id() == ntk2.trav_id() );
+  CHECK( ntk.num_gates() == ntk2.num_gates() );
+  for ( auto n = 0u; n < ntk.size(); ++n )
+  {
+    CHECK( ntk.is_dead( n ) == ntk2.is_dead( n ) );
+    CHECK( ntk.fanout_size( n ) == ntk2.fanout_size( n ) );
+  }
+  CHECK( simulate<kitty::static_truth_table<6u>>( ntk ) == simulate<kitty::static_truth_table<6u>>( ntk2 ) );
+
+  /* the restored hash table behaves like the original one */
+  auto original = ntk.clone();
+  auto copy = *restored;
+  copy.foreach_gate( [&]( auto const& n ) {
+    std::vector<typename TestType::signal> children;
+    copy.foreach_fanin( n, [&]( auto const& f ) { children.push_back( f ); } );
+    CHECK( copy.clone_node( copy, n, children ) == original.clone_node( original, n, children ) );
+  } );
+  CHECK( copy.num_gates() == original.num_gates() );
+  CHECK( copy._storage->hash == original._storage->hash );
+}
+
+TEST_CASE( "write and read snapshots of k-LUT networks", "[snapshot]" )
+{
+  klut_network klut;
+  auto const a = klut.create_pi();
+  auto const b = klut.create_pi();
+  auto const c = klut.create_pi();
+
+  kitty::dynamic_truth_table maj( 3u ), ite( 3u );
+  kitty::create_majority( maj );
+  kitty::create_from_hex_string( ite, "d8" );
+  auto const f1 = klut.create_node( { a, b, c }, maj );
+  auto const f2 = klut.create_node( { f1, b, c }, ite );
+  auto const f3 = klut.create_xor( f2, a );
+  klut.create_po( f3 );
+  klut.create_po( klut.get_constant( true ) );
+
+  auto const restored = read_snapshot<klut_network>( snapshot_string( klut ).data(), snapshot_string( klut ).size() );
+  REQUIRE( restored.has_value() );
+
+  auto const& klut2 = *restored;
+  CHECK( klut._storage->nodes == klut2._storage->nodes );
+  CHECK( klut._storage->outputs == klut2._storage->outputs );
+  CHECK( klut._storage->hash == klut2._storage->hash );
+  CHECK( klut._storage->data.cache.size() == klut2._storage->data.cache.size() );
+  klut.foreach_node( [&]( auto const& n ) {
+    CHECK( klut.node_function( n ) == klut2.node_function( n ) );
+    CHECK( klut.fanout_size( n ) == klut2.fanout_size( n ) );
+  } );
+  CHECK( simulate<kitty::static_truth_table<3u>>( klut ) == simulate<kitty::static_truth_table<3u>>( klut2 ) );
+}
+
+TEST_CASE( "write and read snapshots of block networks", "[snapshot]" )
+{
+  block_network block;
+  auto const a = block.create_pi();
+  auto const b = block.create_pi();
+  auto const c = block.create_pi();
+  auto const f1 = block.create_maj( a, b, c );
+  auto const f2 = block.create_xor( f1, c );
+  block.create_po( f2 );
+  block.create_po( block.create_and( f2, !a ) );
+
+  auto const restored = read_snapshot<block_network>( snapshot_string( block ).data(), snapshot_string( block ).size() );
+  REQUIRE( restored.has_value() );
+
+  auto const& block2 = *restored;
+  CHECK( block.size() == block2.size() );
+  for ( auto i = 0u; i < block.size(); ++i )
+  {
+    auto const& n1 = block._storage->nodes[i];
+    auto const& n2 = block2._storage->nodes[i];
+    CHECK( n1.children == n2.children );
+    REQUIRE( n1.data.size() == n2.data.size() );
+    for ( auto j = 0u; j < n1.data.size(); ++j )
+    {
+      CHECK( n1.data[j].n == n2.data[j].n );
+    }
+  }
+  CHECK( block._storage->outputs == block2._storage->outputs );
+  CHECK( block._storage->data.cache.size() == block2._storage->data.cache.size() );
+  CHECK( simulate<kitty::static_truth_table<3u>>( block ) == simulate<kitty::static_truth_table<3u>>( block2 ) );
+}
+
+TEST_CASE( "reject truncated and mismatching snapshots", "[snapshot]" )
+{
+  mig_network mig;
+  auto const a = mig.create_pi();
+  auto const b = mig.create_pi();
+  auto const c = mig.create_pi();
+  mig.create_po( mig.create_maj( a, b, mig.create_and( b, c ) ) );
+
+  auto const data = snapshot_string( mig );
+  CHECK( read_snapshot<mig_network>( data.data(), data.size() ).has_value() );
+  for ( auto size = 0u; size < data.size(); ++size )
+  {
+    CHECK( !read_snapshot<mig_network>( data.data(), size ).has_value() );
+  }
+
+  /* other network types and versions */
+  CHECK( !read_snapshot<xmg_network>( data.data(), data.size() ).has_value() );
+  CHECK( !read_snapshot<aig_network>( data.data(), data.size() ).has_value() );
+  auto other_version = data;
+  other_version[8] ^= 1;
+  CHECK( !read_snapshot<mig_network>( other_version.data(), other_version.size() ).has_value() );
+
+  CHECK( !read_snapshot<mig_network>( std::string( "does_not_exist.snap" ) ).has_value() );
+}
+
+TEST_CASE( "reject snapshots with corrupt structural hash tables", "[snapshot]" )
+{
+  mig_network mig;
+  auto const a = mig.create_pi();
+  auto const b = mig.create_pi();
+  auto const c = mig.create_pi();
+  mig.create_po( mig.create_maj( a, b, mig.create_and( b, c ) ) );
+
+  /* locate the table section, which starts with the number of slots and the size */
+  std::ostringstream os( std::ostringstream::binary );
+  detail::snapshot_writer writer( os );
+  CHECK( mig._storage->hash.dump( writer ) );
+  auto const table = os.str();
+
+  auto const data = snapshot_string( mig );
+  auto const pos = data.find( table );
+  REQUIRE( pos != std::string::npos );
+
+  /* more slots than bytes left in the snapshot */
+  auto too_large = data;
+  uint64_t const num_slots = uint64_t( 1 ) << 40;
+  std::memcpy( &too_large[pos], &num_slots, sizeof( uint64_t ) );
+  CHECK( !read_snapshot<mig_network>( too_large.data(), too_large.size() ).has_value() );
+
+  /* a slot that refers to a node outside of the network */
+  auto const slots = pos + 2u * sizeof( uint64_t );
+  auto const num_slots_stored = ( table.size() - 2u * sizeof( uint64_t ) ) / sizeof( uint32_t );
+  for ( auto i = 0u; i < num_slots_stored; ++i )
+  {
+    uint32_t slot;
+    std::memcpy( &slot, &data[slots + i * sizeof( uint32_t )], sizeof( uint32_t ) );
+    if ( slot == std::numeric_limits<uint32_t>::max() )
+    {
+      continue;
+    }
+
+    auto out_of_range = data;
+    uint32_t const index = mig.size();
+    std::memcpy( &out_of_range[slots + i * sizeof( uint32_t )], &index, sizeof( uint32_t ) );
+    CHECK( !read_snapshot<mig_network>( out_of_range.data(), out_of_range.size() ).has_value() );
+    break;
+  }
+
+  /* a table without empty slots, in which probing would not terminate */
+  auto full = data;
+  uint32_t const gate = mig.size() - 1u;
+  for ( auto i = 0u; i < num_slots_stored; ++i )
+  {
+    std::memcpy( &full[slots + i * sizeof( uint32_t )], &gate, sizeof( uint32_t ) );
+  }
+  CHECK( !read_snapshot<mig_network>( full.data(), full.size() ).has_value() );
+
+  /* a single slot, a size that does not match the occupied slots, and a node stored twice */
+  auto single_slot = data;
+  uint64_t const one = 1u;
+  std::memcpy( &single_slot[pos], &one, sizeof( uint64_t ) );
+  CHECK( !read_snapshot<mig_network>( single_slot.data(), single_slot.size() ).has_value() );
+
+  uint64_t size;
+  std::memcpy( &size, &data[pos + sizeof( uint64_t )], sizeof( uint64_t ) );
+  auto wrong_size = data;
+  auto const larger = size + 1u;
+  std::memcpy( &wrong_size[pos + sizeof( uint64_t )], &larger, sizeof( uint64_t ) );
+  CHECK( !read_snapshot<mig_network>( wrong_size.data(), wrong_size.size() ).has_value() );
+
+  for ( auto i = 0u; i < num_slots_stored; ++i )
+  {
+    uint32_t slot;
+    std::memcpy( &slot, &data[slots + i * sizeof( uint32_t )], sizeof( uint32_t ) );
+    if ( slot != std::numeric_limits<uint32_t>::max() )
+    {
+      continue;
+    }
+
+    auto duplicate = wrong_size;
+    std::memcpy( &duplicate[slots + i * sizeof( uint32_t )], &gate, sizeof( uint32_t ) );
+    CHECK( !read_snapshot<mig_network>( duplicate.data(), duplicate.size() ).has_value() );
+    break;
+  }
+}
+
+TEST_CASE( "reject snapshots with fanins, inputs, or outputs outside of the network", "[snapshot]" )
+{
+  auto const make_mig = []() {
+    mig_network mig;
+    auto const a = mig.create_pi();
+    auto const b = mig.create_pi();
+    auto const c = mig.create_pi();
+    mig.create_po( mig.create_maj( a, b, mig.create_and( b, c ) ) );
+    return mig;
+  };
+
+  auto const valid = make_mig();
+  auto const data = snapshot_string( valid );
+  CHECK( read_snapshot<mig_network>( data.data(), data.size() ).has_value() );
+
+  auto fanin = make_mig();
+  fanin._storage->nodes.back().children[1].index = fanin.size();
+  auto const fanin_data = snapshot_string( fanin );
+  CHECK( !read_snapshot<mig_network>( fanin_data.data(), fanin_data.size() ).has_value() );
+
+  auto input = make_mig();
+  input._storage->inputs[2] = input.size() + 5u;
+  auto const input_data = snapshot_string( input );
+  CHECK( !read_snapshot<mig_network>( input_data.data(), input_data.size() ).has_value() );
+
+  auto output = make_mig();
+  output._storage->outputs[0].index = output.size();
+  auto const output_data = snapshot_string( output );
+  CHECK( !read_snapshot<mig_network>( output_data.data(), output_data.size() ).has_value() );
+
+  klut_network klut;
+  klut.create_po( klut.create_and( klut.create_pi(), klut.create_pi() ) );
+  klut._storage->nodes.back().children[0].index = klut.size();
+  auto const klut_data = snapshot_string( klut );
+  CHECK( !read_snapshot<klut_network>( klut_data.data(), klut_data.size() ).has_value() );
+}
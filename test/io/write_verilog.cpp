@@ -12,6 +12,7 @@
 #include <mockturtle/networks/buffered.hpp>
 #include <mockturtle/networks/crossed.hpp>
 #include <mockturtle/networks/klut.hpp>
+#include <mockturtle/networks/maj5.hpp>
 #include <mockturtle/networks/mig.hpp>
 #include <mockturtle/networks/muxig.hpp>
 #include <mockturtle/utils/standard_cell.hpp>
@@ -99,6 +100,37 @@ TEST_CASE( "write MIG into Verilog file", "[write_verilog]" )
                       "endmodule\n" );
 }
 
+TEST_CASE( "write MAJ5 network into Verilog file", "[write_verilog]" )
+{
+  maj5_network ntk;
+
+  const auto a = ntk.create_pi();
+  const auto b = ntk.create_pi();
+  const auto c = ntk.create_pi();
+  const auto d = ntk.create_pi();
+  const auto e = ntk.create_pi();
+
+  const auto f1 = ntk.create_and( a, b );
+  const auto f2 = ntk.create_maj( c, d, !e );
+  const auto f3 = ntk.create_maj5( f1, f2, a, !c, e );
+  ntk.create_po( f3 );
+
+  std::ostringstream out;
+  write_verilog( ntk, out );
+
+  CHECK( out.str() == "module top( x0 , x1 , x2 , x3 , x4 , y0 );\n"
+                      "  input x0 , x1 , x2 , x3 , x4 ;\n"
+                      "  output y0 ;\n"
+                      "  wire n6 , n7 , n8 ;\n"
+                      "  assign n6 = x0 & x1 ;\n"
+                      "  assign n7 = ( x2 & x3 ) | ( x2 & ~x4 ) | ( x3 & ~x4 ) ;\n"
+                      "  assign n8 = ( x0 & ~x2 & x4 ) | ( x0 & ~x2 & n6 ) | ( x0 & ~x2 & n7 ) | "
+                      "( x0 & x4 & n6 ) | ( x0 & x4 & n7 ) | ( x0 & n6 & n7 ) | ( ~x2 & x4 & n6 ) | "
+                      "( ~x2 & x4 & n7 ) | ( ~x2 & n6 & n7 ) | ( x4 & n6 & n7 ) ;\n"
+                      "  assign y0 = n8 ;\n"
+                      "endmodule\n" );
+}
+
 TEST_CASE( "write MuxIG into Verilog file", "[write_verilog]" )
 {
   muxig_network ntk;
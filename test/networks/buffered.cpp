@@ -86,3 +86,60 @@ TEST_CASE( "is_buffered_network_type", "[buffered]" )
   CHECK( !is_buffered_network_type_v<klut_network> );
   CHECK( !is_buffered_network_type_v<aqfp_network> );
 }
+
+template<class Ntk>
+std::vector<std::vector<uint64_t>> indexed_fanouts( Ntk const& ntk )
+{
+  std::vector<std::vector<uint64_t>> fanouts( ntk.size() );
+  for ( auto n = 0u; n < ntk.size(); ++n )
+  {
+    ntk._storage->fanouts.foreach_fanout( n, [&]( auto const& f ) {
+      fanouts[n].push_back( f );
+    } );
+  }
+  return fanouts;
+}
+
+TEST_CASE( "fanout index in buffered networks", "[buffered]" )
+{
+  buffered_aig_network aig;
+  aig.build_fanout_index();
+  auto const a = aig.create_pi();
+  auto const b = aig.create_pi();
+  auto const buf = aig.create_buf( a );
+  auto const g = aig.create_and( buf, b );
+  CHECK( indexed_fanouts( aig )[aig.get_node( a )] == std::vector<uint64_t>{ aig.get_node( buf ) } );
+  CHECK( indexed_fanouts( aig )[aig.get_node( buf )] == std::vector<uint64_t>{ aig.get_node( g ) } );
+
+  buffered_mig_network ntk;
+  ntk.build_fanout_index();
+
+  auto x1 = ntk.create_pi();
+  auto x2 = ntk.create_pi();
+  auto x3 = ntk.create_pi();
+  auto b1 = ntk.create_buf( x1 );
+  auto g1 = ntk.create_maj( b1, x2, x3 );
+  auto b2 = ntk.create_buf( g1 );
+  auto b3 = ntk.create_buf( b2 );
+  auto g2 = ntk.create_maj( b1, b2, x3 );
+  ntk.create_po( b3 );
+  ntk.create_po( g2 );
+
+  /* buffers are registered as fanouts of their fanin */
+  auto fanouts = indexed_fanouts( ntk );
+  CHECK( fanouts[ntk.get_node( b1 )] == std::vector<uint64_t>{ ntk.get_node( g1 ), ntk.get_node( g2 ) } );
+  CHECK( fanouts[ntk.get_node( b2 )] == std::vector<uint64_t>{ ntk.get_node( b3 ), ntk.get_node( g2 ) } );
+
+  /* bypass b2 and remove it */
+  ntk.replace_in_node( ntk.get_node( b3 ), ntk.get_node( b2 ), g1 );
+  ntk.replace_in_node( ntk.get_node( g2 ), ntk.get_node( b2 ), g1 );
+  ntk.take_out_node( ntk.get_node( b2 ) );
+
+  fanouts = indexed_fanouts( ntk );
+  CHECK( fanouts[ntk.get_node( b2 )].empty() );
+  CHECK( fanouts[ntk.get_node( g1 )] == std::vector<uint64_t>{ ntk.get_node( b3 ), ntk.get_node( g2 ) } );
+
+  /* the maintained index equals a freshly built one */
+  ntk.build_fanout_index();
+  CHECK( indexed_fanouts( ntk ) == fanouts );
+}
@@ -0,0 +1,144 @@
+#include <catch.hpp>
+
+#include <set>
+#include <vector>
+
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/events.hpp>
+#include <mockturtle/views/depth_view.hpp>
+#include <mockturtle/views/fanout_view.hpp>
+
+using namespace mockturtle;
+
+TEST_CASE( "deliver and release network events", "[events]" )
+{
+  aig_network aig;
+  std::vector<aig_network::node> added, modified, deleted;
+
+  auto add = aig.events().register_add_event( [&]( auto const& n ) { added.push_back( n ); } );
+  auto mod = aig.events().register_modified_event( [&]( auto const& n, auto const& ) { modified.push_back( n ); } );
+  auto del = aig.events().register_delete_event( [&]( auto const& n ) { deleted.push_back( n ); } );
+
+  auto const a = aig.create_pi();
+  auto const b = aig.create_pi();
+  auto const c = aig.create_pi();
+  auto const f1 = aig.create_and( a, b );
+  auto const f2 = aig.create_and( f1, c );
+  aig.create_po( f2 );
+  CHECK( added == std::vector<aig_network::node>{ aig.get_node( f1 ), aig.get_node( f2 ) } );
+
+  aig.substitute_node( aig.get_node( f1 ), b );
+  CHECK( modified == std::vector<aig_network::node>{ aig.get_node( f2 ) } );
+  CHECK( deleted == std::vector<aig_network::node>{ aig.get_node( f1 ) } );
+
+  aig.events().release_add_event( add );
+  aig.events().release_modified_event( mod );
+  aig.events().release_delete_event( del );
+  CHECK( aig.events().on_add.empty() );
+  CHECK( aig.events().on_modified.empty() );
+  CHECK( aig.events().on_delete.empty() );
+
+  aig.create_and( a, c );
+  CHECK( added.size() == 2u );
+}
+
+TEST_CASE( "deliver the net effect of batched events", "[events]" )
+{
+  aig_network aig;
+  auto const a = aig.create_pi();
+  auto const b = aig.create_pi();
+  auto const c = aig.create_pi();
+  auto const f1 = aig.create_and( a, b );
+  auto const f2 = aig.create_and( f1, c );
+  auto const f3 = aig.create_and( f2, a );
+  aig.create_po( f3 );
+
+  std::vector<aig_network::node> added, deleted;
+  std::vector<std::pair<aig_network::node, std::vector<aig_network::signal>>> modified;
+  auto add = aig.events().register_add_event( [&]( auto const& n ) { added.push_back( n ); } );
+  auto mod = aig.events().register_modified_event( [&]( auto const& n, auto const& previous ) { modified.emplace_back( n, previous ); } );
+  auto del = aig.events().register_delete_event( [&]( auto const& n ) { deleted.push_back( n ); } );
+
+  aig.events().begin_batch();
+  CHECK( aig.events().in_batch() );
+
+  /* modify f3 twice, add a gate that stays, and one that is removed again */
+  auto const g1 = aig.create_and( b, c );
+  auto const g2 = aig.create_and( !a, c );
+  aig.substitute_node( aig.get_node( f2 ), g2 );
+  aig.substitute_node( aig.get_node( g2 ), g1 );
+  CHECK( added.empty() );
+  CHECK( modified.empty() );
+  CHECK( deleted.empty() );
+
+  aig.events().commit_batch();
+  CHECK( !aig.events().in_batch() );
+
+  CHECK( added == std::vector<aig_network::node>{ aig.get_node( g1 ) } );
+  REQUIRE( modified.size() == 1u );
+  CHECK( modified[0].first == aig.get_node( f3 ) );
+  CHECK( modified[0].second == std::vector<aig_network::signal>{ a, f2 } );
+  CHECK( std::set<aig_network::node>( deleted.begin(), deleted.end() ) == std::set<aig_network::node>{ aig.get_node( f1 ), aig.get_node( f2 ) } );
+
+  aig.events().release_add_event( add );
+  aig.events().release_modified_event( mod );
+  aig.events().release_delete_event( del );
+}
+
+TEST_CASE( "update views once per batch", "[events]" )
+{
+  aig_network aig;
+  std::vector<aig_network::signal> fs;
+  for ( auto i = 0u; i < 8u; ++i )
+  {
+    fs.push_back( aig.create_pi() );
+  }
+  for ( auto i = 0u; i < 200u; ++i )
+  {
+    auto const a = fs[( 13u * i + 5u ) % fs.size()] ^ ( i % 3u == 0u );
+    auto const b = fs[fs.size() - 1u - ( i % 5u )] ^ ( i % 2u == 0u );
+    fs.push_back( aig.create_and( a, b ) );
+  }
+  for ( auto i = 0u; i < 8u; ++i )
+  {
+    aig.create_po( fs[fs.size() - 1u - 3u * i] );
+  }
+
+  depth_view_params ps;
+  ps.incremental = true;
+  fanout_view<aig_network> fntk{ aig };
+  depth_view<fanout_view<aig_network>> dntk{ fntk, {}, ps };
+
+  /* views are only updated at commit, so the network is modified directly */
+  aig.events().begin_batch();
+  for ( auto n = 30u; n < aig.size(); n += 11u )
+  {
+    if ( aig.is_dead( n ) )
+      continue;
+    auto const s = n % 2u == 0u ? fs[n / 3u] : !fs[n - 9u];
+    if ( aig.get_node( s ) == n || aig.is_dead( aig.get_node( s ) ) )
+      continue;
+    aig.substitute_node( n, s );
+  }
+  aig.create_po( aig.create_and( fs[20], fs.back() ) );
+  aig.events().commit_batch();
+
+  fanout_view<aig_network> fanouts{ aig };
+  aig.foreach_node( [&]( auto const& n ) {
+    if ( aig.is_dead( n ) )
+      return;
+    std::multiset<aig_network::node> incremental, computed;
+    fntk.foreach_fanout( n, [&]( auto const& p ) { incremental.insert( p ); } );
+    fanouts.foreach_fanout( n, [&]( auto const& p ) { computed.insert( p ); } );
+    CHECK( incremental == computed );
+  } );
+
+  depth_view<aig_network> levels{ aig };
+  CHECK( dntk.depth() == levels.depth() );
+  aig.foreach_gate( [&]( auto const& n ) {
+    if ( aig.visited( n ) == aig.trav_id() )
+    {
+      CHECK( dntk.level( n ) == levels.level( n ) );
+    }
+  } );
+}
@@ -0,0 +1,320 @@
+#include <catch.hpp>
+
+#include <random>
+#include <vector>
+
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/operations.hpp>
+#include <kitty/operators.hpp>
+#include <kitty/static_truth_table.hpp>
+#include <mockturtle/algorithms/cleanup.hpp>
+#include <mockturtle/algorithms/cut_enumeration.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/networks/maj5.hpp>
+#include <mockturtle/traits.hpp>
+#include <mockturtle/views/depth_view.hpp>
+
+using namespace mockturtle;
+
+namespace
+{
+
+template<typename TT>
+TT maj5_tt( TT const& a, TT const& b, TT const& c, TT const& d, TT const& e )
+{
+  return ( a & b & c ) | ( kitty::ternary_majority( a, b, c ) & ( d | e ) ) | ( ( a | b | c ) & d & e );
+}
+
+} // namespace
+
+TEST_CASE( "create and use constants and primary inputs in a MAJ5 network", "[maj5]" )
+{
+  maj5_network maj5;
+
+  CHECK( maj5.size() == 1 );
+  CHECK( has_get_constant_v<maj5_network> );
+  CHECK( has_create_pi_v<maj5_network> );
+  CHECK( has_create_maj_v<maj5_network> );
+  CHECK( has_is_maj5_v<maj5_network> );
+
+  const auto c0 = maj5.get_constant( false );
+  const auto c1 = maj5.get_constant( true );
+  CHECK( maj5.is_constant( maj5.get_node( c0 ) ) );
+  CHECK( c0 == !c1 );
+
+  const auto a = maj5.create_pi();
+  const auto b = maj5.create_pi();
+
+  CHECK( maj5.size() == 3 );
+  CHECK( maj5.num_pis() == 2 );
+  CHECK( maj5.num_gates() == 0 );
+  CHECK( maj5.is_pi( maj5.get_node( a ) ) );
+  CHECK( maj5.pi_index( maj5.get_node( b ) ) == 1 );
+  CHECK( maj5.fanin_size( maj5.get_node( a ) ) == 0 );
+}
+
+TEST_CASE( "trivial cases of majority-5 gates in a MAJ5 network", "[maj5]" )
+{
+  maj5_network maj5;
+
+  const auto c0 = maj5.get_constant( false );
+  const auto a = maj5.create_pi();
+  const auto b = maj5.create_pi();
+  const auto c = maj5.create_pi();
+  const auto d = maj5.create_pi();
+
+  /* a value that appears three times wins */
+  CHECK( maj5.create_maj5( a, b, a, c, a ) == a );
+  CHECK( maj5.create_maj5( !b, c, !b, d, !b ) == !b );
+  CHECK( maj5.create_maj5( c0, a, c0, b, c0 ) == c0 );
+
+  /* complementary pairs cancel out */
+  CHECK( maj5.create_maj5( a, !a, b, !b, c ) == c );
+  CHECK( maj5.create_maj5( a, !a, b, b, c ) == b );
+  CHECK( maj5.create_maj5( a, !a, !b, c, !b ) == !b );
+  CHECK( maj5.create_maj5( a, a, !a, !a, d ) == d );
+  CHECK( maj5.create_maj5( a, a, !a, b, b ) == b );
+  CHECK( maj5.num_gates() == 0 );
+
+  /* the remaining 3-input majority is shared with create_maj */
+  const auto m1 = maj5.create_maj5( a, b, !a, c, d );
+  CHECK( maj5.num_gates() == 1 );
+  CHECK( maj5.create_maj( b, c, d ) == m1 );
+  CHECK( maj5.create_maj5( d, !a, a, !b, c ) == maj5.create_maj( c, d, !b ) );
+  CHECK( maj5.num_gates() == 2 );
+
+  /* AND and OR are majorities with constants */
+  const auto f_and = maj5.create_and( a, b );
+  CHECK( maj5.create_maj5( c0, c0, !c0, a, b ) == f_and );
+  CHECK( maj5.create_or( !a, !b ) == !f_and );
+  CHECK( maj5.num_gates() == 3 );
+}
+
+TEST_CASE( "hash nodes and normalize complements in a MAJ5 network", "[maj5]" )
+{
+  maj5_network maj5;
+
+  const auto a = maj5.create_pi();
+  const auto b = maj5.create_pi();
+  const auto c = maj5.create_pi();
+  const auto d = maj5.create_pi();
+  const auto e = maj5.create_pi();
+
+  const auto f = maj5.create_maj5( a, b, c, d, e );
+  CHECK( maj5.size() == 7 );
+  CHECK( maj5.num_gates() == 1 );
+  CHECK( maj5.fanin_size( maj5.get_node( f ) ) == 5 );
+  CHECK( maj5.is_maj5( maj5.get_node( f ) ) );
+  CHECK( !maj5.is_maj( maj5.get_node( f ) ) );
+
+  /* fanin order does not matter */
+  CHECK( maj5.create_maj5( e, c, a, d, b ) == f );
+
+  /* self-duality: at most two complemented fanins are stored */
+  CHECK( maj5.create_maj5( !a, !b, !c, !d, !e ) == !f );
+  const auto g = maj5.create_maj5( !a, !b, !c, d, e );
+  CHECK( maj5.is_complemented( g ) );
+  CHECK( maj5.create_maj5( a, b, c, !d, !e ) == !g );
+  CHECK( maj5.num_gates() == 2 );
+
+  uint32_t num_complemented = 0u;
+  maj5.foreach_fanin( maj5.get_node( g ), [&]( auto const& s ) {
+    num_complemented += maj5.is_complemented( s ) ? 1u : 0u;
+  } );
+  CHECK( num_complemented == 2u );
+
+  CHECK( maj5.has_maj5( b, a, c, d, e ) == f );
+  CHECK( maj5.has_maj5( a, b, c, !d, !e ) == !g );
+  CHECK( !maj5.has_maj5( a, b, c, d, !e ).has_value() );
+  CHECK( !maj5.has_maj( a, b, c ).has_value() );
+  CHECK( maj5.num_gates() == 2 );
+}
+
+TEST_CASE( "clone a node in a MAJ5 network", "[maj5]" )
+{
+  maj5_network maj5_1, maj5_2;
+
+  CHECK( has_clone_node_v<maj5_network> );
+
+  std::vector<maj5_network::signal> pis1, pis2;
+  for ( auto i = 0u; i < 5u; ++i )
+  {
+    pis1.push_back( maj5_1.create_pi() );
+    pis2.push_back( maj5_2.create_pi() );
+  }
+  const auto f1 = maj5_1.create_maj5( pis1[0], !pis1[1], pis1[2], pis1[3], pis1[4] );
+  maj5_1.create_po( f1 );
+  CHECK( maj5_2.size() == 6 );
+
+  const auto f2 = maj5_2.clone_node( maj5_1, maj5_1.get_node( f1 ), { pis2[0], !pis2[1], pis2[2], pis2[3], pis2[4] } );
+  CHECK( maj5_2.size() == 7 );
+  CHECK( f2 == maj5_2.create_maj5( pis2[4], pis2[3], pis2[2], !pis2[1], pis2[0] ) );
+
+  maj5_2.create_po( f2 );
+  const auto cleaned = cleanup_dangling( maj5_2 );
+  CHECK( cleaned.num_gates() == 1 );
+}
+
+TEST_CASE( "compute values in MAJ5 networks", "[maj5]" )
+{
+  maj5_network maj5;
+
+  const auto a = maj5.create_pi();
+  const auto b = maj5.create_pi();
+  const auto c = maj5.create_pi();
+  const auto d = maj5.create_pi();
+  const auto e = maj5.create_pi();
+
+  const auto f1 = maj5.create_maj5( a, !b, c, d, e );
+  const auto f2 = maj5.create_maj5( !a, !b, !c, d, !e );
+  maj5.create_po( f1 );
+  maj5.create_po( f2 );
+
+  {
+    std::vector<bool> values{ { true, true, false, true, false } };
+    CHECK( maj5.compute( maj5.get_node( f1 ), values.begin(), values.end() ) == false );
+    values[4] = true;
+    CHECK( maj5.compute( maj5.get_node( f1 ), values.begin(), values.end() ) == true );
+  }
+
+  {
+    std::vector<kitty::static_truth_table<5>> xs( 5 );
+    for ( auto i = 0u; i < 5u; ++i )
+    {
+      kitty::create_nth_var( xs[i], i );
+    }
+
+    CHECK( maj5.compute( maj5.get_node( f1 ), xs.begin(), xs.end() ) == maj5_tt( xs[0], ~xs[1], xs[2], xs[3], xs[4] ) );
+    CHECK( maj5.node_function( maj5.get_node( f1 ) )._bits[0] == maj5_tt( xs[0], xs[1], xs[2], xs[3], xs[4] )._bits );
+
+    const auto tts = simulate<kitty::static_truth_table<5>>( maj5, default_simulator<kitty::static_truth_table<5>>() );
+    CHECK( tts[0] == maj5_tt( xs[0], ~xs[1], xs[2], xs[3], xs[4] ) );
+    CHECK( tts[1] == maj5_tt( ~xs[0], ~xs[1], ~xs[2], xs[3], ~xs[4] ) );
+  }
+
+  {
+    std::vector<kitty::partial_truth_table> xs( 5, kitty::partial_truth_table( 64 ) );
+    for ( auto i = 0u; i < 5u; ++i )
+    {
+      kitty::create_random( xs[i], i );
+    }
+
+    kitty::partial_truth_table result( 0 );
+    maj5.compute( maj5.get_node( f1 ), result, xs.begin(), xs.end() );
+    CHECK( result == maj5.compute( maj5.get_node( f1 ), xs.begin(), xs.end() ) );
+  }
+}
+
+TEST_CASE( "simulate random MAJ5 networks", "[maj5]" )
+{
+  std::mt19937 rng( 1 );
+
+  for ( auto round = 0u; round < 20u; ++round )
+  {
+    maj5_network maj5;
+
+    std::vector<maj5_network::signal> fs{ maj5.get_constant( false ) };
+    std::vector<kitty::static_truth_table<6>> tts( 1 );
+    for ( auto i = 0u; i < 6u; ++i )
+    {
+      fs.push_back( maj5.create_pi() );
+      tts.emplace_back();
+      kitty::create_nth_var( tts.back(), i );
+    }
+
+    /* small fanin pools make duplicates and complementary pairs likely */
+    for ( auto i = 0u; i < 50u; ++i )
+    {
+      std::array<maj5_network::signal, 5> children;
+      std::array<kitty::static_truth_table<6>, 5> values;
+      for ( auto j = 0u; j < 5u; ++j )
+      {
+        const auto k = rng() % std::min<size_t>( fs.size(), 4u + i / 4u );
+        const bool complement = rng() % 2;
+        children[j] = fs[fs.size() - 1u - k] ^ complement;
+        values[j] = complement ? ~tts[tts.size() - 1u - k] : tts[tts.size() - 1u - k];
+      }
+      fs.push_back( maj5.create_maj5( children[0], children[1], children[2], children[3], children[4] ) );
+      tts.push_back( maj5_tt( values[0], values[1], values[2], values[3], values[4] ) );
+      maj5.create_po( fs.back() );
+    }
+
+    const auto sim = simulate<kitty::static_truth_table<6>>( maj5, default_simulator<kitty::static_truth_table<6>>() );
+    for ( auto i = 0u; i < sim.size(); ++i )
+    {
+      CHECK( sim[i] == tts[tts.size() - sim.size() + i] );
+    }
+  }
+}
+
+TEST_CASE( "enumerate cuts and compute depth in a MAJ5 network", "[maj5]" )
+{
+  maj5_network maj5;
+
+  const auto a = maj5.create_pi();
+  const auto b = maj5.create_pi();
+  const auto c = maj5.create_pi();
+  const auto d = maj5.create_pi();
+  const auto e = maj5.create_pi();
+
+  const auto f1 = maj5.create_maj5( a, b, c, d, e );
+  const auto f2 = maj5.create_and( f1, !a );
+  maj5.create_po( f2 );
+
+  cut_enumeration_params ps;
+  ps.cut_size = 5;
+  const auto cuts = cut_enumeration<maj5_network, true>( maj5, ps );
+
+  /* the cut on all inputs implements AND( MAJ5( a, b, c, d, e ), !a ) */
+  std::vector<kitty::dynamic_truth_table> xs( 5, kitty::dynamic_truth_table( 5 ) );
+  for ( auto i = 0u; i < 5u; ++i )
+  {
+    kitty::create_nth_var( xs[i], i );
+  }
+  const auto expected = maj5_tt( xs[0], xs[1], xs[2], xs[3], xs[4] ) & ~xs[0];
+
+  bool found = false;
+  for ( auto const& cut : cuts.cuts( maj5.node_to_index( maj5.get_node( f2 ) ) ) )
+  {
+    if ( cut->size() == 5u )
+    {
+      CHECK( cuts.truth_table( *cut ) == ( maj5.is_complemented( f2 ) ? ~expected : expected ) );
+      found = true;
+    }
+  }
+  CHECK( found );
+
+  depth_view depth_maj5{ maj5 };
+  CHECK( depth_maj5.depth() == 2u );
+  CHECK( depth_maj5.level( maj5.get_node( f1 ) ) == 1u );
+}
+
+TEST_CASE( "substitute nodes in a MAJ5 network", "[maj5]" )
+{
+  maj5_network maj5;
+
+  const auto a = maj5.create_pi();
+  const auto b = maj5.create_pi();
+  const auto c = maj5.create_pi();
+  const auto d = maj5.create_pi();
+
+  const auto f1 = maj5.create_and( a, b );
+  const auto f2 = maj5.create_maj5( f1, a, c, d, !b );
+  maj5.create_po( f2 );
+  CHECK( maj5.num_gates() == 2 );
+
+  /* replacing f1 by !a creates the pair ( a, !a ) in f2 */
+  maj5.substitute_node( maj5.get_node( f1 ), !a );
+  CHECK( maj5.is_dead( maj5.get_node( f1 ) ) );
+  CHECK( maj5.fanout_size( maj5.get_node( f2 ) ) == 1u );
+
+  const auto tts = simulate<kitty::static_truth_table<4>>( maj5, default_simulator<kitty::static_truth_table<4>>() );
+  std::vector<kitty::static_truth_table<4>> xs( 4 );
+  for ( auto i = 0u; i < 4u; ++i )
+  {
+    kitty::create_nth_var( xs[i], i );
+  }
+  CHECK( tts[0] == kitty::ternary_majority( xs[2], xs[3], ~xs[1] ) );
+  CHECK( maj5.has_maj( c, d, !b ).has_value() );
+}
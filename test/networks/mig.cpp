@@ -915,3 +915,77 @@ TEST_CASE( "substitute node without re-strashing case 3 in mig_network", "[mig]"
   CHECK( mig.num_gates() == 2 );
   CHECK( simulate<kitty::static_truth_table<3u>>( mig )[0]._bits == 0x80 );
 }
+
+TEST_CASE( "substitute nodes with fanout index in mig_network", "[mig]" )
+{
+  auto const build = []( mig_network& mig ) {
+    std::vector<mig_network::signal> fs;
+    for ( auto i = 0u; i < 6u; ++i )
+    {
+      fs.push_back( mig.create_pi() );
+    }
+    for ( auto i = 0u; i < 60u; ++i )
+    {
+      fs.push_back( mig.create_maj( fs[( 7u * i + 1u ) % fs.size()] ^ ( i % 3u == 0u ), fs[( 3u * i + 2u ) % fs.size()], fs[( 5u * i + 3u ) % fs.size()] ^ ( i % 2u == 0u ) ) );
+    }
+    for ( auto i = fs.size() - 8u; i < fs.size(); ++i )
+    {
+      mig.create_po( fs[i] );
+    }
+  };
+
+  mig_network scan, indexed;
+  build( scan );
+  indexed.build_fanout_index();
+  build( indexed );
+  CHECK( !scan.has_fanout_index() );
+  CHECK( indexed.has_fanout_index() );
+
+  for ( auto n = 12u; n < scan.size(); n += 5u )
+  {
+    if ( scan.is_dead( n ) )
+      continue;
+    auto const s = mig_network::signal( n / 3u, n & 1u );
+    if ( n % 2u == 0u )
+    {
+      scan.substitute_node( n, s );
+      indexed.substitute_node( n, s );
+    }
+    else
+    {
+      scan.substitute_node_no_restrash( n, s );
+      indexed.substitute_node_no_restrash( n, s );
+    }
+  }
+
+  /* same structure as without index */
+  REQUIRE( scan.size() == indexed.size() );
+  for ( auto n = 0u; n < scan.size(); ++n )
+  {
+    CHECK( scan.is_dead( n ) == indexed.is_dead( n ) );
+    CHECK( scan.fanout_size( n ) == indexed.fanout_size( n ) );
+    CHECK( scan._storage->nodes[n].children == indexed._storage->nodes[n].children );
+  }
+  scan.foreach_po( [&]( auto const& f, auto i ) {
+    CHECK( f == indexed.po_at( i ) );
+  } );
+
+  /* the maintained index equals a freshly built one */
+  auto const collect = [&]() {
+    std::vector<std::vector<uint64_t>> fanouts( indexed.size() );
+    for ( auto n = 0u; n < indexed.size(); ++n )
+    {
+      indexed._storage->fanouts.foreach_fanout( n, [&]( auto const& f ) {
+        fanouts[n].push_back( f );
+      } );
+      CHECK( std::is_sorted( fanouts[n].begin(), fanouts[n].end() ) );
+    }
+    return fanouts;
+  };
+  auto const maintained = collect();
+  indexed.build_fanout_index();
+  CHECK( collect() == maintained );
+
+  indexed.clear_fanout_index();
+  CHECK( !indexed.has_fanout_index() );
+}
@@ -0,0 +1,297 @@
+#include <catch.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <kitty/static_truth_table.hpp>
+#include <mockturtle/algorithms/cleanup.hpp>
+#include <mockturtle/algorithms/cut_enumeration.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/mig.hpp>
+#include <mockturtle/networks/storage.hpp>
+#include <mockturtle/networks/xag.hpp>
+#include <mockturtle/traits.hpp>
+#include <mockturtle/utils/algorithm.hpp>
+#include <mockturtle/utils/node_map.hpp>
+#include <mockturtle/views/depth_view.hpp>
+
+using namespace mockturtle;
+
+TEST_CASE( "insert, find, and erase nodes in a strash table", "[storage]" )
+{
+  using node_t = regular_node<2, 2, 1>;
+
+  std::vector<node_t> nodes( 1 );
+  strash_table<node_t> table( nodes );
+  CHECK( table.size() == 0u );
+  CHECK( table.find( nodes[0] ) == table.end() );
+
+  /* enough nodes to grow the table several times */
+  for ( auto i = 1u; i <= 1000u; ++i )
+  {
+    auto& n = nodes.emplace_back();
+    n.children[0] = node_t::pointer_type( i / 7u, i & 1u );
+    n.children[1] = node_t::pointer_type( i, 0u );
+  }
+  table.bind( nodes );
+  for ( auto i = 1u; i <= 1000u; ++i )
+  {
+    table[nodes[i]] = i;
+  }
+  CHECK( table.size() == 1000u );
+
+  for ( auto i = 1u; i <= 1000u; ++i )
+  {
+    auto const it = table.find( nodes[i] );
+    REQUIRE( it != table.end() );
+    CHECK( it->second == i );
+    CHECK( static_cast<uint64_t>( table[nodes[i]] ) == i );
+  }
+
+  /* a node equal to a stored one is found without being in the node vector */
+  node_t probe;
+  probe.children = nodes[42].children;
+  CHECK( table.find( probe )->second == 42u );
+
+  /* assigning to an existing key replaces the index */
+  nodes.push_back( nodes[42] );
+  table[nodes.back()] = nodes.size() - 1u;
+  CHECK( table.size() == 1000u );
+  CHECK( table.find( probe )->second == nodes.size() - 1u );
+  table[nodes[42]] = 42u;
+
+  /* erase every third node, the others remain reachable */
+  for ( auto i = 3u; i <= 1000u; i += 3u )
+  {
+    CHECK( table.erase( nodes[i] ) == 1u );
+  }
+  CHECK( table.erase( nodes[3] ) == 0u );
+  CHECK( table.size() == 1000u - 333u );
+  for ( auto i = 1u; i <= 1000u; ++i )
+  {
+    CHECK( ( table.find( nodes[i] ) != table.end() ) == ( i % 3u != 0u ) );
+  }
+
+  table.clear();
+  CHECK( table.size() == 0u );
+  CHECK( table.find( nodes[1] ) == table.end() );
+
+  /* node indexes must fit into 32 bits, also in release builds */
+  CHECK_THROWS_AS( table.insert_or_assign( nodes[1], std::numeric_limits<uint32_t>::max() ), std::length_error );
+  CHECK( table.size() == 0u );
+}
+
+TEST_CASE( "strash table of a cloned network refers to its own nodes", "[storage]" )
+{
+  aig_network aig;
+  auto const a = aig.create_pi();
+  auto const b = aig.create_pi();
+  auto const c = aig.create_pi();
+  auto const f1 = aig.create_and( a, b );
+  auto const f2 = aig.create_and( f1, c );
+  aig.create_po( f2 );
+
+  auto copy = aig.clone();
+  CHECK( copy.num_gates() == 2u );
+  CHECK( copy.create_and( a, b ) == f1 );
+
+  /* changing the original leaves the strash table of the copy intact */
+  aig.substitute_node( aig.get_node( f1 ), a );
+  CHECK( aig.num_gates() == 1u );
+  CHECK( copy.num_gates() == 2u );
+  CHECK( copy.create_and( f1, c ) == f2 );
+  CHECK( copy.create_and( b, a ) == f1 );
+
+  aig_storage assigned;
+  assigned = *copy._storage;
+  aig_network other{ std::make_shared<aig_storage>( assigned ) };
+  CHECK( other.create_and( a, b ) == f1 );
+  CHECK( other.num_gates() == 2u );
+
+  /* moved storages rebind the strash table to their own nodes */
+  aig_storage moved( std::move( assigned ) );
+  assigned = aig_storage();
+  CHECK( moved.hash.find( moved.nodes[aig.get_node( f2 )] ) != moved.hash.end() );
+  aig_storage move_assigned;
+  move_assigned = std::move( moved );
+  moved = aig_storage();
+  aig_network from_moved{ std::make_shared<aig_storage>( std::move( move_assigned ) ) };
+  CHECK( from_moved.create_and( a, b ) == f1 );
+  CHECK( from_moved.create_and( f1, c ) == f2 );
+  CHECK( from_moved.num_gates() == 2u );
+}
+
+TEMPLATE_TEST_CASE( "networks with structure-of-arrays storage match array-of-nodes networks", "[storage]", ( std::pair<aig_network, aig_soa_network> ), ( std::pair<xag_network, xag_soa_network> ), ( std::pair<mig_network, mig_soa_network> ) )
+{
+  using aos_ntk = typename TestType::first_type;
+  using soa_ntk = typename TestType::second_type;
+
+  CHECK( is_network_type_v<soa_ntk> );
+  CHECK( has_substitute_node_v<soa_ntk> );
+
+  auto const build = []( auto& ntk ) {
+    std::vector<typename std::decay_t<decltype( ntk )>::signal> fs;
+    for ( auto i = 0u; i < 6u; ++i )
+    {
+      fs.push_back( ntk.create_pi() );
+    }
+    for ( auto i = 0u; i < 80u; ++i )
+    {
+      auto const a = fs[( 7u * i + 1u ) % fs.size()] ^ ( i % 3u == 0u );
+      auto const b = fs[( 3u * i + 2u ) % fs.size()];
+      fs.push_back( i % 4u == 0u ? ntk.create_xor( a, b ) : ( i % 4u == 1u ? ntk.create_or( a, b ) : ntk.create_and( a, b ) ) );
+    }
+    for ( auto i = fs.size() - 6u; i < fs.size(); ++i )
+    {
+      ntk.create_po( fs[i] );
+    }
+  };
+
+  aos_ntk aos;
+  soa_ntk soa;
+  build( aos );
+  build( soa );
+
+  auto const check_equal = [&]() {
+    REQUIRE( aos.size() == soa.size() );
+    CHECK( aos.num_gates() == soa.num_gates() );
+    for ( auto n = 0u; n < aos.size(); ++n )
+    {
+      CHECK( aos.is_dead( n ) == soa.is_dead( n ) );
+      CHECK( aos.fanout_size( n ) == soa.fanout_size( n ) );
+      CHECK( aos.is_pi( n ) == soa.is_pi( n ) );
+      std::vector<uint64_t> fanins_aos, fanins_soa;
+      aos.foreach_fanin( n, [&]( auto const& f ) { fanins_aos.push_back( f.data ); } );
+      soa.foreach_fanin( n, [&]( auto const& f ) { fanins_soa.push_back( f.data ); } );
+      CHECK( fanins_aos == fanins_soa );
+    }
+    auto const tts_aos = simulate<kitty::static_truth_table<6u>>( aos );
+    auto const tts_soa = simulate<kitty::static_truth_table<6u>>( soa );
+    CHECK( tts_aos == tts_soa );
+  };
+  check_equal();
+
+  /* structural hashing finds existing gates */
+  auto const num_gates = soa.num_gates();
+  soa.foreach_gate( [&]( auto const& n ) {
+    std::vector<typename soa_ntk::signal> children;
+    soa.foreach_fanin( n, [&]( auto const& f ) { children.push_back( f ); } );
+    CHECK( soa.get_node( soa.clone_node( soa, n, children ) ) == n );
+  } );
+  CHECK( soa.num_gates() == num_gates );
+
+  /* values and visited flags */
+  soa.set_value( 7u, 3u );
+  soa.set_visited( 8u, 2u );
+  CHECK( soa.value( 7u ) == 3u );
+  CHECK( soa.visited( 8u ) == 2u );
+  CHECK( soa.value( 8u ) == 0u );
+  soa.clear_values();
+  soa.clear_visited();
+  CHECK( soa.value( 7u ) == 0u );
+  CHECK( soa.visited( 8u ) == 0u );
+
+  /* substitution, with and without restrashing */
+  for ( auto n = 20u; n < aos.size(); n += 7u )
+  {
+    if ( aos.is_dead( n ) )
+      continue;
+    auto const s = typename aos_ntk::signal( n / 2u, n & 1u );
+    aos.substitute_node( n, s );
+    soa.substitute_node( n, typename soa_ntk::signal( s.data ) );
+  }
+  check_equal();
+
+  auto const copy = soa.clone();
+  CHECK( simulate<kitty::static_truth_table<6u>>( copy ) == simulate<kitty::static_truth_table<6u>>( soa ) );
+
+  auto const aos_clean = cleanup_dangling( aos );
+  auto const soa_clean = cleanup_dangling( soa );
+  CHECK( aos_clean.num_gates() == soa_clean.num_gates() );
+  CHECK( depth_view{ aos_clean }.depth() == depth_view{ soa_clean }.depth() );
+  CHECK( cut_enumeration( aos_clean ).total_cuts() == cut_enumeration( soa_clean ).total_cuts() );
+  CHECK( simulate<kitty::static_truth_table<6u>>( aos_clean ) == simulate<kitty::static_truth_table<6u>>( soa_clean ) );
+}
+
+TEMPLATE_TEST_CASE( "build networks in bulk without structural hashing", "[storage]", aig_network, aig_soa_network, xag_network, mig_network )
+{
+  TestType ntk;
+  std::vector<typename TestType::signal> fs;
+  for ( auto i = 0u; i < 12u; ++i )
+  {
+    fs.push_back( ntk.create_pi() );
+  }
+  for ( auto i = 0u; i < 20000u; ++i )
+  {
+    auto const a = fs[( 7919u * i + 1u ) % fs.size()] ^ ( i % 3u == 0u );
+    auto const b = fs[fs.size() - 1u - ( i % 13u )] ^ ( i % 2u == 0u );
+    fs.push_back( i % 4u == 0u ? ntk.create_xor( a, b ) : ntk.create_and( a, b ) );
+  }
+  for ( auto i = 0u; i < 16u; ++i )
+  {
+    ntk.create_po( fs[fs.size() - 1u - 5u * i] );
+  }
+
+  /* copy in topological order, hash table is rebuilt on several threads */
+  TestType copy;
+  copy.begin_bulk( ntk.size() );
+  node_map<typename TestType::signal, TestType> old_to_new( ntk );
+  old_to_new[ntk.get_constant( false )] = copy.get_constant( false );
+  ntk.foreach_pi( [&]( auto const& n ) {
+    old_to_new[n] = copy.create_pi();
+  } );
+  ntk.foreach_gate( [&]( auto const& n ) {
+    std::vector<typename TestType::signal> children;
+    ntk.foreach_fanin( n, [&]( auto const& f ) {
+      children.push_back( old_to_new[f] ^ ntk.is_complemented( f ) );
+    } );
+    old_to_new[n] = copy.clone_node( ntk, n, children );
+  } );
+  ntk.foreach_po( [&]( auto const& f ) {
+    copy.create_po( old_to_new[f] ^ ntk.is_complemented( f ) );
+  } );
+  CHECK( copy.num_gates() == ntk.num_gates() );
+  CHECK( copy.end_bulk( 4u ) == 0u );
+
+  CHECK( copy.num_gates() == ntk.num_gates() );
+  CHECK( simulate<kitty::static_truth_table<12u>>( copy ) == simulate<kitty::static_truth_table<12u>>( ntk ) );
+
+  /* structural hashing finds every gate again */
+  auto const num_gates = copy.num_gates();
+  ntk.foreach_gate( [&]( auto const& n ) {
+    std::vector<typename TestType::signal> children;
+    ntk.foreach_fanin( n, [&]( auto const& f ) {
+      children.push_back( old_to_new[f] ^ ntk.is_complemented( f ) );
+    } );
+    CHECK( copy.clone_node( ntk, n, children ) == old_to_new[n] );
+  } );
+  CHECK( copy.num_gates() == num_gates );
+
+  /* gates appended twice are reported as duplicates */
+  copy.begin_bulk( copy.size() + 3u );
+  auto const p = copy.create_pi();
+  auto const g1 = copy.create_and( p, !fs[5] );
+  auto const g2 = copy.create_and( p, !fs[5] );
+  CHECK( g1 != g2 );
+  CHECK( copy.num_gates() == num_gates + 2u );
+  CHECK( copy.end_bulk() == 1u );
+  CHECK( copy.num_gates() == num_gates + 1u );
+  CHECK( copy.create_and( p, !fs[5] ) == g1 );
+}
+
+TEST_CASE( "partition index ranges for parallel loops", "[storage]" )
+{
+  std::vector<uint32_t> counts( 50000u, 0u );
+  parallel_for( 10u, counts.size(), 3u, [&]( uint64_t begin, uint64_t end, uint32_t ) {
+    for ( auto i = begin; i < end; ++i )
+    {
+      ++counts[i];
+    }
+  } );
+  CHECK( std::count( counts.begin(), counts.begin() + 10u, 0u ) == 10 );
+  CHECK( std::count( counts.begin() + 10u, counts.end(), 1u ) == static_cast<int64_t>( counts.size() - 10u ) );
+}
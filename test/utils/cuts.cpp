@@ -1,5 +1,7 @@
 #include <catch.hpp>
 
+#include <algorithm>
+#include <random>
 #include <vector>
 
 #include <mockturtle/utils/cuts.hpp>
@@ -89,6 +91,53 @@ TEST_CASE( "merge cuts", "[cuts]" )
   CHECK( r12t.size() == 3 );
 }
 
+TEMPLATE_TEST_CASE( "dominate and merge random cuts", "[cuts]", cut<6>, cut<16>, cut<51> )
+{
+  std::mt19937 gen( 42u );
+  /* small leaf range for many overlaps, multiples of 64 share signature bits */
+  std::vector<uint32_t> const pool{ 0u, 1u, 2u, 3u, 64u, 65u, 128u, 129u, 192u, 200u, 0x7fffffffu, 0x80000000u, 0xffffffffu };
+  uint32_t const max_size = 6u;
+
+  auto const random_leaves = [&]() {
+    std::vector<uint32_t> leaves = pool;
+    std::shuffle( leaves.begin(), leaves.end(), gen );
+    leaves.resize( gen() % ( max_size + 1u ) );
+    std::sort( leaves.begin(), leaves.end() );
+    return leaves;
+  };
+
+  for ( auto i = 0u; i < 5000u; ++i )
+  {
+    auto const l1 = random_leaves();
+    auto const l2 = random_leaves();
+    TestType c1, c2, res;
+    c1.set_leaves( l1 );
+    c2.set_leaves( l2 );
+
+    CHECK( c1.dominates( c2 ) == std::includes( l2.begin(), l2.end(), l1.begin(), l1.end() ) );
+    CHECK( c2.dominates( c1 ) == std::includes( l1.begin(), l1.end(), l2.begin(), l2.end() ) );
+
+    std::vector<uint32_t> joint;
+    std::set_union( l1.begin(), l1.end(), l2.begin(), l2.end(), std::back_inserter( joint ) );
+    auto const cut_size = gen() % 7u;
+    REQUIRE( c1.merge( c2, res, cut_size ) == ( joint.size() <= cut_size ) );
+    if ( joint.size() <= cut_size )
+    {
+      CHECK( std::vector<uint32_t>( res.begin(), res.end() ) == joint );
+      CHECK( res.size() == joint.size() );
+      CHECK( res.signature() == ( c1.signature() | c2.signature() ) );
+    }
+
+    if ( l1.size() + l2.size() <= max_size )
+    {
+      TestType copy = c1;
+      copy.add_leaves( l2.begin(), l2.end() );
+      CHECK( copy.size() == l1.size() + l2.size() );
+      CHECK( copy.signature() == ( c1.signature() | c2.signature() ) );
+    }
+  }
+}
+
 TEST_CASE( "create cut set", "[cuts]" )
 {
   using cut_type = cut<10, uint32_t>;
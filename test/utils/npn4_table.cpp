@@ -0,0 +1,50 @@
+#include <catch.hpp>
+
+#include <vector>
+
+#include <kitty/npn.hpp>
+#include <kitty/static_truth_table.hpp>
+#include <mockturtle/utils/npn4_table.hpp>
+
+using namespace mockturtle;
+
+TEST_CASE( "classify all 4-input functions with the NPN table", "[npn4_table]" )
+{
+  auto const& table = npn4_table::get();
+  CHECK( &table == &npn4_table::get() );
+  CHECK( table.num_classes() == 222u );
+
+  std::vector<uint32_t> class_size( table.num_classes(), 0u );
+
+  kitty::static_truth_table<4u> tt, repr;
+  for ( auto f = 0u; f < npn4_table::num_functions; ++f )
+  {
+    tt._bits = f;
+    auto const& config = table[tt];
+
+    REQUIRE( config.class_index < table.num_classes() );
+    CHECK( config.representative == table.representative( config.class_index ) );
+    ++class_size[config.class_index];
+
+    /* the configuration maps the representative back to the function */
+    repr._bits = config.representative;
+    std::vector<uint8_t> perm( config.perm.begin(), config.perm.end() );
+    CHECK( kitty::create_from_npn_config( std::make_tuple( repr, static_cast<uint32_t>( config.phase ), perm ) ) == tt );
+
+    /* same representatives and transformations as exact NPN canonization */
+    if ( f % 61u == 0u )
+    {
+      auto const [kitty_repr, kitty_phase, kitty_perm] = kitty::exact_npn_canonization( tt );
+      CHECK( kitty_repr == repr );
+      CHECK( kitty_phase == config.phase );
+      CHECK( kitty_perm == perm );
+    }
+  }
+
+  for ( auto i = 0u; i < table.num_classes(); ++i )
+  {
+    CHECK( class_size[i] > 0u );
+    CHECK( table[table.representative( i )].class_index == i );
+  }
+  CHECK( table.representative( 0u ) == 0u );
+}
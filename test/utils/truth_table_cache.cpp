@@ -2,6 +2,7 @@
 
 #include <kitty/constructors.hpp>
 #include <kitty/dynamic_truth_table.hpp>
+#include <kitty/operations.hpp>
 #include <mockturtle/utils/truth_table_cache.hpp>
 
 using namespace mockturtle;
@@ -44,4 +45,84 @@ TEST_CASE( "working with a truth table cache", "[truth_table_cache]" )
   CHECK( cache[7] == ~f_or );
   CHECK( cache[8] == f_maj );
   CHECK( cache[9] == ~f_maj );
+
+  cache.clear();
+  CHECK( cache.size() == 0 );
+  CHECK( cache.insert( f_maj ) == 0 );
+}
+
+TEST_CASE( "insert words and large truth tables into a truth table cache", "[truth_table_cache]" )
+{
+  truth_table_cache<kitty::dynamic_truth_table> cache( 4u );
+
+  /* words and truth tables refer to the same entries */
+  std::vector<uint32_t> lits;
+  for ( auto i = 0u; i < 2000u; ++i )
+  {
+    kitty::dynamic_truth_table tt( 1u + i % 6u );
+    kitty::create_random( tt, i );
+    auto const lit = cache.insert( tt );
+    CHECK( cache.insert_word( tt._bits[0], tt.num_vars() ) == lit );
+    CHECK( cache.insert_word( ~tt._bits[0], tt.num_vars() ) == ( lit ^ 1u ) );
+    CHECK( cache.num_vars( lit ) == tt.num_vars() );
+    CHECK( cache.word( lit ) == tt._bits[0] );
+    CHECK( cache[lit] == tt );
+    lits.push_back( lit );
+  }
+  for ( auto i = 0u; i < 2000u; ++i )
+  {
+    kitty::dynamic_truth_table tt( 1u + i % 6u );
+    kitty::create_random( tt, i );
+    CHECK( cache.insert( tt ) == lits[i] );
+  }
+
+  /* the same bits with a different number of variables are different entries */
+  auto const size = cache.size();
+  kitty::dynamic_truth_table x2( 2u ), x3( 3u );
+  kitty::create_nth_var( x2, 0u );
+  kitty::create_nth_var( x3, 0u );
+  CHECK( cache.insert( x2 ) != cache.insert( x3 ) );
+
+  kitty::dynamic_truth_table large( 9u );
+  kitty::create_majority( large );
+  auto const lit = cache.insert( large );
+  CHECK( cache.insert( ~large ) == ( lit ^ 1u ) );
+  CHECK( cache[lit] == large );
+  CHECK( cache[lit ^ 1u] == ~large );
+  CHECK( cache.size() <= size + 3u );
+
+  /* a cleared cache starts again at index 0 */
+  cache.clear();
+  CHECK( cache.size() == 0u );
+  CHECK( cache.insert( large ) == 0u );
+  CHECK( cache.insert( x2 ) == 2u );
+  CHECK( cache.insert_word( x2._bits[0], 2u ) == 2u );
+  CHECK( cache[0u] == large );
+}
+
+TEST_CASE( "clear a sparse truth table cache", "[truth_table_cache]" )
+{
+  truth_table_cache<kitty::dynamic_truth_table> cache( 1u << 12 );
+
+  for ( auto round = 0u; round < 3u; ++round )
+  {
+    /* only the slots of the inserted entries are reset */
+    std::vector<kitty::dynamic_truth_table> tts;
+    for ( auto i = 0u; i < 100u; ++i )
+    {
+      kitty::dynamic_truth_table tt( 7u + i % 2u );
+      kitty::create_random( tt, 100u * round + i );
+      tts.push_back( tt );
+      CHECK( cache.insert( tt ) == 2u * i + ( tt._bits[0] & 1u ) );
+    }
+    CHECK( cache.size() == 100u );
+    for ( auto i = 0u; i < 100u; ++i )
+    {
+      CHECK( cache[cache.insert( tts[i] )] == tts[i] );
+    }
+    CHECK( cache.size() == 100u );
+
+    cache.clear();
+    CHECK( cache.size() == 0u );
+  }
 }
@@ -1,11 +1,14 @@
 #include <catch.hpp>
 
+#include <vector>
+
 #include <mockturtle/networks/aig.hpp>
 #include <mockturtle/networks/klut.hpp>
 #include <mockturtle/networks/mig.hpp>
 #include <mockturtle/networks/xag.hpp>
 #include <mockturtle/traits.hpp>
 #include <mockturtle/views/depth_view.hpp>
+#include <mockturtle/views/fanout_view.hpp>
 
 using namespace mockturtle;
 
@@ -238,3 +241,99 @@ TEST_CASE( "compute levels during node construction after move assignment", "[de
 
   CHECK( dxag.depth() == 3u );
 }
+
+template<class DepthNtk, class Ntk>
+void check_incremental_levels( DepthNtk const& incremental, Ntk const& ntk, depth_view_params const& ps )
+{
+  depth_view_params ps_full = ps;
+  ps_full.incremental = false;
+  depth_view<Ntk> full{ ntk, {}, ps_full };
+
+  CHECK( incremental.depth() == full.depth() );
+  ntk.foreach_gate( [&]( auto const& n ) {
+    /* a full update only levelizes the transitive fanin of the outputs */
+    if ( ntk.visited( n ) != ntk.trav_id() )
+      return;
+    CHECK( incremental.level( n ) == full.level( n ) );
+    CHECK( incremental.is_on_critical_path( n ) == full.is_on_critical_path( n ) );
+  } );
+  ntk.foreach_pi( [&]( auto const& n ) {
+    CHECK( incremental.is_on_critical_path( n ) == full.is_on_critical_path( n ) );
+  } );
+}
+
+template<class DepthNtk>
+void test_incremental_levels( bool count_complements )
+{
+  using ntk_t = aig_network;
+
+  ntk_t aig;
+  std::vector<ntk_t::signal> fs;
+  for ( auto i = 0u; i < 8u; ++i )
+  {
+    fs.push_back( aig.create_pi() );
+  }
+  for ( auto i = 0u; i < 200u; ++i )
+  {
+    auto const a = fs[( 13u * i + 5u ) % fs.size()] ^ ( i % 3u == 0u );
+    auto const b = fs[fs.size() - 1u - ( i % 5u )] ^ ( i % 2u == 0u );
+    fs.push_back( aig.create_and( a, b ) );
+  }
+  for ( auto i = 0u; i < 8u; ++i )
+  {
+    aig.create_po( fs[fs.size() - 1u - 3u * i] );
+  }
+
+  depth_view_params ps;
+  ps.count_complements = count_complements;
+  ps.incremental = true;
+
+  DepthNtk dntk{ aig };
+  depth_view<DepthNtk> incremental{ dntk, {}, ps };
+  check_incremental_levels( incremental, aig, ps );
+
+  /* substitute nodes by shallower and by deeper signals */
+  for ( auto n = 30u; n < aig.size(); n += 11u )
+  {
+    if ( aig.is_dead( n ) )
+      continue;
+    auto const s = n % 2u == 0u ? fs[n / 3u] : !fs[n - 9u];
+    if ( aig.get_node( s ) == n || aig.is_dead( aig.get_node( s ) ) )
+      continue;
+    incremental.substitute_node( n, s );
+    check_incremental_levels( incremental, aig, ps );
+  }
+
+  /* new nodes on top of the critical path */
+  auto const top = incremental.create_and( fs[20], fs.back() );
+  incremental.create_po( top );
+  check_incremental_levels( incremental, aig, ps );
+
+  /* after set_level, update_levels falls back to a full recomputation */
+  incremental.set_level( aig.get_node( top ), 0u );
+  incremental.update_levels();
+  check_incremental_levels( incremental, aig, ps );
+}
+
+TEST_CASE( "update levels and critical paths incrementally", "[depth_view]" )
+{
+  test_incremental_levels<aig_network>( false );
+  test_incremental_levels<aig_network>( true );
+  test_incremental_levels<fanout_view<aig_network>>( false );
+}
+
+TEST_CASE( "compute levels of deep networks", "[depth_view]" )
+{
+  aig_network aig;
+  auto const a = aig.create_pi();
+  auto f = aig.create_pi();
+  for ( auto i = 0u; i < 500000u; ++i )
+  {
+    f = aig.create_and( a, !f );
+  }
+  aig.create_po( f );
+
+  depth_view depth_aig{ aig };
+  CHECK( depth_aig.depth() == 500000u );
+  CHECK( depth_aig.is_on_critical_path( aig.get_node( a ) ) );
+}
@@ -298,4 +298,60 @@ TEST_CASE( "substitute node with no restrash complemented node in fanout view",
   CHECK( faig.fanout_size( faig.get_node( f2 ) ) == 1 );
 
   CHECK( simulate<kitty::static_truth_table<2u>>( faig )[0]._bits == 0x7 );
-}
\ No newline at end of file
+}
+TEST_CASE( "fanouts of high-fanout nodes are updated incrementally", "[fanout_view]" )
+{
+  fanout_view<aig_network> aig;
+  auto const a = aig.create_pi();
+  auto const b = aig.create_pi();
+
+  std::vector<aig_network::signal> fs;
+  for ( auto i = 0u; i < 2000u; ++i )
+  {
+    auto const c = aig.create_pi();
+    fs.push_back( aig.create_and( i % 2u ? a : b, c ) );
+    fs.push_back( aig.create_and( a, !c ) );
+  }
+  for ( auto i = 0u; i + 1u < fs.size(); i += 2u )
+  {
+    aig.create_po( aig.create_and( fs[i], fs[i + 1u] ) );
+  }
+  CHECK( aig.fanout( aig.get_node( a ) ).size() == 3000u );
+  CHECK( aig.fanout( aig.get_node( b ) ).size() == 1000u );
+
+  /* replace half of the first-level gates */
+  for ( auto i = 0u; i < fs.size(); i += 4u )
+  {
+    aig.substitute_node( aig.get_node( fs[i] ), i % 8u ? b : !a );
+  }
+
+  fanout_view<aig_network> fresh{ aig };
+  aig.foreach_node( [&]( auto const& n ) {
+    std::multiset<aig_network::node> incremental, computed;
+    aig.foreach_fanout( n, [&]( auto const& p ) {
+      if ( !aig.is_dead( p ) )
+        incremental.insert( p );
+    } );
+    fresh.foreach_fanout( n, [&]( auto const& p ) { computed.insert( p ); } );
+    CHECK( incremental == computed );
+    CHECK( fresh.fanout( n ).size() == computed.size() );
+  } );
+}
+
+TEST_CASE( "fanouts are stored once for repeated fanins", "[fanout_view]" )
+{
+  klut_network klut;
+  auto const a = klut.create_pi();
+  auto const b = klut.create_pi();
+  kitty::dynamic_truth_table maj( 3u );
+  kitty::create_majority( maj );
+  auto const f1 = klut.create_node( { a, a, b }, maj );
+  auto const f2 = klut.create_node( { b, f1, b }, maj );
+  klut.create_po( f2 );
+
+  fanout_view fanout_klut{ klut };
+  CHECK( fanout_klut.fanout( a ) == std::vector<klut_network::node>{ f1 } );
+  CHECK( fanout_klut.fanout( b ) == std::vector<klut_network::node>{ f1, f2 } );
+  CHECK( fanout_klut.fanout( f1 ) == std::vector<klut_network::node>{ f2 } );
+  CHECK( fanout_klut.fanout( f2 ).empty() );
+}
@@ -0,0 +1,183 @@
+#include <catch.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <kitty/static_truth_table.hpp>
+#include <mockturtle/algorithms/cut_enumeration.hpp>
+#include <mockturtle/algorithms/detail/mffc_utils.hpp>
+#include <mockturtle/algorithms/reconv_cut.hpp>
+#include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/klut.hpp>
+#include <mockturtle/traits.hpp>
+#include <mockturtle/utils/window_utils.hpp>
+#include <mockturtle/views/color_view.hpp>
+#include <mockturtle/views/topo_view.hpp>
+#include <mockturtle/views/traversal_view.hpp>
+
+using namespace mockturtle;
+
+TEST_CASE( "traversal state of a traversal view is kept out of the network", "[traversal_view]" )
+{
+  aig_network aig;
+  auto const a = aig.create_pi();
+  auto const b = aig.create_pi();
+  auto const f = aig.create_and( a, b );
+  aig.create_po( f );
+
+  aig.clear_values();
+  aig.clear_visited();
+  aig.set_value( aig.get_node( f ), 5u );
+
+  traversal_view view{ aig };
+  CHECK( is_network_type_v<decltype( view )> );
+  CHECK( view.value( aig.get_node( f ) ) == 0u );
+  CHECK( view.trav_id() == 0u );
+
+  view.incr_trav_id();
+  view.set_visited( aig.get_node( a ), view.trav_id() );
+  view.set_value( aig.get_node( b ), 2u );
+  CHECK( view.incr_value( aig.get_node( b ) ) == 2u );
+  CHECK( view.decr_value( aig.get_node( b ) ) == 2u );
+  CHECK( view.value( aig.get_node( b ) ) == 2u );
+  CHECK( view.visited( aig.get_node( a ) ) == 1u );
+
+  /* the network is unchanged */
+  CHECK( aig.trav_id() == 0u );
+  CHECK( aig.visited( aig.get_node( a ) ) == 0u );
+  CHECK( aig.value( aig.get_node( b ) ) == 0u );
+  CHECK( aig.value( aig.get_node( f ) ) == 5u );
+
+  view.clear_values();
+  view.clear_visited();
+  CHECK( view.value( aig.get_node( b ) ) == 0u );
+  CHECK( view.visited( aig.get_node( a ) ) == 0u );
+
+  /* nodes added after the view was created */
+  auto const g = view.create_and( a, !b );
+  view.set_value( view.get_node( g ), 7u );
+  CHECK( view.value( view.get_node( g ) ) == 7u );
+  CHECK( aig.value( aig.get_node( g ) ) == 0u );
+
+  /* colors are stored in the view as well */
+  color_view colors{ view };
+  auto const color = colors.new_color();
+  colors.paint( aig.get_node( f ) );
+  CHECK( colors.color( aig.get_node( f ) ) == color );
+  CHECK( aig.trav_id() == 0u );
+  CHECK( aig.visited( aig.get_node( f ) ) == 0u );
+}
+
+TEST_CASE( "colors do not overwrite node functions in k-LUT networks", "[traversal_view]" )
+{
+  klut_network klut;
+  auto const a = klut.create_pi();
+  auto const b = klut.create_pi();
+  auto const f = klut.create_and( a, b );
+  klut.create_po( f );
+
+  color_view colors{ klut };
+  colors.clear_colors( 3u );
+  colors.paint( f, colors.new_color() );
+
+  auto const tts = simulate<kitty::static_truth_table<2u>>( klut );
+  CHECK( tts[0]._bits == 0x8 );
+}
+
+namespace
+{
+
+struct analysis_result
+{
+  std::vector<aig_network::node> topo_order;
+  std::vector<uint32_t> mffc_sizes;
+  std::vector<std::vector<aig_network::node>> windows;
+  uint64_t total_cuts{};
+  std::vector<kitty::static_truth_table<8u>> functions;
+
+  bool operator==( analysis_result const& other ) const
+  {
+    return topo_order == other.topo_order && mffc_sizes == other.mffc_sizes && windows == other.windows && total_cuts == other.total_cuts && functions == other.functions;
+  }
+};
+
+template<class Ntk>
+analysis_result analyze( Ntk const& ntk )
+{
+  analysis_result result;
+
+  topo_view topo{ ntk };
+  topo.foreach_node( [&]( auto const& n ) {
+    result.topo_order.push_back( n );
+  } );
+
+  detail::initialize_values_with_fanout( ntk );
+  ntk.foreach_gate( [&]( auto const& n ) {
+    result.mffc_sizes.push_back( detail::mffc_size( ntk, n ) );
+  } );
+
+  color_view colors{ ntk };
+  reconvergence_driven_cut_parameters ps;
+  ps.max_leaves = 6u;
+  ntk.foreach_gate( [&]( auto const& n ) {
+    auto leaves = reconvergence_driven_cut<Ntk, false, false>( ntk, n, ps ).first;
+    colors.new_color();
+    for ( auto const& l : leaves )
+    {
+      colors.paint( l );
+    }
+    auto window = collect_nodes( colors, leaves, std::vector<aig_network::node>{ n } );
+    std::sort( window.begin(), window.end() );
+    result.windows.push_back( window );
+  } );
+
+  result.total_cuts = cut_enumeration( ntk ).total_cuts();
+  result.functions = simulate<kitty::static_truth_table<8u>>( ntk );
+
+  return result;
+}
+
+} // namespace
+
+TEST_CASE( "analyze a network from several threads", "[traversal_view]" )
+{
+  aig_network aig;
+  std::vector<aig_network::signal> fs;
+  for ( auto i = 0u; i < 8u; ++i )
+  {
+    fs.push_back( aig.create_pi() );
+  }
+  for ( auto i = 0u; i < 300u; ++i )
+  {
+    auto const x = fs[( 17u * i + 3u ) % fs.size()] ^ ( i % 3u == 0u );
+    auto const y = fs[fs.size() - 1u - ( i % 7u )] ^ ( i % 2u == 0u );
+    fs.push_back( i % 5u == 0u ? aig.create_xor( x, y ) : aig.create_and( x, y ) );
+  }
+  for ( auto i = 0u; i < 10u; ++i )
+  {
+    aig.create_po( fs[fs.size() - 1u - 5u * i] );
+  }
+
+  auto const expected = analyze( aig );
+
+  std::vector<analysis_result> results( 4u );
+  std::vector<std::thread> threads;
+  for ( auto i = 0u; i < results.size(); ++i )
+  {
+    threads.emplace_back( [&aig, &results, i]() {
+      traversal_view view{ aig };
+      results[i] = analyze( view );
+    } );
+  }
+  for ( auto& t : threads )
+  {
+    t.join();
+  }
+
+  for ( auto const& result : results )
+  {
+    CHECK( result == expected );
+  }
+}